@@ -1,10 +1,19 @@
 #!/usr/bin/env python3
 """
 Extract full case folding mappings from the Unicode Character Database to a
-TypeScript file.
+C header for the edit distance module, along with the ranges of code points
+in each script that it detects.
 
 These mappings [1] can be used to process a Unicode string for case-insensitive
-comparisons.
+comparisons. Each code point's mapping is followed by canonical decomposition,
+less any combining diacritical marks, so that the module folds a string in one
+pass, code point by code point, with no further normalization.
+
+Mappings are packed into a two-level table: an index from each block of 64
+code points to a block of 16-bit entries, shared by every block that folds no
+code point. An entry is either the low 16 bits of the single code point in the
+same plane that a code point folds to, or the offset of the code points that
+it folds to in a pool. Hangul syllables decompose by arithmetic instead.
 
 Copyright © 2023 James Seo <james@equiv.tech> (MIT license).
 
@@ -13,7 +22,10 @@ Copyright © 2023 James Seo <james@equiv.tech> (MIT license).
 
 
 import argparse
-from typing import Generator
+import re
+import unicodedata
+from pathlib import Path
+from typing import Callable, Generator
 from urllib.request import urlopen
 from sys import argv
 
@@ -21,8 +33,87 @@ Mapping = tuple[str, list[str]]
 StringGenerator = Generator[str, None, None]
 MappingGenerator = Generator[Mapping, None, None]
 
+ROOT = Path(__file__).resolve().parent.parent
 DATA_URL = "https://www.unicode.org/Public/UCD/latest/ucd/CaseFolding.txt"
-DEFAULT_OUTFILE = "casefoldingmap.ts"
+DEFAULT_OUTFILE = ROOT / "src" / "wasm" / "casefoldingmap.h"
+
+BLOCK_BITS = 6
+MAX_FOLD_LEN = 3
+POOL_TAG = 0xD800
+HANGUL_SYLLABLES = range(0xAC00, 0xD7A4)
+DIACRITICS_RE = re.compile("[\u0300-\u036f]")
+
+# Scripts that a query is searched by, in order, each with its ranges of code
+# points as findScriptsInString() from src/shared/strings.ts used to test.
+SCRIPT_RANGES: dict[str, list[tuple[int, int]]] = {
+    "arabic": [(0x0600, 0x06FF)],
+    "armenian": [(0x0530, 0x058F)],
+    "bengali": [(0x0981, 0x09FB)],
+    "burmese": [(0x1000, 0x109F)],
+    "cjk": [
+        (0x3300, 0x33FF),
+        (0x2F00, 0x2FDF),
+        (0xFE30, 0xFE4F),
+        (0xF900, 0xFAFF),
+        (0x2F800, 0x2FA1F),
+        (0x2E80, 0x2EFF),
+        (0x3000, 0x303F),
+        (0x31C0, 0x31EF),
+        (0x4E00, 0x9FFF),
+        (0x20000, 0x2A6D6),
+        (0x2A700, 0x2B73F),
+        (0x2B740, 0x2B81F),
+        (0x3200, 0x32FF),
+        (0x2FF0, 0x2FFF),
+        (0x3400, 0x4DBF),
+    ],
+    "cyrillic": [
+        (0x0400, 0x04FF),
+        (0x0500, 0x052F),
+        (0x2DE0, 0x2DFF),
+        (0xA640, 0xA69F),
+    ],
+    "devanagari": [(0x0901, 0x097F)],
+    "ethiopic": [(0x1200, 0x1399)],
+    "georgian": [(0x10A0, 0x10FF)],
+    "greekAndCoptic": [(0x0370, 0x03FF), (0x1F00, 0x1FFF)],
+    "gujarati": [(0x0A81, 0x0AF1)],
+    "gurmukhi": [(0x0A00, 0x0A7F)],
+    "hangul": [
+        (0xAC00, 0xD7A3),
+        (0x1100, 0x11FF),
+        (0x3130, 0x318F),
+        (0xA960, 0xA97F),
+        (0xD7B0, 0xD7FF),
+    ],
+    "hebrew": [(0x0590, 0x05FF)],
+    "hiragana": [(0x3040, 0x309F)],
+    "kannada": [(0x0C82, 0x0CF2)],
+    "katakana": [(0x30A0, 0x30FF), (0x31F0, 0x31FF)],
+    "khmer": [(0x1780, 0x17FF), (0x19E0, 0x19FF)],
+    "lao": [(0x0E81, 0x0EDF)],
+    "latin": [(0x41, 0x5A), (0x61, 0x7A)],
+    "latin1Sup": [(0x80, 0xFF)],
+    "latinExtA": [(0x0100, 0x017F)],
+    "latinExtB": [(0x0180, 0x024F)],
+    "malayalam": [(0x0D02, 0x0D7F)],
+    "mongolian": [(0x1800, 0x18AA)],
+    "orientalMisc": [
+        (0x3105, 0x312C),
+        (0x31A0, 0x31BF),
+        (0x3190, 0x319F),
+        (0x4DC0, 0x4DFF),
+    ],
+    "oriya": [(0x0B01, 0x0B77)],
+    "sinhala": [(0x0D82, 0x0DF4)],
+    "tamil": [(0x0B82, 0x0BFA)],
+    "telugu": [(0x0C01, 0x0C7F)],
+    "thai": [(0x0E01, 0x0E5B)],
+    "tibetan": [(0x0F00, 0x0FDA)],
+    "vietnamese": [(0x1EA0, 0x1EF9)],
+    "yi": [(0xA000, 0xA4CF)],
+}
+SCRIPTS = list(SCRIPT_RANGES)
 
 
 def gen_inlines(infile: str | None) -> StringGenerator:
@@ -49,40 +140,174 @@ def gen_mappings(infile: str | None) -> MappingGenerator:
         yield char, mapping
 
 
-def write_outfile(mappings: MappingGenerator, outfile: str):
-    lines = [
-        f"/* Generated by {argv[0]} */",
-        "const caseFoldingMap: Record<string, string> = {",
+def fold_code_point(c: str, case_fold: Callable[[str], str]) -> str:
+    """
+    Fold one code point as the module does: case fold it, decompose it, and
+    drop any diacritics, until nothing changes, so that folding is idempotent.
+    """
+    folded = c
+    while True:
+        refolded = "".join(
+            DIACRITICS_RE.sub("", unicodedata.normalize("NFD", case_fold(x)))
+            for x in folded
+        )
+        if refolded == folded:
+            return folded
+        folded = refolded
+
+
+def find_scripts(s: str) -> list[str]:
+    return [
+        script
+        for script, ranges in SCRIPT_RANGES.items()
+        if any(first <= ord(c) <= last for c in s for first, last in ranges)
     ]
 
-    for char, mapping in mappings:
-        codepoint = chr(int(char, 16))
-        replacement = "".join(chr(int(x, 16)) for x in mapping)
-        lines.append(f'  "{codepoint}": "{replacement}",')
 
-    lines.append("} as const;")
-    lines.append("export default caseFoldingMap;")
+def write_outfile(mappings: MappingGenerator, outfile: Path):
+    case_folds = {
+        chr(int(char, 16)): "".join(chr(int(x, 16)) for x in mapping)
+        for char, mapping in mappings
+    }
+    folds: dict[int, str] = {}
+    for code_point in range(0x110000):
+        if 0xD800 <= code_point <= 0xDFFF or code_point in HANGUL_SYLLABLES:
+            continue
+        c = chr(code_point)
+        folded = fold_code_point(c, lambda x: case_folds.get(x, x))
+        if folded != c:
+            folds[code_point] = folded
+    if any(len(folded) > MAX_FOLD_LEN for folded in folds.values()):
+        raise ValueError("Code point folds to too many")
+
+    block_size = 1 << BLOCK_BITS
+    n_index = (max(folds) >> BLOCK_BITS) + 1
+    pool: list[int] = []
+    pool_offsets: dict[str, int] = {}
+    blocks: list[list[int]] = [[0] * block_size]
+    block_numbers: dict[tuple[int, ...], int] = {tuple(blocks[0]): 0}
+    index: list[int] = []
+
+    for i in range(n_index):
+        block = [0] * block_size
+        for j in range(block_size):
+            code_point = i << BLOCK_BITS | j
+            folded = folds.get(code_point)
+            if folded is None:
+                continue
+            low = ord(folded[0]) & 0xFFFF if folded else 0
+            if (
+                len(folded) == 1
+                and ord(folded) >> 16 == code_point >> 16
+                and low
+                and not POOL_TAG <= low <= 0xDFFF
+            ):
+                block[j] = low
+                continue
+            if folded not in pool_offsets:
+                pool_offsets[folded] = len(pool)
+                pool += [len(folded), *map(ord, folded)]
+            block[j] = POOL_TAG + pool_offsets[folded]
+        key = tuple(block)
+        if key not in block_numbers:
+            block_numbers[key] = len(blocks)
+            blocks.append(block)
+        index.append(block_numbers[key])
 
-    with open(outfile, "w") as ofile:
-        for line in lines:
-            print(line, file=ofile)
+    if len(pool) > 0xDFFF - POOL_TAG or len(blocks) > 0xFF:
+        raise ValueError("Folding table overflows its entries")
 
-    print(f"Extracted {len(lines) - 4} mappings.")
+    ranges = sorted(
+        (first, last, i)
+        for i, script in enumerate(SCRIPTS)
+        for first, last in SCRIPT_RANGES[script]
+    )
+    for (_, last, _), (first, _, _) in zip(ranges, ranges[1:]):
+        if first <= last:
+            raise ValueError("Script ranges overlap")
+
+    lines = [
+        f"/* Generated by {argv[0]} */",
+        "",
+        "#pragma once",
+        "",
+        "#include <stdint.h>",
+        "",
+        f"#define EDIST_FOLD_BLOCK_BITS {BLOCK_BITS}",
+        f"#define EDIST_FOLD_LIMIT      0x{n_index << BLOCK_BITS:x}",
+        f"#define EDIST_FOLD_POOL_TAG   0x{POOL_TAG:x}",
+        f"#define EDIST_MAX_FOLD_LEN    {MAX_FOLD_LEN}",
+        f"#define EDIST_SCRIPTS         {len(SCRIPTS)}",
+        "",
+        "/** Block of each 64 code points below EDIST_FOLD_LIMIT. */",
+        "static const uint8_t kEdistFoldIndex[] = {",
+    ]
+    for i in range(0, len(index), 16):
+        lines.append("    " + ", ".join(map(str, index[i : i + 16])) + ",")
+    lines += [
+        "};",
+        "",
+        "/**",
+        " * What each code point in a block folds to: 0 if itself, the low 16 bits",
+        " * of the one code point in the same plane, or else EDIST_FOLD_POOL_TAG",
+        " * plus the offset in the pool of their count, followed by each of them.",
+        " */",
+        f"static const uint16_t kEdistFoldBlocks[][{block_size}] = {{",
+    ]
+    for block in blocks:
+        lines.append("    {")
+        for i in range(0, block_size, 8):
+            row = ", ".join(f"0x{e:04x}" for e in block[i : i + 8])
+            lines.append(f"        {row},")
+        lines.append("    },")
+    lines += [
+        "};",
+        "",
+        "static const uint32_t kEdistFoldPool[] = {",
+    ]
+    for i in range(0, len(pool), 6):
+        row = ", ".join(f"0x{x:05x}" for x in pool[i : i + 6])
+        lines.append(f"    {row},")
+    lines += [
+        "};",
+        "",
+        "/** Code points in a script, from first to last. */",
+        "typedef struct edist_script_range_t {",
+        "  uint32_t first; /** First code point. */",
+        "  uint32_t last;  /** Last code point. */",
+        "  uint8_t script; /** Script number. */",
+        "} edist_script_range_t;",
+        "",
+        "/** Ranges of code points in each script, sorted. */",
+        "static const edist_script_range_t kEdistScriptRanges[] = {",
+        *(
+            f"    {{0x{first:05x}, 0x{last:05x}, {i}}}, /* {SCRIPTS[i]} */"
+            for first, last, i in ranges
+        ),
+        "};",
+    ]
+
+    outfile.write_text("\n".join(lines) + "\n", "utf-8")
+    print(
+        f"Packed {len(folds)} foldings into {len(blocks)} blocks and "
+        f"{len(pool)} pooled code points."
+    )
 
 
 def main():
     parser = argparse.ArgumentParser(
         description=(
             "Extract full case folding mappings from the "
-            "Unicode Character Database to a TypeScript file."
+            "Unicode Character Database to a C header."
         )
     )
     parser.add_argument(
         "outfile",
-        help=f"Output path to binary mapping file (default: {DEFAULT_OUTFILE}",
+        help=f"Output path to C header (default: {DEFAULT_OUTFILE})",
         default=DEFAULT_OUTFILE,
         metavar="OUTFILE",
         nargs="?",
+        type=Path,
     )
     parser.add_argument(
         "-i",
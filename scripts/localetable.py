@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+"""
+Fold every known locale's tag and display name ahead of time into a C table
+for the edit distance module, and list the tags in the same order for
+TypeScript.
+
+Strings are folded code point by code point exactly as the module folds user
+locales and queries (see casefoldingmap.py), str.casefold() applying the same
+full case folding mappings, and tags without a script subtag get the same fake
+one that the module inserts into those of user locales. Each locale is also
+listed under the scripts of its display name, as the module lists them.
+"""
+
+
+import argparse
+import re
+from pathlib import Path
+from sys import argv
+
+from casefoldingmap import SCRIPTS, find_scripts, fold_code_point
+
+ROOT = Path(__file__).resolve().parent.parent
+LOCALES_TS = ROOT / "src" / "shared" / "locales.ts"
+DEFAULT_C_OUTFILE = ROOT / "src" / "wasm" / "localetable.h"
+DEFAULT_TS_OUTFILE = ROOT / "src" / "shared" / "localetable.ts"
+
+MAX_TAG_CODE_UNITS = 12
+MAX_NAME_CODE_UNITS = 40
+FAKE_SCRIPT_SUBTAG = "\0\0\0\0-"
+
+# Queries in kana find Japanese, though its display name is all kanji.
+EXTRA_SCRIPTS = {"ja-JP": ["hiragana", "katakana"]}
+
+LOCALE_RE = re.compile(r'^\s*"([^"]+)": \["([^"]*)",', re.MULTILINE)
+
+
+def read_known_locales() -> list[tuple[str, str]]:
+    text = LOCALES_TS.read_text("utf-8")
+    start = text.index("export const knownLocales")
+    end = text.index("};", start)
+    return LOCALE_RE.findall(text[start:end])
+
+
+def sort_key(tag: str) -> tuple[str, str, str]:
+    """Same order as sortLocales() from src/shared/locales.ts."""
+    parts = tag.split("-")
+    if len(parts) < 3:
+        return parts[0], parts[1], ""
+    return parts[0], parts[2], parts[1]
+
+
+def fold(s: str) -> str:
+    return "".join(fold_code_point(c, str.casefold) for c in s)
+
+
+def code_units(s: str) -> int:
+    return len(s.encode("utf-16-le")) // 2
+
+
+def write_c_outfile(locales: list[tuple[str, str]], outfile: Path):
+    points: list[int] = []
+    entries: list[str] = []
+
+    for tag, name in locales:
+        folded_tag = fold(tag)
+        folded_name = fold(name)
+        if code_units(folded_tag) > MAX_TAG_CODE_UNITS:
+            raise ValueError(f"Tag too long: {tag}")
+        if code_units(folded_name) > MAX_NAME_CODE_UNITS:
+            raise ValueError(f"Display name too long: {tag}")
+
+        fake_at = 0
+        if folded_tag.count("-") < 2:
+            fake_at = folded_tag.index("-") + 1
+            folded_tag = (
+                folded_tag[:fake_at] + FAKE_SCRIPT_SUBTAG + folded_tag[fake_at:]
+            )
+
+        tag_points = [ord(c) for c in folded_tag]
+        name_points = [ord(c) for c in folded_name]
+        scripts = find_scripts(name) + EXTRA_SCRIPTS.get(tag, [])
+        script_bits = sum(1 << SCRIPTS.index(script) for script in set(scripts))
+        entries.append(
+            f"    {{{len(points)}, {len(tag_points)}, {fake_at}, "
+            f"{len(points) + len(tag_points)}, {len(name_points)}, "
+            f"0x{script_bits:x}}}, /* {tag} */"
+        )
+        points += tag_points + name_points
+
+    lines = [
+        f"/* Generated by {argv[0]} */",
+        "",
+        "#pragma once",
+        "",
+        "#include <stdint.h>",
+        "",
+        f"#define EDIST_TABLE_LOCALES {len(locales)}",
+        "",
+        "/** Folded locale tag and display name, as offsets into the pool. */",
+        "typedef struct edist_table_locale_t {",
+        "  uint16_t tag;     /** Tag, with any fake script subtag. */",
+        "  uint8_t tag_len;  /** Tag length. */",
+        "  uint8_t fake_at;  /** Index of the fake script subtag, or 0. */",
+        "  uint16_t name;    /** Display name. */",
+        "  uint8_t name_len; /** Display name length. */",
+        "  uint64_t scripts; /** Bit i set if in script i (casefoldingmap.h). */",
+        "} edist_table_locale_t;",
+        "",
+        "static const uint32_t kEdistTablePool[] = {",
+    ]
+    for i in range(0, len(points), 9):
+        row = ", ".join(f"0x{c:04x}" for c in points[i : i + 9])
+        lines.append(f"    {row},")
+    lines += [
+        "};",
+        "",
+        "static const edist_table_locale_t kEdistTable[EDIST_TABLE_LOCALES] = {",
+        *entries,
+        "};",
+    ]
+
+    outfile.write_text("\n".join(lines) + "\n", "utf-8")
+    print(f"Folded {len(locales)} locales into {len(points)} code points.")
+
+
+def write_ts_outfile(locales: list[tuple[str, str]], outfile: Path):
+    lines = [
+        f"/* Generated by {argv[0]} */",
+        "const localeTable: readonly string[] = [",
+        *(f'  "{tag}",' for tag, _ in locales),
+        "] as const;",
+        "export default localeTable;",
+    ]
+
+    outfile.write_text("\n".join(lines) + "\n", "utf-8")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=(
+            "Fold known locale tags and display names into a C table for the "
+            "edit distance module."
+        )
+    )
+    parser.add_argument(
+        "--c-outfile",
+        help=f"Output path to C header (default: {DEFAULT_C_OUTFILE})",
+        default=DEFAULT_C_OUTFILE,
+        type=Path,
+    )
+    parser.add_argument(
+        "--ts-outfile",
+        help=f"Output path to tag list (default: {DEFAULT_TS_OUTFILE})",
+        default=DEFAULT_TS_OUTFILE,
+        type=Path,
+    )
+
+    args = parser.parse_args()
+    locales = sorted(read_known_locales(), key=lambda x: sort_key(x[0]))
+    write_c_outfile(locales, args.c_outfile)
+    write_ts_outfile(locales, args.ts_outfile)
+
+
+if __name__ == "__main__":
+    main()
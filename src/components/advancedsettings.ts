@@ -6,19 +6,56 @@ import { ArrowDropdown } from "@components/arrowdropdown";
 import "@components/collapsesetting";
 import "@components/infodropdown";
 
-import AppSettings from "@shared/appsettings";
+import AppSettings, { Engine, knownEngines } from "@shared/appsettings";
 import BaseElement, { registerEventHandler } from "@shared/element";
-import { ReadyBusyEvent, SettingsEvent } from "@shared/events";
+import {
+  ReadyBusyEvent,
+  ServerOffsetEvent,
+  SettingsEvent,
+} from "@shared/events";
 import { AdvancedSettingsGroup } from "@shared/groups";
+import RadioTimeSignal, { getSettingsParams } from "@shared/radiotimesignal";
+
+const kEngineLabels: Record<Engine, string> = {
+  worklet: "Full",
+  pipeline: "Ahead",
+  automation: "Lite",
+} as const;
+
+/* Format minutes after midnight as the value of a time input. */
+function formatMinutes(min: number) {
+  const hh = `${Math.floor(min / 60)}`.padStart(2, "0");
+  const mm = `${min % 60}`.padStart(2, "0");
+  return `${hh}:${mm}`;
+}
 
 @customElement("advanced-settings")
 export class AdvancedSettings extends BaseElement {
   @property({ type: Boolean, reflect: true })
   accessor noclip = true;
 
+  @property({ type: String, reflect: true })
+  accessor engine: Engine = "worklet";
+
+  @property({ type: Boolean, reflect: true })
+  accessor standby = false;
+
+  @property({ type: Boolean, reflect: true })
+  accessor schedule = false;
+
+  /** Start of the daily transmit window, in minutes after midnight. */
+  @property({ type: Number, attribute: "schedule-start", reflect: true })
+  accessor scheduleStart = 120;
+
+  /** End of the daily transmit window, in minutes after midnight. */
+  @property({ type: Number, attribute: "schedule-end", reflect: true })
+  accessor scheduleEnd = 180;
+
   @property({ type: Boolean, reflect: true })
   accessor sync = true;
 
+  #serverOffset = 0;
+
   @query("advanced-settings arrow-dropdown", true)
   private accessor arrowDropdown!: ArrowDropdown;
 
@@ -30,27 +67,81 @@ export class AdvancedSettings extends BaseElement {
 
   @registerEventHandler(ReadyBusyEvent)
   handleReadyBusy(ready: boolean) {
-    if (ready) this.#getSettings();
+    if (!ready) return;
+    this.#getSettings();
+    this.#updateSchedule();
+  }
+
+  @registerEventHandler(ServerOffsetEvent)
+  handleServerOffset(serverOffset: number) {
+    this.#serverOffset = serverOffset;
   }
 
   #getSettings() {
     this.noclip = AppSettings.get("noclip");
+    this.engine = AppSettings.get("engine");
+    this.standby = AppSettings.get("standby");
     this.sync = AppSettings.get("sync");
+    this.schedule = AppSettings.get("schedule");
+    this.scheduleStart = AppSettings.get("scheduleStart");
+    this.scheduleEnd = AppSettings.get("scheduleEnd");
   }
 
   #saveSettings() {
     AppSettings.set("noclip", this.noclip);
+    AppSettings.set("engine", this.engine);
+    AppSettings.set("standby", this.standby);
     AppSettings.set("sync", this.sync);
+    AppSettings.set("schedule", this.schedule);
+    AppSettings.set("scheduleStart", this.scheduleStart);
+    AppSettings.set("scheduleEnd", this.scheduleEnd);
+    RadioTimeSignal.updateStandby(this.standby, this.engine);
+    this.#updateSchedule();
+  }
+
+  /* Transmit within the daily window with the settings of the time. */
+  #updateSchedule() {
+    if (!this.schedule) {
+      RadioTimeSignal.unschedule();
+      return;
+    }
+
+    RadioTimeSignal.schedule(
+      [{ startMin: this.scheduleStart, endMin: this.scheduleEnd }],
+      () => getSettingsParams(this.#serverOffset),
+    );
   }
 
   #changeNoclip = () => {
     this.noclip = !this.noclip;
   };
 
+  #changeStandby = () => {
+    this.standby = !this.standby;
+  };
+
   #changeSync = () => {
     this.sync = !this.sync;
   };
 
+  #changeSchedule = () => {
+    this.schedule = !this.schedule;
+  };
+
+  #changeScheduleStart = (event: Event) => {
+    const min = (event.target as HTMLInputElement).valueAsNumber / 60000;
+    if (!Number.isNaN(min)) this.scheduleStart = Math.round(min) % 1440;
+  };
+
+  #changeScheduleEnd = (event: Event) => {
+    const min = (event.target as HTMLInputElement).valueAsNumber / 60000;
+    if (!Number.isNaN(min)) this.scheduleEnd = Math.round(min) % 1440;
+  };
+
+  #clickEngine(engine: Engine) {
+    this.engine = engine;
+  }
+
   protected render() {
     return html`
       <div class="flex flex-col">
@@ -91,6 +182,63 @@ export class AdvancedSettings extends BaseElement {
                 />
               </div>
 
+              <div class="flex h-12 items-center">
+                <h4 class="font-semibold sm:text-lg">Engine</h4>
+
+                <info-dropdown
+                  class="grow"
+                  classes="max-w-[7rem] min-[420px]:max-w-[16rem]"
+                  .content=${html`
+                    <h4 class="font-bold">Engine</h4>
+                    <span class="text-sm">
+                      Ahead renders in advance to avoid glitches. Lite uses
+                      less battery, but keeps time less precisely.
+                    </span>
+                  `}
+                  grow
+                ></info-dropdown>
+
+                <div class="join mr-2">
+                  ${knownEngines.map(
+                    (engine) => html`
+                      <input
+                        class="btn join-item btn-sm ms-0 w-16"
+                        type="radio"
+                        name="engine"
+                        aria-label="${kEngineLabels[engine]}"
+                        .checked=${this.engine === engine}
+                        @click=${() => this.#clickEngine(engine)}
+                      />
+                    `,
+                  )}
+                </div>
+              </div>
+
+              <div class="flex h-12 items-center">
+                <h4 class="font-semibold sm:text-lg">Fast start</h4>
+
+                <info-dropdown
+                  class="grow"
+                  classes="max-w-[11rem] min-[420px]:max-w-[20rem]"
+                  .content=${html`
+                    <h4 class="font-bold">Fast start</h4>
+                    <span class="text-sm">
+                      Stays ready after stopping, so that starting again is
+                      instant. Uses more battery. Not available in Lite.
+                    </span>
+                  `}
+                  grow
+                ></info-dropdown>
+
+                <input
+                  class="checkbox mr-2"
+                  type="checkbox"
+                  name="standby"
+                  @change=${this.#changeStandby}
+                  .checked=${this.standby}
+                />
+              </div>
+
               <div class="flex h-12 items-center">
                 <h4 class="font-semibold sm:text-lg">Sync time</h4>
 
@@ -114,6 +262,47 @@ export class AdvancedSettings extends BaseElement {
                   .checked=${this.sync}
                 />
               </div>
+
+              <div class="flex h-12 items-center">
+                <h4 class="font-semibold sm:text-lg">Schedule</h4>
+
+                <info-dropdown
+                  class="grow"
+                  classes="max-w-[7rem] min-[420px]:max-w-[16rem]"
+                  .content=${html`
+                    <h4 class="font-bold">Schedule</h4>
+                    <span class="text-sm">
+                      Transmits every day from the first time until the
+                      second, while this page stays open. Uses no battery in
+                      between.
+                    </span>
+                  `}
+                  grow
+                ></info-dropdown>
+
+                <input
+                  class="input input-sm input-bordered mr-1 w-24 px-1"
+                  type="time"
+                  name="schedule-start"
+                  @change=${this.#changeScheduleStart}
+                  .value=${formatMinutes(this.scheduleStart)}
+                />
+                <input
+                  class="input input-sm input-bordered mr-2 w-24 px-1"
+                  type="time"
+                  name="schedule-end"
+                  @change=${this.#changeScheduleEnd}
+                  .value=${formatMinutes(this.scheduleEnd)}
+                />
+
+                <input
+                  class="checkbox mr-2"
+                  type="checkbox"
+                  name="schedule"
+                  @change=${this.#changeSchedule}
+                  .checked=${this.schedule}
+                />
+              </div>
             </div>
           `}
         ></collapse-setting>
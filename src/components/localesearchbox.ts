@@ -19,6 +19,9 @@ import {
   supportedLocales,
 } from "@shared/locales";
 
+/* Only the best matches are worth scrolling through. */
+const kMaxSuggestions = 30 as const;
+
 @customElement("locale-searchbox")
 export class LocaleSearchbox extends BaseElement {
   @state()
@@ -91,6 +94,7 @@ export class LocaleSearchbox extends BaseElement {
   };
 
   #closeSuggestions() {
+    LocaleEditDistance.cancelQueries();
     this.suggestions.enabledItems = [];
     this.#isSuggestionsMousedown = false;
   }
@@ -105,11 +109,20 @@ export class LocaleSearchbox extends BaseElement {
     `;
   };
 
-  #runQuery(text: string) {
+  async #runQuery(text: string) {
     const searchQuery = text.slice(0, maxLocaleNameCodeUnits);
     if (this.suggestions.items.length === 0)
       this.suggestions.items = supportedLocales;
-    this.suggestions.enabledItems = LocaleEditDistance.runQuery(searchQuery);
+
+    let locales: string[] | undefined | null;
+    try {
+      locales = await LocaleEditDistance.runQuery(searchQuery, kMaxSuggestions);
+    } catch {
+      locales = undefined; /* Search failed to load: list every locale. */
+    }
+    if (locales === null) return; /* A later keystroke superseded it. */
+
+    this.suggestions.enabledItems = locales;
     this.requestUpdate();
   }
 
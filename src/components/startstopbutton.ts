@@ -2,11 +2,7 @@ import { html } from "lit";
 import { customElement, query, state } from "lit/decorators.js";
 import { classMap } from "lit/directives/class-map.js";
 
-import AppSettings, {
-  Station,
-  knownJjyKhz,
-  knownStations,
-} from "@shared/appsettings";
+import AppSettings, { Station } from "@shared/appsettings";
 import BaseElement, { registerEventHandler } from "@shared/element";
 import {
   ReadyBusyEvent,
@@ -14,7 +10,7 @@ import {
   TimeSignalStateChangeEvent,
 } from "@shared/events";
 import { svgIcons } from "@shared/icons";
-import RadioTimeSignal from "@shared/radiotimesignal";
+import RadioTimeSignal, { getSettingsParams } from "@shared/radiotimesignal";
 
 const kStartStopButtonText = {
   stopped: "Start",
@@ -38,6 +34,7 @@ export class StartStopButton extends BaseElement {
   get #state(): StartStopButtonState {
     switch (RadioTimeSignal.state) {
       case "idle":
+      case "standby":
         return "stopped";
 
       case "startup":
@@ -73,13 +70,7 @@ export class StartStopButton extends BaseElement {
   #start() {
     if (AppSettings.get("nanny")) this.showModal();
 
-    RadioTimeSignal.start({
-      stationIndex: knownStations.indexOf(AppSettings.get("station")),
-      jjyKhzIndex: knownJjyKhz.indexOf(AppSettings.get("jjyKhz")),
-      offset: AppSettings.get("offset") + this.#serverOffset,
-      dut1: AppSettings.get("dut1"),
-      noclip: AppSettings.get("noclip"),
-    });
+    RadioTimeSignal.start(getSettingsParams(this.#serverOffset));
   }
 
   #stop() {
@@ -7,9 +7,10 @@ import {
   ReadyBusyEvent,
   TimeSignalReadyEvent,
   TimeSignalStateChangeEvent,
+  TimeSignalStatsEvent,
   VisualizerIconEvent,
 } from "@shared/events";
-import { TimeSignalState } from "@shared/radiotimesignal";
+import { TimeSignalState, TimeSignalStats } from "@shared/radiotimesignal";
 
 /* ionicons v5.0.0: https://ionic.io/ionicons */
 const kSvgFragments = {
@@ -52,6 +53,9 @@ export class VisualizerIcon extends BaseElement {
   @state()
   private accessor started = false;
 
+  @state()
+  private accessor stats: TimeSignalStats | undefined;
+
   @query("visualizer-icon canvas", true)
   private accessor canvas!: HTMLCanvasElement;
 
@@ -97,6 +101,11 @@ export class VisualizerIcon extends BaseElement {
     if (newState === "idle") this.#stop();
   }
 
+  @registerEventHandler(TimeSignalStatsEvent)
+  handleTimeSignalStats(stats: TimeSignalStats) {
+    this.stats = stats;
+  }
+
   @registerEventHandler(TimeSignalReadyEvent)
   handleTimeSignalReady() {
     this.publish(VisualizerIconEvent, this.canvas);
@@ -130,6 +139,34 @@ export class VisualizerIcon extends BaseElement {
     `;
   }
 
+  #makeTitle(): string {
+    if (this.stats == null) return "";
+
+    const {
+      aheadMs,
+      latencyMs,
+      ppm,
+      resyncs,
+      startMs,
+      subharmonic,
+      underflows,
+    } = this.stats;
+    const sign = ppm < 0 ? "" : "+";
+    const ordinal = subharmonic === 3 ? "3rd" : `${subharmonic}th`;
+    const synthesis = subharmonic > 1 ? `${ordinal} subharmonic` : "direct";
+    const lines = [
+      `Synthesis: ${synthesis}`,
+      `Sample clock correction: ${sign}${ppm.toFixed(1)} ppm`,
+      `Output latency: ${latencyMs.toFixed(1)} ms`,
+      `Resyncs after dropouts: ${resyncs}`,
+    ];
+    if (aheadMs != null) lines.push(`Rendered ahead: ${aheadMs.toFixed(1)} ms`);
+    if (underflows != null) lines.push(`Underflows: ${underflows}`);
+    if (startMs != null)
+      lines.push(`Time to first sample: ${startMs.toFixed(1)} ms`);
+    return lines.join("\n");
+  }
+
   protected render() {
     const animate = classMap({ "animate-pulse": this.pulse });
 
@@ -146,7 +183,10 @@ export class VisualizerIcon extends BaseElement {
         </span>
       </div>
 
-      <canvas class="${showOnVisualize} h-36 w-full sm:h-48"></canvas>
+      <canvas
+        class="${showOnVisualize} h-36 w-full sm:h-48"
+        title="${this.#makeTitle()}"
+      ></canvas>
     `;
   }
 }
@@ -10,6 +10,10 @@ const kJjyKhz = [40, 60] as const;
 export type JjyKhz = (typeof kJjyKhz)[number];
 export const knownJjyKhz: readonly JjyKhz[] = [...kJjyKhz] as const;
 
+const kEngines = ["worklet", "pipeline", "automation"] as const;
+export type Engine = (typeof kEngines)[number];
+export const knownEngines: readonly Engine[] = [...kEngines] as const;
+
 const kAppSettings = [
   "station",
   "locale",
@@ -17,6 +21,11 @@ const kAppSettings = [
   "offset",
   "dut1",
   "noclip",
+  "engine",
+  "standby",
+  "schedule",
+  "scheduleStart",
+  "scheduleEnd",
   "sync",
   "dark",
   "nanny",
@@ -33,6 +42,11 @@ const kValidators: Record<AppSetting, (x: any) => boolean> = {
   offset: (x: any) => Number.isSafeInteger(x) && x > -86400000 && x < 86400000,
   dut1: (x: any) => Number.isSafeInteger(x) && x > -1000 && x < 1000,
   noclip: (x: any) => typeof x === "boolean",
+  engine: (x: any) => knownEngines.includes(x),
+  standby: (x: any) => typeof x === "boolean",
+  schedule: (x: any) => typeof x === "boolean",
+  scheduleStart: (x: any) => Number.isSafeInteger(x) && x >= 0 && x < 1440,
+  scheduleEnd: (x: any) => Number.isSafeInteger(x) && x >= 0 && x < 1440,
   sync: (x: any) => typeof x === "boolean",
   dark: (x: any) => typeof x === "boolean",
   nanny: (x: any) => typeof x === "boolean",
@@ -45,6 +59,11 @@ export type AppSettingType = {
   offset: number;
   dut1: number;
   noclip: boolean;
+  engine: Engine;
+  standby: boolean;
+  schedule: boolean;
+  scheduleStart: number;
+  scheduleEnd: number;
   sync: boolean;
   dark: boolean;
   nanny: boolean;
@@ -57,6 +76,11 @@ export const defaultAppSettings: AppSettingType = {
   offset: 0,
   dut1: 0,
   noclip: true,
+  engine: "worklet",
+  standby: false,
+  schedule: false,
+  scheduleStart: 120,
+  scheduleEnd: 180,
   sync: true,
   dark: window.matchMedia?.("(prefers-color-scheme: dark").matches ?? false,
   nanny: true,
@@ -68,10 +92,12 @@ function convertStoredValue<T extends AppSetting>(
 ): AppSettingType[T] | undefined {
   let converted: any;
   if (value != null) {
-    if (setting === "station" || setting === "locale") {
+    if (["station", "locale", "engine"].includes(setting)) {
       converted = value;
     } else if (
-      ["noclip", "sync", "dark", "nanny"].includes(setting) &&
+      ["noclip", "standby", "schedule", "sync", "dark", "nanny"].includes(
+        setting,
+      ) &&
       (value === "true" || value === "false")
     ) {
       converted = value === "true";
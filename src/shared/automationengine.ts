@@ -0,0 +1,231 @@
+import monotonicTime from "@shared/time";
+
+/** Wasm functions that compute the schedule, in the main thread. */
+export interface AutomationModule {
+  _tsig_sched_load_params(
+    offset: number,
+    stationIndex: number,
+    jjyKhzIndex: number,
+    dut1: number,
+    sampleRate: number,
+  ): void;
+
+  _tsig_sched_get_hz(): number;
+
+  _tsig_sched_get_subharmonic(): number;
+
+  _tsig_sched_get_scale(): number;
+
+  _tsig_sched_minute(timestamp: number): number;
+
+  _tsig_sched_next_minute(): number;
+
+  _tsig_sched_edge_ms(i: number): number;
+
+  _tsig_sched_edge_gain(i: number): number;
+}
+
+export type AutomationParams = {
+  stationIndex: number;
+  jjyKhzIndex: number;
+  offset: number;
+  dut1: number;
+  noclip: boolean;
+};
+
+/* Same fade length and gain interpolation rate as the Audio Worklet. */
+export const kFadeMs = 35 as const;
+const kFadeSteps = 64 as const;
+const kLerpRate = 0.015 as const;
+
+/* Schedule a minute ahead, topping up every few seconds. */
+const kAheadMs = 60000 as const;
+const kTopUpMs = 5000 as const;
+
+/* Points in the quantization curve, short of which steps get more of them. */
+const kMaxCurveLen = 65537 as const;
+
+/**
+ * Make a WaveShaperNode curve that quantizes like the Audio Worklet does,
+ * i.e. as trunc(x * scale) / scale.
+ * @param scale Scale factor for emulated quantization.
+ * @returns Curve with steep enough steps between its evenly spaced points.
+ */
+export function makeQuantizerCurve(scale: number) {
+  const pointsPerStep = Math.max(
+    1,
+    Math.trunc((kMaxCurveLen - 1) / (2 * scale)),
+  );
+  const curve = new Float32Array(2 * scale * pointsPerStep + 1);
+
+  for (let i = 0; i < curve.length; i++) {
+    const steps = (i - scale * pointsPerStep) / pointsPerStep;
+    curve[i] = Math.trunc(steps) / scale;
+  }
+
+  return curve;
+}
+
+function makeFadeCurve(fadeIn: boolean) {
+  const curve = new Float32Array(kFadeSteps + 1);
+
+  for (let i = 0; i <= kFadeSteps; i++) {
+    const x = (fadeIn ? i : kFadeSteps - i) / kFadeSteps;
+    curve[i] = x * x;
+  }
+
+  return curve;
+}
+
+/**
+ * Renders the time signal with native Web Audio nodes instead of the Audio
+ * Worklet: an OscillatorNode at the subharmonic is keyed by a GainNode with
+ * automation scheduled ahead a minute at a time, and quantized by a
+ * WaveShaperNode to put energy on the target frequency. Wasm only computes
+ * each minute's edges.
+ *
+ * Unlike the Audio Worklet, this does not correct for sample clock error,
+ * follows output latency changes only as it tops up its schedule, and does
+ * not spread DCF77's carrier with phase chips.
+ */
+export default class AutomationEngine {
+  #module: AutomationModule;
+
+  #audioContext: BaseAudioContext;
+
+  #destination: AudioNode;
+
+  #getLatencyMs: () => number;
+
+  #oscillator?: OscillatorNode;
+
+  #keyer?: GainNode;
+
+  #fader?: GainNode;
+
+  #quantizer?: WaveShaperNode;
+
+  #noclip = true;
+
+  /** Context time at which fading in ends. */
+  #fadeInEndTime = 0;
+
+  /** Local timestamp up to which automation has been scheduled. */
+  #scheduledMs = 0;
+
+  #topUpIntervalId?: ReturnType<typeof setInterval>;
+
+  constructor(
+    module: AutomationModule,
+    audioContext: BaseAudioContext,
+    destination: AudioNode,
+    getLatencyMs: () => number,
+  ) {
+    this.#module = module;
+    this.#audioContext = audioContext;
+    this.#destination = destination;
+    this.#getLatencyMs = getLatencyMs;
+  }
+
+  get isRunning() {
+    return this.#oscillator != null;
+  }
+
+  start(params: AutomationParams) {
+    if (this.isRunning) return;
+
+    const { dut1, jjyKhzIndex, noclip, offset, stationIndex } = params;
+    const ctx = this.#audioContext;
+    const now = ctx.currentTime;
+
+    this.#module._tsig_sched_load_params(
+      offset,
+      stationIndex,
+      jjyKhzIndex,
+      dut1,
+      ctx.sampleRate,
+    );
+    this.#noclip = noclip;
+
+    const frequency = this.#module._tsig_sched_get_hz();
+    const curve = makeQuantizerCurve(this.#module._tsig_sched_get_scale());
+    this.#oscillator = new OscillatorNode(ctx, { frequency });
+    this.#keyer = new GainNode(ctx, { gain: 0 });
+    this.#fader = new GainNode(ctx, { gain: 0 });
+    this.#quantizer = new WaveShaperNode(ctx, { curve, oversample: "none" });
+
+    this.#oscillator
+      .connect(this.#keyer)
+      .connect(this.#fader)
+      .connect(this.#quantizer)
+      .connect(this.#destination);
+
+    const fadeIn = makeFadeCurve(true);
+    this.#fader.gain.setValueCurveAtTime(fadeIn, now, kFadeMs / 1000);
+    this.#fadeInEndTime = now + kFadeMs / 1000;
+    this.#oscillator.start(now);
+
+    this.#scheduledMs = monotonicTime();
+    this.#schedule(this.#module._tsig_sched_minute(this.#scheduledMs));
+    this.#topUp();
+    this.#topUpIntervalId = setInterval(this.#topUp, kTopUpMs);
+  }
+
+  stop() {
+    if (!this.isRunning) return;
+
+    const oscillator = this.#oscillator!;
+    const nodes = [oscillator, this.#keyer!, this.#fader!, this.#quantizer!];
+    const { gain } = this.#fader!;
+
+    /* Value curves must not overlap, so let any fade in finish first. */
+    const { currentTime } = this.#audioContext;
+    const time = Math.max(currentTime, this.#fadeInEndTime);
+
+    clearInterval(this.#topUpIntervalId);
+    this.#oscillator = undefined;
+
+    gain.setValueCurveAtTime(makeFadeCurve(false), time, kFadeMs / 1000);
+    oscillator.onended = () => nodes.forEach((node) => node.disconnect());
+    oscillator.stop(time + kFadeMs / 1000);
+  }
+
+  #topUp = () => {
+    const aheadMs = monotonicTime() + kAheadMs;
+    while (this.#scheduledMs < aheadMs)
+      this.#schedule(this.#module._tsig_sched_next_minute());
+  };
+
+  /**
+   * Schedule the edges of the minute last computed by Wasm, from where the
+   * schedule so far ends to the end of the minute.
+   * @param len Count of edges in the minute.
+   */
+  #schedule(len: number) {
+    const { currentTime } = this.#audioContext;
+    const nowMs = monotonicTime();
+    const latencyMs = this.#getLatencyMs();
+    /* Audio rendered now is heard after the output latency. */
+    const toContextTime = (ms: number) =>
+      Math.max(currentTime + (ms - nowMs - latencyMs) / 1000, currentTime);
+    const { gain } = this.#keyer!;
+    const timeConstant =
+      -1 / (this.#audioContext.sampleRate * Math.log(1 - kLerpRate));
+
+    for (let i = 0; i < len; i++) {
+      const nextMs = this.#module._tsig_sched_edge_ms(i + 1);
+      if (nextMs > this.#scheduledMs) {
+        /* The edge in effect where the schedule so far ends, or a later one. */
+        const edgeMs = this.#module._tsig_sched_edge_ms(i);
+        const ms = Math.max(edgeMs, this.#scheduledMs);
+        const value = this.#module._tsig_sched_edge_gain(i);
+        const time = toContextTime(ms);
+
+        if (this.#noclip) gain.setTargetAtTime(value, time, timeConstant);
+        else gain.setValueAtTime(value, time);
+      }
+    }
+
+    this.#scheduledMs = this.#module._tsig_sched_edge_ms(len);
+  }
+}
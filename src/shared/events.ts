@@ -9,5 +9,6 @@ export const SettingsEvent = "Settings" as const;
 export const SettingsReadyEvent = "SettingsReady" as const;
 export const TimeSignalReadyEvent = "TimeSignalReady" as const;
 export const TimeSignalStateChangeEvent = "TimeSignalStateChange" as const;
+export const TimeSignalStatsEvent = "TimeSignalStats" as const;
 export const ToastEvent = "ToastManager" as const;
 export const VisualizerIconEvent = "VisualizerIcon" as const;
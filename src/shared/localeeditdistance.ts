@@ -1,131 +1,189 @@
 import EventBus from "@shared/eventbus";
 import { EditDistanceReadyEvent } from "@shared/events";
-import {
-  knownLocales,
-  sortLocales,
-  supportedLocales,
-  supportedScripts,
-} from "@shared/locales";
-import { findScriptsInString, foldUnicodeString } from "@shared/strings";
-
-import createEditDistanceModule from "../../wasm/editdistance.js";
-
-interface EditDistanceModule extends EmscriptenModule {
-  _edist_get_buf_ptr(): number;
-  _edist_reset(): void;
-  _edist_load_locale(nameLen: number, descLen: number): void;
-  _edist_run_query(len: number): number;
-}
+import { knownLocales, supportedLocales } from "@shared/locales";
+
+export type EditDistanceLocales = {
+  locales: [tag: string, name: string][];
+};
+
+export type EditDistanceQuery = {
+  id: number;
+  query: string;
+  k: number;
+};
+
+/*
+ * Locales ranked for a query, or none for id 0 once they are loaded. An error
+ * is set if the module failed to load.
+ */
+export type EditDistanceResult = {
+  id: number;
+  ranked: string[];
+  searchMs: number;
+  error?: string;
+};
+
+type PendingQuery = EditDistanceQuery & {
+  startMs: number;
+  blockingMs: number;
+  resolve: (locales: string[] | undefined | null) => void;
+  reject: (reason: Error) => void;
+};
 
 /* eslint-disable no-control-regex */
 const kAsciiUnwantedRe = /[\x00-\x2f\x3a-\x40\x5b-\x60\x7b-\x7f]/g;
 
-const kFoldedLocales = Object.fromEntries(
-  supportedLocales.map((tag) => {
-    const desc = knownLocales[tag][0];
-    const foldedStrings = [tag, desc].map(foldUnicodeString);
-    return [tag, foldedStrings];
-  }),
-);
-
-function filterCandLocalesExact(candLocales: string[], foldedQuery: string) {
-  return candLocales.filter((tag) => {
-    const [foldedTag, foldedName] = kFoldedLocales[tag];
-    return foldedTag.includes(foldedQuery) || foldedName.includes(foldedQuery);
-  });
-}
-
-function findCandLocales(query: string, foldedQuery: string): string[] {
-  /* No results for ASCII garbage and whitespace ([^0-9A-Za-z] && < 0x80). */
-  const cleanedQuery = query.replaceAll(kAsciiUnwantedRe, "");
-  if (cleanedQuery.length === 0) return [];
-
-  const exactMatches = filterCandLocalesExact(supportedLocales, foldedQuery);
-  if (exactMatches.length > 0) return exactMatches;
+/* Name of the performance measure of every query with results delivered. */
+export const kLocaleSearchMeasure = "locale-search" as const;
 
-  const scripts = findScriptsInString(query);
-  if (scripts.length === 0) return [];
-
-  let minLocaleCount = Infinity;
-  scripts.forEach((script) => {
-    const scriptLocales = supportedScripts[script]!;
-    minLocaleCount = Math.min(minLocaleCount, scriptLocales.length);
-  });
-
-  const candLocaleSet = new Set<string>();
-  scripts.forEach((script) => {
-    const scriptLocales = supportedScripts[script]!;
-    if (scriptLocales.length === minLocaleCount)
-      scriptLocales.forEach((tag) => candLocaleSet.add(tag));
-  });
+class LocaleEditDistance {
+  static #instance: LocaleEditDistance;
 
-  return [...candLocaleSet];
-}
+  #worker: Worker;
 
-function stringToBuf(str: string) {
-  const u16Array = new Uint16Array(str.length);
-  for (let i = 0; i < str.length; i++) u16Array[i] = str.charCodeAt(i);
-  return u16Array.buffer;
-}
+  #lastId = 0;
 
-class LocaleEditDistance {
-  static #instance: LocaleEditDistance;
+  #inFlight?: PendingQuery;
 
-  #module!: EditDistanceModule;
+  #pending?: PendingQuery;
 
-  #buf!: number;
+  /* Why the worker could not search, once it has failed to load. */
+  #error?: Error;
 
   constructor() {
     if (LocaleEditDistance.#instance != null)
       throw new Error("LocaleEditDistance is a singleton class.");
-    createEditDistanceModule().then(this.#init);
+
+    this.#worker = new Worker(
+      new URL("@shared/localeeditdistanceworker.ts", import.meta.url),
+      { type: "module" },
+    );
+    this.#worker.addEventListener("message", this.#handleWorkerMessage);
+
+    const init: EditDistanceLocales = {
+      locales: supportedLocales.map((tag) => [tag, knownLocales[tag][0]]),
+    };
+    this.#worker.postMessage(init);
+
     LocaleEditDistance.#instance = this;
   }
 
-  #init = (module: EditDistanceModule) => {
-    this.#module = module;
-    this.#buf = module._edist_get_buf_ptr();
-    EventBus.publish(EditDistanceReadyEvent);
+  #handleWorkerMessage = (event: MessageEvent) => {
+    const handlerStartMs = performance.now();
+    const { id, ranked, searchMs, error } = event.data as EditDistanceResult;
+
+    /* Loading is over even if it failed, and searches then fail too. */
+    if (id === 0) {
+      if (error != null) {
+        console.error(`Failed to load locale search: ${error}`);
+        this.#error = new Error(error);
+        this.#pending?.reject(this.#error);
+        this.#pending = undefined;
+      }
+      EventBus.publish(EditDistanceReadyEvent);
+      return;
+    }
+
+    const done = this.#inFlight!;
+    this.#inFlight = undefined;
+    this.#send();
+
+    if (error != null) {
+      done.reject(new Error(error));
+      return;
+    }
+
+    /* Superseded while in flight. */
+    if (id !== this.#lastId) {
+      done.resolve(null);
+      return;
+    }
+
+    done.resolve(ranked.length > 0 ? ranked : undefined);
+
+    const endMs = performance.now();
+    performance.measure(kLocaleSearchMeasure, {
+      start: done.startMs,
+      end: endMs,
+      detail: {
+        searchMs,
+        blockingMs: done.blockingMs + endMs - handlerStartMs,
+      },
+    });
   };
 
-  #packBuf(...buffers: ArrayBuffer[]) {
-    let offset = 0;
-    buffers.forEach((buffer) => {
-      this.#module.HEAPU8.set(new Uint8Array(buffer), this.#buf + offset);
-      offset += buffer.byteLength;
-    });
-    return offset;
+  #send() {
+    if (this.#inFlight != null || this.#pending == null) return;
+
+    const { id, query, k } = this.#pending;
+    const message: EditDistanceQuery = { id, query, k };
+    this.#worker.postMessage(message);
+
+    this.#inFlight = this.#pending;
+    this.#pending = undefined;
   }
 
-  runQuery(query: string) {
-    const trimmedQuery = query.trim();
-    const foldedQuery = foldUnicodeString(trimmedQuery);
-    const candLocales = findCandLocales(trimmedQuery, foldedQuery);
-    const count = candLocales.length;
+  /**
+   * Cancel every query not yet delivered, as when the search box is cleared.
+   * Each resolves to null.
+   */
+  cancelQueries() {
+    this.#lastId++;
+    this.#pending?.resolve(null);
+    this.#pending = undefined;
+  }
 
-    if (count === 0) return undefined;
+  /**
+   * Find the locales that best match a query, off the main thread.
+   *
+   * At most one query is searched at a time. A query made while another is
+   * searched waits for it, unless a later one replaces it first, and only
+   * the results of the last query made are delivered, so that typing fast
+   * never queues up searches that no one will see. Each delivery is recorded
+   * as a performance measure named `kLocaleSearchMeasure`, spanning the input
+   * to its results, with the time spent searching and blocking the main
+   * thread as its detail.
+   *
+   * @param query Query string.
+   * @param limit Most locales to return, or all candidates if undefined.
+   * @returns Promise of locales ordered by edit distance, ties by
+   *  sortLocales(), or undefined if no locale could match, or null if a later
+   *  query or cancelQueries() superseded this one. It rejects if the worker
+   *  failed to load.
+   */
+  runQuery(
+    query: string,
+    limit?: number,
+  ): Promise<string[] | undefined | null> {
+    const startMs = performance.now();
+    this.cancelQueries();
 
-    this.#module._edist_reset();
-    candLocales.forEach((locale) => {
-      const [tag, name] = kFoldedLocales[locale];
-      this.#packBuf(stringToBuf(tag), stringToBuf(name));
-      this.#module._edist_load_locale(tag.length, name.length);
-    });
+    const trimmedQuery = query.trim();
 
-    const buffer = stringToBuf(foldedQuery);
-    this.#packBuf(buffer);
-    this.#module._edist_run_query(foldedQuery.length);
+    /* No results for ASCII garbage and whitespace ([^0-9A-Za-z] && < 0x80). */
+    const cleanedQuery = trimmedQuery.replaceAll(kAsciiUnwantedRe, "");
+    if (cleanedQuery.length === 0) return Promise.resolve(undefined);
+    if (this.#error != null) return Promise.reject(this.#error);
 
-    const queryResult = this.#module.HEAPU8.slice(this.#buf, this.#buf + count);
-    const scoreMap = Object.fromEntries(
-      candLocales.map((name, i) => [name, queryResult[i]]),
+    const k = Math.min(
+      limit ?? supportedLocales.length,
+      supportedLocales.length,
     );
 
-    return candLocales.sort((a, b) =>
-      scoreMap[a] < scoreMap[b] ? -1
-      : scoreMap[a] > scoreMap[b] ? 1
-      : sortLocales(a, b),
-    );
+    return new Promise((resolve, reject) => {
+      const pending: PendingQuery = {
+        id: this.#lastId,
+        query: trimmedQuery,
+        k,
+        startMs,
+        blockingMs: 0,
+        resolve,
+        reject,
+      };
+      this.#pending = pending;
+      this.#send();
+      pending.blockingMs = performance.now() - startMs;
+    });
   }
 }
 
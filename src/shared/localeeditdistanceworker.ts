@@ -0,0 +1,130 @@
+/* eslint-disable no-restricted-globals */
+
+import {
+  EditDistanceLocales,
+  EditDistanceQuery,
+  EditDistanceResult,
+} from "@shared/localeeditdistance";
+import localeTable from "@shared/localetable";
+
+import createEditDistanceModule from "../../wasm/editdistance.js";
+
+interface EditDistanceModule extends EmscriptenModule {
+  _edist_get_buf_ptr(): number;
+  _edist_reset(): void;
+  _edist_add_locale(index: number): number;
+  _edist_load_locale(tagLen: number, nameLen: number): number;
+  _edist_search(len: number, k: number): number;
+}
+
+/* Most code units of a query that the Wasm buffer holds. */
+const kMaxQueryCodeUnits = 128 as const;
+
+const kTableIndices = new Map(localeTable.map((tag, i) => [tag, i]));
+
+const ctx: Worker = self as any;
+
+function writeString(heap: Uint8Array, offset: number, str: string) {
+  const u16Array = new Uint16Array(heap.buffer, offset, str.length);
+  for (let i = 0; i < str.length; i++) u16Array[i] = str.charCodeAt(i);
+  return offset + 2 * str.length;
+}
+
+class LocaleEditDistanceWorker {
+  #module: EditDistanceModule;
+
+  #buf: number;
+
+  /* Tags by the numbers the module assigned them. */
+  #tags: string[] = [];
+
+  constructor(module: EditDistanceModule, locales: [string, string][]) {
+    this.#module = module;
+    this.#buf = module._edist_get_buf_ptr();
+
+    /*
+     * Known locales are folded at build time, others by the module now. A
+     * locale too long or too many is left out, and never found.
+     */
+    module._edist_reset();
+    locales.forEach(([tag, name]) => {
+      const index = kTableIndices.get(tag);
+      let number: number;
+      if (index != null) {
+        number = module._edist_add_locale(index);
+      } else {
+        const offset = writeString(module.HEAPU8, this.#buf, tag);
+        writeString(module.HEAPU8, offset, name);
+        number = module._edist_load_locale(tag.length, name.length);
+      }
+
+      if (number >= 0) this.#tags[number] = tag;
+      else console.error(`Failed to load locale ${tag} for search.`);
+    });
+  }
+
+  runQuery(query: string, k: number) {
+    /*
+     * The module folds the query and finds the locales in its scripts. A
+     * surrogate pair the buffer would split is left out whole.
+     */
+    let heapQuery = query.slice(0, kMaxQueryCodeUnits);
+    const last = heapQuery.charCodeAt(heapQuery.length - 1);
+    if (last >= 0xd800 && last <= 0xdbff) heapQuery = heapQuery.slice(0, -1);
+    const heap = this.#module.HEAPU8;
+    writeString(heap, this.#buf, heapQuery);
+
+    const count = this.#module._edist_search(heapQuery.length, k);
+    const ranked = new Uint16Array(heap.buffer, this.#buf, count);
+    return Array.from(ranked, (number) => this.#tags[number]);
+  }
+}
+
+let editDistance: Promise<LocaleEditDistanceWorker> | undefined;
+
+async function handleMessage(event: MessageEvent) {
+  if (editDistance == null) {
+    const { locales } = event.data as EditDistanceLocales;
+    editDistance = createEditDistanceModule().then(
+      (module: EditDistanceModule) =>
+        new LocaleEditDistanceWorker(module, locales),
+    );
+
+    const ready: EditDistanceResult = { id: 0, ranked: [], searchMs: 0 };
+    try {
+      await editDistance;
+    } catch (error) {
+      ready.error = String(error);
+    }
+    ctx.postMessage(ready);
+    return;
+  }
+
+  /*
+   * Queries that arrive while the module loads wait for it, in order, and
+   * fail with it.
+   */
+  const { id, query, k } = event.data as EditDistanceQuery;
+  let worker: LocaleEditDistanceWorker;
+  try {
+    worker = await editDistance;
+  } catch (error) {
+    const failed: EditDistanceResult = {
+      id,
+      ranked: [],
+      searchMs: 0,
+      error: String(error),
+    };
+    ctx.postMessage(failed);
+    return;
+  }
+
+  const startMs = performance.now();
+  const ranked = worker.runQuery(query, k);
+  const searchMs = performance.now() - startMs;
+
+  const result: EditDistanceResult = { id, ranked, searchMs };
+  ctx.postMessage(result);
+}
+
+ctx.addEventListener("message", handleMessage);
@@ -1,9 +1,3 @@
-import {
-  UnicodeScript,
-  findScriptsInString,
-  foldUnicodeString,
-} from "@shared/strings";
-
 type LocaleData = [description: string, amMarker: string, pmMarker: string];
 
 const kFallbackDefaultLocale = "en-US";
@@ -211,17 +205,26 @@ export const maxLocaleTagCodeUnits = 12 as const;
 
 export const maxLocaleNameCodeUnits = 40 as const;
 
+/*
+ * Most code points a string can fold to in the edit distance module: Hangul
+ * syllables decompose into jamo, and case folding expands a code point no
+ * more than uppercasing does.
+ */
+function maxFoldedLength(str: string) {
+  return [...str.toUpperCase().normalize("NFD")].length;
+}
+
 export const defaultLocale = (() => {
   const { locale } = new Intl.DateTimeFormat().resolvedOptions();
   if (knownLocales[locale] != null) return locale;
 
-  if (foldUnicodeString(locale).length > maxLocaleTagCodeUnits)
+  if (locale.length > maxLocaleTagCodeUnits)
     return kFallbackDefaultLocale;
 
   const name = new Intl.DisplayNames([locale], {
     type: "language",
   }).of(locale);
-  if (name == null || foldUnicodeString(name).length > maxLocaleNameCodeUnits)
+  if (name == null || maxFoldedLength(name) > maxLocaleNameCodeUnits)
     return kFallbackDefaultLocale;
 
   knownLocales[locale] = [name, "", ""]; /* Assume h23. */
@@ -231,8 +234,6 @@ export const defaultLocale = (() => {
 
 export const supportedLocales: string[] = [];
 
-export const supportedScripts: Partial<Record<UnicodeScript, string[]>> = {};
-
 export function sortLocales(a: string, b: string) {
   /* eslint-disable prefer-const */
   let [aLanguage, aScript, aRegion] = a.split("-");
@@ -254,19 +255,5 @@ export function sortLocales(a: string, b: string) {
   const knownTags = Object.keys(knownLocales);
   const tags = Intl.DateTimeFormat.supportedLocalesOf(knownTags);
 
-  tags.sort(sortLocales).forEach((locale) => {
-    const description = knownLocales[locale][0];
-    const scripts = findScriptsInString(description);
-    scripts.forEach((script) => {
-      if (supportedScripts[script] == null) supportedScripts[script] = [];
-      supportedScripts[script]!.push(locale);
-    });
-    supportedLocales.push(locale);
-  });
-
-  if (supportedLocales.includes("ja-JP")) {
-    const jaJp = ["ja-JP"];
-    supportedScripts.hiragana = jaJp;
-    supportedScripts.katakana = jaJp;
-  }
+  supportedLocales.push(...tags.sort(sortLocales));
 })();
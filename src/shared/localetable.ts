@@ -0,0 +1,200 @@
+/* Generated by scripts/localetable.py */
+const localeTable: readonly string[] = [
+  "af-ZA",
+  "am-ET",
+  "ar-AE",
+  "ar-BH",
+  "ar-DZ",
+  "ar-EG",
+  "ar-IQ",
+  "ar-JO",
+  "ar-KW",
+  "ar-LB",
+  "ar-LY",
+  "ar-MA",
+  "ar-OM",
+  "ar-QA",
+  "ar-SA",
+  "ar-SD",
+  "ar-SY",
+  "ar-TN",
+  "ar-YE",
+  "as-IN",
+  "az-AZ",
+  "az-Cyrl-AZ",
+  "be-BY",
+  "bg-BG",
+  "bn-BD",
+  "bn-IN",
+  "bo-CN",
+  "br-FR",
+  "bs-BA",
+  "bs-Cyrl-BA",
+  "ca-ES",
+  "cs-CZ",
+  "cy-GB",
+  "da-DK",
+  "de-AT",
+  "de-CH",
+  "de-DE",
+  "de-LI",
+  "de-LU",
+  "dsb-DE",
+  "el-CY",
+  "el-GR",
+  "en-029",
+  "en-AU",
+  "en-BZ",
+  "en-CA",
+  "en-GB",
+  "en-IE",
+  "en-IN",
+  "en-JM",
+  "en-MT",
+  "en-MY",
+  "en-NZ",
+  "en-PH",
+  "en-SG",
+  "en-TT",
+  "en-US",
+  "en-ZA",
+  "en-ZW",
+  "es-AR",
+  "es-BO",
+  "es-CL",
+  "es-CO",
+  "es-CR",
+  "es-DO",
+  "es-EC",
+  "es-ES",
+  "es-GT",
+  "es-HN",
+  "es-MX",
+  "es-NI",
+  "es-PA",
+  "es-PE",
+  "es-PR",
+  "es-PY",
+  "es-SV",
+  "es-US",
+  "es-UY",
+  "es-VE",
+  "et-EE",
+  "eu-ES",
+  "fa-AF",
+  "fa-IR",
+  "fi-FI",
+  "fil-PH",
+  "fo-FO",
+  "fr-BE",
+  "fr-CA",
+  "fr-CH",
+  "fr-FR",
+  "fr-LU",
+  "fr-MC",
+  "fy-NL",
+  "ga-IE",
+  "gd-GB",
+  "gd-IE",
+  "gl-ES",
+  "gsw-FR",
+  "gu-IN",
+  "ha-Latn-NG",
+  "he-IL",
+  "hi-IN",
+  "hr-BA",
+  "hr-HR",
+  "hsb-DE",
+  "hu-HU",
+  "hy-AM",
+  "id-ID",
+  "ig-NG",
+  "ii-CN",
+  "is-IS",
+  "it-CH",
+  "it-IT",
+  "ja-JP",
+  "ka-GE",
+  "kk-KZ",
+  "kl-GL",
+  "km-KH",
+  "kn-IN",
+  "ko-KR",
+  "kok-IN",
+  "ky-KG",
+  "lb-LU",
+  "lo-LA",
+  "lt-LT",
+  "lv-LV",
+  "mi-NZ",
+  "mk-MK",
+  "ml-IN",
+  "mn-Mong-CN",
+  "mn-MN",
+  "mr-IN",
+  "ms-BN",
+  "ms-MY",
+  "mt-MT",
+  "nb-NO",
+  "ne-NP",
+  "nl-BE",
+  "nl-NL",
+  "nn-NO",
+  "no-NO",
+  "or-IN",
+  "pa-IN",
+  "pl-PL",
+  "ps-AF",
+  "pt-BR",
+  "pt-PT",
+  "qu-BO",
+  "qu-EC",
+  "qu-PE",
+  "rm-CH",
+  "ro-RO",
+  "ru-RU",
+  "rw-RW",
+  "sa-IN",
+  "sah-RU",
+  "se-FI",
+  "se-NO",
+  "se-SE",
+  "si-LK",
+  "sk-SK",
+  "sl-SI",
+  "smn-FI",
+  "sq-AL",
+  "sr-Cyrl-BA",
+  "sr-Latn-BA",
+  "sr-Cyrl-ME",
+  "sr-Latn-ME",
+  "sr-Cyrl-RS",
+  "sr-Latn-RS",
+  "sv-FI",
+  "sv-SE",
+  "sw-KE",
+  "ta-IN",
+  "te-IN",
+  "tg-TJ",
+  "th-TH",
+  "tk-TM",
+  "tr-TR",
+  "tt-RU",
+  "tzm-DZ",
+  "ug-CN",
+  "uk-UA",
+  "ur-PK",
+  "uz-UZ",
+  "uz-Cyrl-UZ",
+  "vi-VN",
+  "wo-SN",
+  "xh-ZA",
+  "yo-NG",
+  "zh-CN",
+  "zh-HK",
+  "zh-MO",
+  "zh-SG",
+  "zh-TW",
+  "zu-ZA",
+] as const;
+export default localeTable;
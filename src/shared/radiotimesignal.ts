@@ -1,15 +1,29 @@
 /* eslint-disable no-console */
 
+import AppSettings, {
+  Engine,
+  knownJjyKhz,
+  knownStations,
+} from "@shared/appsettings";
+import AutomationEngine, {
+  AutomationModule,
+  kFadeMs,
+} from "@shared/automationengine";
 import EventBus from "@shared/eventbus";
 import {
   TimeSignalReadyEvent,
   TimeSignalStateChangeEvent,
+  TimeSignalStatsEvent,
   VisualizerIconEvent,
 } from "@shared/events";
+import monotonicTime, {
+  TransmitWindow,
+  findTransmitWindow,
+} from "@shared/time";
 
 import createTimeSignalModule from "../../wasm/timesignal.js";
 
-interface TimeSignalModule extends EmscriptenModule {
+interface TimeSignalModule extends EmscriptenModule, AutomationModule {
   /* Emscripten library and WebAudio API functions. */
   addFunction(func: (...args: any) => any, signature: string): number;
   emscriptenRegisterAudioObject(object: AudioContext | AudioNode): number;
@@ -23,7 +37,7 @@ interface TimeSignalModule extends EmscriptenModule {
     jsCallbackPtr: number,
   ): void;
 
-  _tsig_start(): void;
+  _tsig_start(renderAhead: boolean, standby: boolean): void;
 
   _tsig_load_params(
     offset: number,
@@ -35,17 +49,52 @@ interface TimeSignalModule extends EmscriptenModule {
 
   _tsig_stop(): void;
 
+  _tsig_get_ppb(): number;
+
+  _tsig_get_resyncs(): number;
+
+  _tsig_get_ahead_ms(): number;
+
+  _tsig_get_underflows(): number;
+
+  _tsig_get_first_sample_ms(): number;
+
+  _tsig_get_subharmonic(): number;
+
+  _tsig_set_latency(latencyMs: number): void;
+
   _tsig_print_timestamp(timestamp: number, iters: number): number;
 }
 
-type TimeSignalModuleParams = {
+export type TimeSignalModuleParams = {
   stationIndex: number;
   jjyKhzIndex: number;
   offset: number;
   dut1: number;
   noclip: boolean;
+  engine: Engine;
+  standby: boolean;
 };
 
+/**
+ * Get the params to start with from the app settings.
+ * @param serverOffset Offset of server time from local time, in milliseconds.
+ * @returns Params for RadioTimeSignal.start().
+ */
+export function getSettingsParams(
+  serverOffset: number,
+): TimeSignalModuleParams {
+  return {
+    stationIndex: knownStations.indexOf(AppSettings.get("station")),
+    jjyKhzIndex: knownJjyKhz.indexOf(AppSettings.get("jjyKhz")),
+    offset: AppSettings.get("offset") + serverOffset,
+    dut1: AppSettings.get("dut1"),
+    noclip: AppSettings.get("noclip"),
+    engine: AppSettings.get("engine"),
+    standby: AppSettings.get("standby"),
+  };
+}
+
 const kTimeSignalState = [
   "idle",
   "startup",
@@ -55,12 +104,58 @@ const kTimeSignalState = [
   "running",
   "fadeout",
   "suspend",
+  "standby",
 ] as const;
 export type TimeSignalState = (typeof kTimeSignalState)[number];
 
+export type TimeSignalStats = {
+  /** Correction for audio output device's sample clock error, in ppm. */
+  ppm: number;
+
+  /** Smoothed output latency, in milliseconds. */
+  latencyMs: number;
+
+  /** Count of resynchronizations after dropped render quantums. */
+  resyncs: number;
+
+  /** Subharmonic generated in place of the target frequency, 1 if direct. */
+  subharmonic: number;
+
+  /** Audio rendered ahead of output, in milliseconds, if rendering ahead. */
+  aheadMs?: number;
+
+  /** Count of quantums due before they were rendered, if rendering ahead. */
+  underflows?: number;
+
+  /** Time from start() until the first sample was heard, in milliseconds. */
+  startMs?: number;
+};
+
+/* Params that the Audio Worklet loads. */
+const kModuleParams = [
+  "stationIndex",
+  "jjyKhzIndex",
+  "offset",
+  "dut1",
+  "noclip",
+] as const;
+
+/* Delay when starting/stopping, as in the Audio Worklet. */
+const kDelayMs = 465 as const;
+
 const kVisualizeMs = 5000 as const;
 const kQuantums = 384 as const;
 const kFftSize = 32 as const;
+const kStatsMs = 1000 as const;
+
+/* Output latency is median-filtered, then exponentially smoothed. */
+const kLatencyMs = 250 as const;
+const kLatencyWindow = 5 as const;
+const kLatencySmoothing = 0.1 as const;
+const kLatencyJumpMs = 20 as const;
+
+/* Recheck transmit windows at least this often, in case the clock changes. */
+const kScheduleMs = 60000 as const;
 
 class RadioTimeSignal {
   static #instance: RadioTimeSignal;
@@ -69,6 +164,33 @@ class RadioTimeSignal {
 
   #params?: TimeSignalModuleParams;
 
+  #automation!: AutomationEngine;
+
+  /** Engine of the current or last playback. */
+  #engine: Engine = "worklet";
+
+  #automationTimeoutId?: ReturnType<typeof setTimeout>;
+
+  #transmitWindows: readonly TransmitWindow[] = [];
+
+  #getScheduledParams?: () => TimeSignalModuleParams;
+
+  #inTransmitWindow = false;
+
+  #scheduleTimeoutId?: ReturnType<typeof setTimeout>;
+
+  /** Local timestamp of the last call to start() that went ahead. */
+  #startMs = 0;
+
+  /** Params last loaded into the Audio Worklet. */
+  #loadedParams?: TimeSignalModuleParams;
+
+  /** Whether to start once new params are loaded on warm standby. */
+  #startOnStandby = false;
+
+  /** Params to start with once off warm standby and suspended. */
+  #startOnIdle?: TimeSignalModuleParams;
+
   audioContext!: AudioContext;
 
   audioWorkletNode!: AudioWorkletNode;
@@ -81,6 +203,14 @@ class RadioTimeSignal {
 
   animationId!: ReturnType<typeof requestAnimationFrame>;
 
+  #statsIntervalId?: ReturnType<typeof setInterval>;
+
+  #latencyIntervalId?: ReturnType<typeof setInterval>;
+
+  #latencySamples: number[] = [];
+
+  #latencyMs = 0;
+
   #state = 0;
 
   get state(): TimeSignalState {
@@ -124,8 +254,13 @@ class RadioTimeSignal {
       audioWorkletNodeHandle,
     ) as AudioWorkletNode;
     this.analyserNode = this.audioContext.createAnalyser();
-    this.audioWorkletNode.connect(this.analyserNode);
     this.analyserNode.connect(this.audioContext.destination);
+    this.#automation = new AutomationEngine(
+      this.#module,
+      this.audioContext,
+      this.analyserNode,
+      () => this.#latencyMs,
+    );
 
     /* Rarely, against spec, the AudioContext seems to start on its own?! */
     if (this.audioContext.state === "running") this.audioContext.suspend();
@@ -206,44 +341,193 @@ class RadioTimeSignal {
     draw();
   };
 
+  #publishStats = () => {
+    const isWorklet = this.#engine !== "automation";
+    const stats: TimeSignalStats = {
+      ppm: isWorklet ? this.#module._tsig_get_ppb() / 1000 : 0,
+      latencyMs: this.#latencyMs,
+      resyncs: isWorklet ? this.#module._tsig_get_resyncs() : 0,
+      subharmonic:
+        isWorklet ?
+          this.#module._tsig_get_subharmonic()
+        : this.#module._tsig_sched_get_subharmonic(),
+    };
+    if (this.#engine === "pipeline") {
+      stats.aheadMs = this.#module._tsig_get_ahead_ms();
+      stats.underflows = this.#module._tsig_get_underflows();
+    }
+    if (isWorklet) {
+      const firstSampleMs = this.#module._tsig_get_first_sample_ms();
+      if (firstSampleMs) stats.startMs = firstSampleMs - this.#startMs;
+    }
+    EventBus.publish(TimeSignalStatsEvent, stats);
+  };
+
+  /**
+   * Measure how far ahead of the audio output device the AudioContext is
+   * rendering, which includes latency not reported by outputLatency.
+   */
+  #measureOutputLatency(): number {
+    const { currentTime, outputLatency } = this.audioContext;
+    const { contextTime, performanceTime } =
+      this.audioContext.getOutputTimestamp();
+
+    if (contextTime && performanceTime) {
+      const elapsed = (performance.now() - performanceTime) / 1000;
+      const latency = currentTime - (contextTime + elapsed);
+      if (latency > 0) return 1000 * latency;
+    }
+
+    return 1000 * (outputLatency ?? 0);
+  }
+
+  #trackOutputLatency = () => {
+    const samples = this.#latencySamples;
+    samples.push(this.#measureOutputLatency());
+    if (samples.length > kLatencyWindow) samples.shift();
+
+    const sorted = [...samples].sort((a, b) => a - b);
+    const median = sorted[Math.trunc(sorted.length / 2)];
+
+    /* Snap to large changes, e.g. when output is rerouted. */
+    const jump = Math.abs(median - this.#latencyMs) > kLatencyJumpMs;
+    if (samples.length === 1 || jump)
+      this.#latencyMs = median;
+    else this.#latencyMs += kLatencySmoothing * (median - this.#latencyMs);
+
+    this.#module._tsig_set_latency(this.#latencyMs);
+  };
+
   #communicate = (state: number) => {
     if (import.meta.env.DEV)
       console.log(`RadioTimeSignal.#communicate(${state});`);
     this.state = state;
 
     if (this.state === "idle") {
+      this.#startOnStandby = false;
+      clearInterval(this.#statsIntervalId);
+      clearInterval(this.#latencyIntervalId);
+      /* Output is silent by now, and the Audio Worklet needn't be pulled. */
+      this.audioWorkletNode.disconnect();
       this.audioContext.suspend().then(() => {
         cancelAnimationFrame(this.animationId);
         if (import.meta.env.DEV)
           console.log(`Suspended playback at ${Date.now()}`);
+
+        const params = this.#startOnIdle;
+        this.#startOnIdle = undefined;
+        if (params != null) this.start(params);
       });
     } else if (this.state === "reqparams") {
       this.#sendParams();
     } else if (this.state === "fadein") {
+      /* Coming off warm standby, these may still be running. */
+      cancelAnimationFrame(this.animationId);
+      clearInterval(this.#statsIntervalId);
       this.#visualize();
+      this.#publishStats();
+      this.#statsIntervalId = setInterval(this.#publishStats, kStatsMs);
+    } else if (this.state === "standby" && this.#startOnStandby) {
+      this.#startOnStandby = false;
+      this.#module._tsig_start(false, false);
     }
   };
 
   #sendParams = () => {
     if (this.#params == null) return;
 
-    const { dut1, jjyKhzIndex, noclip, offset, stationIndex } = this.#params;
-    const outputLatencyMs = 1000 * this.audioContext.outputLatency;
+    this.#latencySamples = [];
+    this.#latencyMs = 0;
+    this.#trackOutputLatency();
+    clearInterval(this.#latencyIntervalId);
+    this.#latencyIntervalId = setInterval(this.#trackOutputLatency, kLatencyMs);
+
+    if (this.#engine === "automation") {
+      this.#automation.start(this.#params);
+      this.#enterState("loadparams");
+      this.#enterState("fadein");
+      this.#enterStateAfter("running", kFadeMs);
+    } else {
+      this.#loadParams();
+    }
+
+    if (import.meta.env.DEV)
+      console.log(
+        `Sent params at ${Date.now()}, output latency ${this.#latencyMs}`,
+      );
+  };
 
+  #loadParams() {
+    const { dut1, jjyKhzIndex, noclip, offset, stationIndex } = this.#params!;
     this.#module._tsig_load_params(
-      offset + outputLatencyMs,
+      offset,
       stationIndex,
       jjyKhzIndex,
       dut1,
       noclip,
     );
+    this.#loadedParams = this.#params;
+  }
 
-    if (import.meta.env.DEV)
-      console.log(
-        `Sent params at ${Date.now()}, output latency ${outputLatencyMs}`,
-      );
+  /*
+   * On warm standby, start at once if the params loaded are still current.
+   * Otherwise, load the new ones first, which is still much faster than
+   * starting up from idle.
+   */
+  #startFromStandby() {
+    const params = this.#params!;
+    const loaded = this.#loadedParams;
+    const isLoaded =
+      loaded != null &&
+      kModuleParams.every((key) => params[key] === loaded[key]);
+
+    this.#startMs = monotonicTime();
+    if (isLoaded) {
+      this.#module._tsig_start(false, false);
+    } else {
+      this.#startOnStandby = true;
+      this.#loadParams();
+    }
+  }
+
+  /* Whether warm standby no longer suits the settings to start with. */
+  #isStandbyStale(standby: boolean, engine: Engine) {
+    return !standby || engine !== this.#engine;
+  }
+
+  /*
+   * The automation engine has no Audio Worklet thread to initiate state
+   * transitions, so they are made here on the same schedule.
+   */
+  #enterState(state: TimeSignalState) {
+    this.#communicate(kTimeSignalState.indexOf(state));
+  }
+
+  #enterStateAfter(state: TimeSignalState, ms: number) {
+    clearTimeout(this.#automationTimeoutId);
+    this.#automationTimeoutId = setTimeout(() => this.#enterState(state), ms);
+  }
+
+  #startAutomation = () => {
+    this.#enterState("startup");
+    this.#enterStateAfter("reqparams", kDelayMs);
   };
 
+  #stopAutomation() {
+    clearTimeout(this.#automationTimeoutId);
+    if (!this.#automation.isRunning) {
+      this.#enterState("idle");
+      return;
+    }
+
+    this.#automation.stop();
+    this.#enterState("fadeout");
+    this.#automationTimeoutId = setTimeout(() => {
+      this.#enterState("suspend");
+      this.#enterStateAfter("idle", kDelayMs);
+    }, kFadeMs);
+  }
+
   start(params: TimeSignalModuleParams) {
     /*
      * We don't send parameters to the Audio Worklet thread immediately, as
@@ -255,8 +539,49 @@ class RadioTimeSignal {
     if (import.meta.env.DEV)
       console.log(`RadioTimeSignal.start() at ${Date.now()}`);
     this.#params = params;
-    if (this.audioContext.state === "suspended")
-      this.audioContext.resume().then(this.#module._tsig_start);
+    if (this.state === "standby") {
+      if (this.#isStandbyStale(params.standby, params.engine)) {
+        /* Start afresh, e.g. with another engine, once suspended. */
+        this.stop();
+        this.#startOnIdle = params;
+      } else {
+        this.#startFromStandby();
+      }
+      return;
+    }
+    if (this.#startOnIdle != null) {
+      this.#startOnIdle = params;
+      return;
+    }
+    if (this.audioContext.state !== "suspended") return;
+
+    this.#engine = params.engine;
+    this.#startMs = monotonicTime();
+    if (this.#engine !== "automation")
+      this.audioWorkletNode.connect(this.analyserNode);
+    this.audioContext
+      .resume()
+      .then(
+        this.#engine === "automation" ?
+          this.#startAutomation
+        : () =>
+            this.#module._tsig_start(
+              this.#engine === "pipeline",
+              params.standby,
+            ),
+      );
+  }
+
+  /**
+   * Leave warm standby if the settings would no longer go on it, e.g. once
+   * Fast start is turned off or another engine is chosen, rather than keep
+   * the AudioContext running until the next start() and stop().
+   * @param standby Whether to go on warm standby once stopped.
+   * @param engine Engine to start with.
+   */
+  updateStandby(standby: boolean, engine: Engine) {
+    if (this.state === "standby" && this.#isStandbyStale(standby, engine))
+      this.stop();
   }
 
   stop() {
@@ -268,8 +593,58 @@ class RadioTimeSignal {
      * fades out and generates silence for some time before signaling an
      * appropriate state change to indicate that we may suspend it.
      */
-    if (this.audioContext.state === "running") this.#module._tsig_stop();
+    this.#startOnIdle = undefined;
+    if (this.audioContext.state !== "running") return;
+
+    this.#startOnStandby = false;
+    if (this.#engine === "automation") this.#stopAutomation();
+    else this.#module._tsig_stop();
+  }
+
+  /**
+   * Start and stop automatically, transmitting only within daily windows of
+   * local time, e.g. 02:00 to 03:00. In between, the AudioContext stays
+   * suspended and the audio rendering thread does no work.
+   * @param windows Daily windows of local time.
+   * @param getParams Called for params whenever a window begins.
+   * @note Replaces any previous schedule. Playback started or stopped by
+   *  other means is left alone until the next window begins or ends.
+   */
+  schedule(
+    windows: readonly TransmitWindow[],
+    getParams: () => TimeSignalModuleParams,
+  ) {
+    this.unschedule();
+    this.#transmitWindows = [...windows];
+    this.#getScheduledParams = getParams;
+    this.#followSchedule();
   }
+
+  /** Stop starting and stopping automatically. */
+  unschedule() {
+    clearTimeout(this.#scheduleTimeoutId);
+    this.#transmitWindows = [];
+    this.#getScheduledParams = undefined;
+    this.#inTransmitWindow = false;
+  }
+
+  #followSchedule = () => {
+    const { active, ms } = findTransmitWindow(
+      this.#transmitWindows,
+      Date.now(),
+    );
+
+    if (active !== this.#inTransmitWindow) {
+      this.#inTransmitWindow = active;
+      if (active) this.start(this.#getScheduledParams!());
+      else this.stop();
+    }
+
+    this.#scheduleTimeoutId = setTimeout(
+      this.#followSchedule,
+      Math.min(ms, kScheduleMs),
+    );
+  };
 }
 
 export default new RadioTimeSignal();
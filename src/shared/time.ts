@@ -54,3 +54,45 @@ export function decomposeOffset(offset: number) {
 
   return { negative, hh, mm, ss, ms };
 }
+
+/**
+ * Daily window of local time, in minutes after midnight. A window that ends
+ * no later than it starts runs past midnight.
+ */
+export type TransmitWindow = { startMin: number; endMin: number };
+
+/**
+ * Find whether a time is within any daily window of local time.
+ * @param windows Daily windows of local time.
+ * @param timestamp Time to check, in milliseconds since the epoch.
+ * @returns Whether the time is within a window, and how many milliseconds
+ *  after it the next window begins or ends, if any does.
+ */
+export function findTransmitWindow(
+  windows: readonly TransmitWindow[],
+  timestamp: number,
+) {
+  const date = new Date(timestamp);
+  const [year, month, day] = [
+    date.getFullYear(),
+    date.getMonth(),
+    date.getDate(),
+  ];
+  let active = false;
+  let ms = Infinity;
+
+  /* Yesterday's windows may run into today, and today's into tomorrow. */
+  for (let i = -1; i <= 1; i++) {
+    for (const { startMin, endMin } of windows) {
+      const wrapMin = endMin > startMin ? 0 : 24 * 60;
+      const start = new Date(year, month, day + i, 0, startMin).getTime();
+      const end = new Date(year, month, day + i, 0, endMin + wrapMin).getTime();
+
+      if (start <= timestamp && timestamp < end) active = true;
+      if (start > timestamp) ms = Math.min(ms, start - timestamp);
+      if (end > timestamp) ms = Math.min(ms, end - timestamp);
+    }
+  }
+
+  return { active, ms };
+}
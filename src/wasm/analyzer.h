@@ -0,0 +1,79 @@
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+
+#define TSIG_ANALYZER_PI 3.14159265358979323846
+
+/**
+ * Find the frequency at which a tone appears in sampled audio.
+ * @param hz Frequency of the tone. May be above Nyquist.
+ * @param sample_rate Sample rate.
+ * @return Frequency of the tone's alias in [0, Nyquist].
+ */
+static inline double tsig_analyzer_alias(double hz, double sample_rate) {
+  double folded = fmod(hz, sample_rate);
+  return folded > sample_rate / 2 ? sample_rate - folded : folded;
+}
+
+/**
+ * Find the relative amplitude at which a zero-order hold DAC outputs a tone.
+ *
+ * Above Nyquist, the tone is an image of its alias. The DAC's reconstruction
+ * filter attenuates it further, by an amount we cannot know.
+ *
+ * @param hz Frequency of the tone. May be above Nyquist.
+ * @param sample_rate Sample rate.
+ * @return Gain relative to the amplitude of the alias in the sampled audio.
+ */
+static inline double tsig_analyzer_image_gain(double hz, double sample_rate) {
+  double x = TSIG_ANALYZER_PI * hz / sample_rate;
+  return x ? fabs(sin(x) / x) : 1.0;
+}
+
+/**
+ * Measure the amplitude of a tone in sampled audio.
+ *
+ * Runs the Goertzel algorithm at the tone's alias over a Hann-windowed
+ * buffer, so the tone need not fall exactly on a DFT bin and strong tones
+ * nearby leak little into the result.
+ *
+ * @param samples Buffer of samples.
+ * @param n Count of samples.
+ * @param hz Frequency of the tone. May be above Nyquist.
+ * @param sample_rate Sample rate.
+ * @return Amplitude of the tone's alias, where a full-scale sine is 1.
+ */
+static double tsig_analyzer_goertzel(const float *samples, int n, double hz,
+                                     double sample_rate) {
+  double w = 2.0 * TSIG_ANALYZER_PI * tsig_analyzer_alias(hz, sample_rate) /
+             sample_rate;
+  double coeff = 2.0 * cos(w);
+  double s1 = 0, s2 = 0, window_sum = 0;
+
+  /* Hann window by rotation, rather than a cos() per sample. */
+  double rot_cos = cos(2.0 * TSIG_ANALYZER_PI / n);
+  double rot_sin = sin(2.0 * TSIG_ANALYZER_PI / n);
+  double c = 1.0, s = 0.0;
+
+  for (int i = 0; i < n; i++) {
+    double window = 0.5 - 0.5 * c;
+    double s0 = samples[i] * window + coeff * s1 - s2;
+    s2 = s1;
+    s1 = s0;
+    window_sum += window;
+
+    double next_c = c * rot_cos - s * rot_sin;
+    s = s * rot_cos + c * rot_sin;
+    c = next_c;
+  }
+
+  double power = s1 * s1 + s2 * s2 - coeff * s1 * s2;
+  double amplitude = 2.0 * sqrt(fmax(power, 0.0)) / window_sum;
+
+  /* DC and Nyquist have no negative frequency counterpart to fold in. */
+  if (!w || w >= TSIG_ANALYZER_PI - 1e-12)
+    amplitude /= 2;
+
+  return amplitude;
+}
@@ -4,10 +4,11 @@ set -ue
 
 EMCC_PARAMS=(
   '-sEXPORT_NAME=createEditDistanceModule'
-  '-sINITIAL_MEMORY=65536'
-  '-sSTACK_SIZE=40960'
+  '-sINITIAL_MEMORY=786432'
+  '-sSTACK_SIZE=8192'
   '-sMALLOC=none'
   '-sEXPORT_ES6'
+  '-msimd128'
   '-O3'
 )
 
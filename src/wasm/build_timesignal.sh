@@ -5,7 +5,7 @@ set -ue
 EMCC_PARAMS=(
   "-sEXPORTED_RUNTIME_METHODS="addFunction,emscriptenRegisterAudioObject,emscriptenGetAudioObject""
   '-sEXPORT_NAME=createTimeSignalModule'
-  '-sINITIAL_MEMORY=65536'
+  '-sINITIAL_MEMORY=524288'
   '-sALLOW_TABLE_GROWTH'
   '-sSTACK_SIZE=32768'
   '-sAUDIO_WORKLET'
@@ -23,6 +23,7 @@ done
 
 emcc timesignal.c -o timesignal.js "${EMCC_PARAMS[@]}" &&
   sed -i 's|timesignal.aw.js|wasm/timesignal.aw.js|' timesignal.js &&
+  sed -i 's|timesignal.ww.js|wasm/timesignal.ww.js|' timesignal.js &&
   mkdir -p ../../wasm &&
-  cp timesignal.aw.js timesignal.js timesignal.wasm ../../wasm &&
+  cp timesignal.aw.js timesignal.ww.js timesignal.js timesignal.wasm ../../wasm &&
   rm -f timesignal.aw.js timesignal.js timesignal.wasm timesignal.ww.js
@@ -0,0 +1,1726 @@
+/* Generated by scripts/casefoldingmap.py */
+
+#pragma once
+
+#include <stdint.h>
+
+#define EDIST_FOLD_BLOCK_BITS 6
+#define EDIST_FOLD_LIMIT      0x2fa40
+#define EDIST_FOLD_POOL_TAG   0xd800
+#define EDIST_MAX_FOLD_LEN    3
+#define EDIST_SCRIPTS         34
+
+/** Block of each 64 code points below EDIST_FOLD_LIMIT. */
+static const uint8_t kEdistFoldIndex[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 0, 10, 11, 12, 13,
+    14, 15, 16, 17, 18, 19, 20, 0, 21, 0, 0, 22, 0, 0, 0, 0,
+    0, 0, 0, 0, 23, 24, 0, 25, 26, 27, 0, 0, 0, 28, 29, 30,
+    0, 31, 0, 32, 0, 33, 0, 34, 0, 0, 0, 0, 0, 35, 36, 0,
+    37, 0, 38, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 42, 0, 0,
+    0, 0, 43, 0, 0, 0, 0, 0, 44, 45, 46, 47, 48, 49, 50, 51,
+    52, 0, 0, 0, 53, 54, 55, 56, 57, 58, 59, 60, 61, 0, 0, 0,
+    0, 0, 62, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0,
+    65, 66, 67, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 69, 70, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 73, 0, 74, 75, 76, 77,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 78, 79, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 0, 92, 93, 0, 94, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 97, 0, 98, 0, 0, 0, 0, 0, 0, 0, 0, 99, 0, 0,
+    0, 0, 100, 0, 0, 0, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 102, 0, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 104, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 105, 106, 107, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    109, 110, 111, 112, 113, 114, 115, 116, 117,
+};
+
+/**
+ * What each code point in a block folds to: 0 if itself, the low 16 bits
+ * of the one code point in the same plane, or else EDIST_FOLD_POOL_TAG
+ * plus the offset in the pool of their count, followed by each of them.
+ */
+static const uint16_t kEdistFoldBlocks[][64] = {
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+        0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+        0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+        0x0078, 0x0079, 0x007a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03bc, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x00e6, 0x0063,
+        0x0065, 0x0065, 0x0065, 0x0065, 0x0069, 0x0069, 0x0069, 0x0069,
+        0x00f0, 0x006e, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x0000,
+        0x00f8, 0x0075, 0x0075, 0x0075, 0x0075, 0x0079, 0x00fe, 0xd800,
+        0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0000, 0x0063,
+        0x0065, 0x0065, 0x0065, 0x0065, 0x0069, 0x0069, 0x0069, 0x0069,
+        0x0000, 0x006e, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x0000,
+        0x0000, 0x0075, 0x0075, 0x0075, 0x0075, 0x0079, 0x0000, 0x0079,
+    },
+    {
+        0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0063, 0x0063,
+        0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0063, 0x0064, 0x0064,
+        0x0111, 0x0000, 0x0065, 0x0065, 0x0065, 0x0065, 0x0065, 0x0065,
+        0x0065, 0x0065, 0x0065, 0x0065, 0x0067, 0x0067, 0x0067, 0x0067,
+        0x0067, 0x0067, 0x0067, 0x0067, 0x0068, 0x0068, 0x0127, 0x0000,
+        0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069,
+        0x0069, 0x0000, 0x0133, 0x0000, 0x006a, 0x006a, 0x006b, 0x006b,
+        0x0000, 0x006c, 0x006c, 0x006c, 0x006c, 0x006c, 0x006c, 0x0140,
+    },
+    {
+        0x0000, 0x0142, 0x0000, 0x006e, 0x006e, 0x006e, 0x006e, 0x006e,
+        0x006e, 0xd803, 0x014b, 0x0000, 0x006f, 0x006f, 0x006f, 0x006f,
+        0x006f, 0x006f, 0x0153, 0x0000, 0x0072, 0x0072, 0x0072, 0x0072,
+        0x0072, 0x0072, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+        0x0073, 0x0073, 0x0074, 0x0074, 0x0074, 0x0074, 0x0167, 0x0000,
+        0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075,
+        0x0075, 0x0075, 0x0075, 0x0075, 0x0077, 0x0077, 0x0079, 0x0079,
+        0x0079, 0x007a, 0x007a, 0x007a, 0x007a, 0x007a, 0x007a, 0x0073,
+    },
+    {
+        0x0000, 0x0253, 0x0183, 0x0000, 0x0185, 0x0000, 0x0254, 0x0188,
+        0x0000, 0x0256, 0x0257, 0x018c, 0x0000, 0x0000, 0x01dd, 0x0259,
+        0x025b, 0x0192, 0x0000, 0x0260, 0x0263, 0x0000, 0x0269, 0x0268,
+        0x0199, 0x0000, 0x0000, 0x0000, 0x026f, 0x0272, 0x0000, 0x0275,
+        0x006f, 0x006f, 0x01a3, 0x0000, 0x01a5, 0x0000, 0x0280, 0x01a8,
+        0x0000, 0x0283, 0x0000, 0x0000, 0x01ad, 0x0000, 0x0288, 0x0075,
+        0x0075, 0x028a, 0x028b, 0x01b4, 0x0000, 0x01b6, 0x0000, 0x0292,
+        0x01b9, 0x0000, 0x0000, 0x0000, 0x01bd, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x01c6, 0x01c6, 0x0000, 0x01c9,
+        0x01c9, 0x0000, 0x01cc, 0x01cc, 0x0000, 0x0061, 0x0061, 0x0069,
+        0x0069, 0x006f, 0x006f, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075,
+        0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0000, 0x0061, 0x0061,
+        0x0061, 0x0061, 0x00e6, 0x00e6, 0x01e5, 0x0000, 0x0067, 0x0067,
+        0x006b, 0x006b, 0x006f, 0x006f, 0x006f, 0x006f, 0x0292, 0x0292,
+        0x006a, 0x01f3, 0x01f3, 0x0000, 0x0067, 0x0067, 0x0195, 0x01bf,
+        0x006e, 0x006e, 0x0061, 0x0061, 0x00e6, 0x00e6, 0x00f8, 0x00f8,
+    },
+    {
+        0x0061, 0x0061, 0x0061, 0x0061, 0x0065, 0x0065, 0x0065, 0x0065,
+        0x0069, 0x0069, 0x0069, 0x0069, 0x006f, 0x006f, 0x006f, 0x006f,
+        0x0072, 0x0072, 0x0072, 0x0072, 0x0075, 0x0075, 0x0075, 0x0075,
+        0x0073, 0x0073, 0x0074, 0x0074, 0x021d, 0x0000, 0x0068, 0x0068,
+        0x019e, 0x0000, 0x0223, 0x0000, 0x0225, 0x0000, 0x0061, 0x0061,
+        0x0065, 0x0065, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f,
+        0x006f, 0x006f, 0x0079, 0x0079, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x2c65, 0x023c, 0x0000, 0x019a, 0x2c66, 0x0000,
+    },
+    {
+        0x0000, 0x0242, 0x0000, 0x0180, 0x0289, 0x028c, 0x0247, 0x0000,
+        0x0249, 0x0000, 0x024b, 0x0000, 0x024d, 0x0000, 0x024f, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806,
+        0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806,
+        0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806,
+        0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806,
+        0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806,
+        0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806,
+        0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806,
+        0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806,
+    },
+    {
+        0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0x03b9, 0xd806, 0xd806,
+        0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806,
+        0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806,
+        0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806,
+        0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806,
+        0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806, 0xd806,
+        0x0371, 0x0000, 0x0373, 0x0000, 0x02b9, 0x0000, 0x0377, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x003b, 0x03f3,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00a8, 0x03b1, 0x00b7,
+        0x03b5, 0x03b7, 0x03b9, 0x0000, 0x03bf, 0x0000, 0x03c5, 0x03c9,
+        0x03b9, 0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5, 0x03b6, 0x03b7,
+        0x03b8, 0x03b9, 0x03ba, 0x03bb, 0x03bc, 0x03bd, 0x03be, 0x03bf,
+        0x03c0, 0x03c1, 0x0000, 0x03c3, 0x03c4, 0x03c5, 0x03c6, 0x03c7,
+        0x03c8, 0x03c9, 0x03b9, 0x03c5, 0x03b1, 0x03b5, 0x03b7, 0x03b9,
+        0x03c5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x03c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x03b9, 0x03c5, 0x03bf, 0x03c5, 0x03c9, 0x03d7,
+        0x03b2, 0x03b8, 0x0000, 0x03d2, 0x03d2, 0x03c6, 0x03c0, 0x0000,
+        0x03d9, 0x0000, 0x03db, 0x0000, 0x03dd, 0x0000, 0x03df, 0x0000,
+        0x03e1, 0x0000, 0x03e3, 0x0000, 0x03e5, 0x0000, 0x03e7, 0x0000,
+        0x03e9, 0x0000, 0x03eb, 0x0000, 0x03ed, 0x0000, 0x03ef, 0x0000,
+        0x03ba, 0x03c1, 0x0000, 0x0000, 0x03b8, 0x03b5, 0x0000, 0x03f8,
+        0x0000, 0x03f2, 0x03fb, 0x0000, 0x0000, 0x037b, 0x037c, 0x037d,
+    },
+    {
+        0x0435, 0x0435, 0x0452, 0x0433, 0x0454, 0x0455, 0x0456, 0x0456,
+        0x0458, 0x0459, 0x045a, 0x045b, 0x043a, 0x0438, 0x0443, 0x045f,
+        0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+        0x0438, 0x0438, 0x043a, 0x043b, 0x043c, 0x043d, 0x043e, 0x043f,
+        0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+        0x0448, 0x0449, 0x044a, 0x044b, 0x044c, 0x044d, 0x044e, 0x044f,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0438, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0435, 0x0435, 0x0000, 0x0433, 0x0000, 0x0000, 0x0000, 0x0456,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x043a, 0x0438, 0x0443, 0x0000,
+        0x0461, 0x0000, 0x0463, 0x0000, 0x0465, 0x0000, 0x0467, 0x0000,
+        0x0469, 0x0000, 0x046b, 0x0000, 0x046d, 0x0000, 0x046f, 0x0000,
+        0x0471, 0x0000, 0x0473, 0x0000, 0x0475, 0x0000, 0x0475, 0x0475,
+        0x0479, 0x0000, 0x047b, 0x0000, 0x047d, 0x0000, 0x047f, 0x0000,
+    },
+    {
+        0x0481, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x048b, 0x0000, 0x048d, 0x0000, 0x048f, 0x0000,
+        0x0491, 0x0000, 0x0493, 0x0000, 0x0495, 0x0000, 0x0497, 0x0000,
+        0x0499, 0x0000, 0x049b, 0x0000, 0x049d, 0x0000, 0x049f, 0x0000,
+        0x04a1, 0x0000, 0x04a3, 0x0000, 0x04a5, 0x0000, 0x04a7, 0x0000,
+        0x04a9, 0x0000, 0x04ab, 0x0000, 0x04ad, 0x0000, 0x04af, 0x0000,
+        0x04b1, 0x0000, 0x04b3, 0x0000, 0x04b5, 0x0000, 0x04b7, 0x0000,
+        0x04b9, 0x0000, 0x04bb, 0x0000, 0x04bd, 0x0000, 0x04bf, 0x0000,
+    },
+    {
+        0x04cf, 0x0436, 0x0436, 0x04c4, 0x0000, 0x04c6, 0x0000, 0x04c8,
+        0x0000, 0x04ca, 0x0000, 0x04cc, 0x0000, 0x04ce, 0x0000, 0x0000,
+        0x0430, 0x0430, 0x0430, 0x0430, 0x04d5, 0x0000, 0x0435, 0x0435,
+        0x04d9, 0x0000, 0x04d9, 0x04d9, 0x0436, 0x0436, 0x0437, 0x0437,
+        0x04e1, 0x0000, 0x0438, 0x0438, 0x0438, 0x0438, 0x043e, 0x043e,
+        0x04e9, 0x0000, 0x04e9, 0x04e9, 0x044d, 0x044d, 0x0443, 0x0443,
+        0x0443, 0x0443, 0x0443, 0x0443, 0x0447, 0x0447, 0x04f7, 0x0000,
+        0x044b, 0x044b, 0x04fb, 0x0000, 0x04fd, 0x0000, 0x04ff, 0x0000,
+    },
+    {
+        0x0501, 0x0000, 0x0503, 0x0000, 0x0505, 0x0000, 0x0507, 0x0000,
+        0x0509, 0x0000, 0x050b, 0x0000, 0x050d, 0x0000, 0x050f, 0x0000,
+        0x0511, 0x0000, 0x0513, 0x0000, 0x0515, 0x0000, 0x0517, 0x0000,
+        0x0519, 0x0000, 0x051b, 0x0000, 0x051d, 0x0000, 0x051f, 0x0000,
+        0x0521, 0x0000, 0x0523, 0x0000, 0x0525, 0x0000, 0x0527, 0x0000,
+        0x0529, 0x0000, 0x052b, 0x0000, 0x052d, 0x0000, 0x052f, 0x0000,
+        0x0000, 0x0561, 0x0562, 0x0563, 0x0564, 0x0565, 0x0566, 0x0567,
+        0x0568, 0x0569, 0x056a, 0x056b, 0x056c, 0x056d, 0x056e, 0x056f,
+    },
+    {
+        0x0570, 0x0571, 0x0572, 0x0573, 0x0574, 0x0575, 0x0576, 0x0577,
+        0x0578, 0x0579, 0x057a, 0x057b, 0x057c, 0x057d, 0x057e, 0x057f,
+        0x0580, 0x0581, 0x0582, 0x0583, 0x0584, 0x0585, 0x0586, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd807,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0xd80a, 0xd80d, 0xd810, 0xd813, 0xd816, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0xd819, 0x0000, 0xd81c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0xd81f, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0xd822, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0xd825, 0x0000, 0x0000, 0xd828, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0xd82b, 0xd82e, 0xd831, 0xd834, 0xd837, 0xd83a, 0xd83d, 0xd840,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0xd843, 0xd846, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0xd849, 0xd84c, 0x0000, 0xd84f,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0xd852, 0x0000, 0x0000, 0xd855, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0xd858, 0xd85b, 0xd85e, 0x0000, 0x0000, 0xd861, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0xd864, 0x0000, 0x0000, 0xd867, 0xd86a, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0xd86d, 0xd870, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0xd873, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0xd876, 0xd879, 0xd87c, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0xd87f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0xd882, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd885,
+        0xd888, 0x0000, 0xd88b, 0xd88e, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0xd892, 0xd895, 0xd898, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0xd89b, 0x0000, 0xd89e, 0xd8a1, 0xd8a5, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0xd8a8, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd8ab, 0x0000, 0x0000,
+        0x0000, 0x0000, 0xd8ae, 0x0000, 0x0000, 0x0000, 0x0000, 0xd8b1,
+        0x0000, 0x0000, 0x0000, 0x0000, 0xd8b4, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0xd8b7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0xd8ba, 0x0000, 0xd8bd, 0xd8c0, 0x0000,
+        0xd8c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0xd8c6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0xd8c9, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd8cc, 0x0000, 0x0000,
+        0x0000, 0x0000, 0xd8cf, 0x0000, 0x0000, 0x0000, 0x0000, 0xd8d2,
+        0x0000, 0x0000, 0x0000, 0x0000, 0xd8d5, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0xd8d8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd8db, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x2d00, 0x2d01, 0x2d02, 0x2d03, 0x2d04, 0x2d05, 0x2d06, 0x2d07,
+        0x2d08, 0x2d09, 0x2d0a, 0x2d0b, 0x2d0c, 0x2d0d, 0x2d0e, 0x2d0f,
+        0x2d10, 0x2d11, 0x2d12, 0x2d13, 0x2d14, 0x2d15, 0x2d16, 0x2d17,
+        0x2d18, 0x2d19, 0x2d1a, 0x2d1b, 0x2d1c, 0x2d1d, 0x2d1e, 0x2d1f,
+    },
+    {
+        0x2d20, 0x2d21, 0x2d22, 0x2d23, 0x2d24, 0x2d25, 0x0000, 0x2d27,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2d2d, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x13f0, 0x13f1, 0x13f2, 0x13f3, 0x13f4, 0x13f5, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd8de, 0x0000,
+        0xd8e1, 0x0000, 0xd8e4, 0x0000, 0xd8e7, 0x0000, 0xd8ea, 0x0000,
+        0x0000, 0x0000, 0xd8ed, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0xd8f0, 0x0000, 0xd8f3, 0x0000, 0x0000,
+    },
+    {
+        0xd8f6, 0xd8f9, 0x0000, 0xd8fc, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0432, 0x0434, 0x043e, 0x0441, 0x0442, 0x0442, 0x044a, 0x0463,
+        0xa64b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x10d0, 0x10d1, 0x10d2, 0x10d3, 0x10d4, 0x10d5, 0x10d6, 0x10d7,
+        0x10d8, 0x10d9, 0x10da, 0x10db, 0x10dc, 0x10dd, 0x10de, 0x10df,
+        0x10e0, 0x10e1, 0x10e2, 0x10e3, 0x10e4, 0x10e5, 0x10e6, 0x10e7,
+        0x10e8, 0x10e9, 0x10ea, 0x10eb, 0x10ec, 0x10ed, 0x10ee, 0x10ef,
+        0x10f0, 0x10f1, 0x10f2, 0x10f3, 0x10f4, 0x10f5, 0x10f6, 0x10f7,
+        0x10f8, 0x10f9, 0x10fa, 0x0000, 0x0000, 0x10fd, 0x10fe, 0x10ff,
+    },
+    {
+        0x0061, 0x0061, 0x0062, 0x0062, 0x0062, 0x0062, 0x0062, 0x0062,
+        0x0063, 0x0063, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064,
+        0x0064, 0x0064, 0x0064, 0x0064, 0x0065, 0x0065, 0x0065, 0x0065,
+        0x0065, 0x0065, 0x0065, 0x0065, 0x0065, 0x0065, 0x0066, 0x0066,
+        0x0067, 0x0067, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068, 0x0068,
+        0x0068, 0x0068, 0x0068, 0x0068, 0x0069, 0x0069, 0x0069, 0x0069,
+        0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006b, 0x006c, 0x006c,
+        0x006c, 0x006c, 0x006c, 0x006c, 0x006c, 0x006c, 0x006d, 0x006d,
+    },
+    {
+        0x006d, 0x006d, 0x006d, 0x006d, 0x006e, 0x006e, 0x006e, 0x006e,
+        0x006e, 0x006e, 0x006e, 0x006e, 0x006f, 0x006f, 0x006f, 0x006f,
+        0x006f, 0x006f, 0x006f, 0x006f, 0x0070, 0x0070, 0x0070, 0x0070,
+        0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072,
+        0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+        0x0073, 0x0073, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074,
+        0x0074, 0x0074, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075,
+        0x0075, 0x0075, 0x0075, 0x0075, 0x0076, 0x0076, 0x0076, 0x0076,
+    },
+    {
+        0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077,
+        0x0077, 0x0077, 0x0078, 0x0078, 0x0078, 0x0078, 0x0079, 0x0079,
+        0x007a, 0x007a, 0x007a, 0x007a, 0x007a, 0x007a, 0x0068, 0x0074,
+        0x0077, 0x0079, 0xd8ff, 0x0073, 0x0000, 0x0000, 0xd800, 0x0000,
+        0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061,
+        0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061,
+        0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061, 0x0061,
+        0x0065, 0x0065, 0x0065, 0x0065, 0x0065, 0x0065, 0x0065, 0x0065,
+    },
+    {
+        0x0065, 0x0065, 0x0065, 0x0065, 0x0065, 0x0065, 0x0065, 0x0065,
+        0x0069, 0x0069, 0x0069, 0x0069, 0x006f, 0x006f, 0x006f, 0x006f,
+        0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f,
+        0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f, 0x006f,
+        0x006f, 0x006f, 0x006f, 0x006f, 0x0075, 0x0075, 0x0075, 0x0075,
+        0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075,
+        0x0075, 0x0075, 0x0079, 0x0079, 0x0079, 0x0079, 0x0079, 0x0079,
+        0x0079, 0x0079, 0x1efb, 0x0000, 0x1efd, 0x0000, 0x1eff, 0x0000,
+    },
+    {
+        0x03b1, 0x03b1, 0x03b1, 0x03b1, 0x03b1, 0x03b1, 0x03b1, 0x03b1,
+        0x03b1, 0x03b1, 0x03b1, 0x03b1, 0x03b1, 0x03b1, 0x03b1, 0x03b1,
+        0x03b5, 0x03b5, 0x03b5, 0x03b5, 0x03b5, 0x03b5, 0x0000, 0x0000,
+        0x03b5, 0x03b5, 0x03b5, 0x03b5, 0x03b5, 0x03b5, 0x0000, 0x0000,
+        0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7,
+        0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7, 0x03b7,
+        0x03b9, 0x03b9, 0x03b9, 0x03b9, 0x03b9, 0x03b9, 0x03b9, 0x03b9,
+        0x03b9, 0x03b9, 0x03b9, 0x03b9, 0x03b9, 0x03b9, 0x03b9, 0x03b9,
+    },
+    {
+        0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x0000, 0x0000,
+        0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x0000, 0x0000,
+        0x03c5, 0x03c5, 0x03c5, 0x03c5, 0x03c5, 0x03c5, 0x03c5, 0x03c5,
+        0x0000, 0x03c5, 0x0000, 0x03c5, 0x0000, 0x03c5, 0x0000, 0x03c5,
+        0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x03c9,
+        0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x03c9, 0x03c9,
+        0x03b1, 0x03b1, 0x03b5, 0x03b5, 0x03b7, 0x03b7, 0x03b9, 0x03b9,
+        0x03bf, 0x03bf, 0x03c5, 0x03c5, 0x03c9, 0x03c9, 0x0000, 0x0000,
+    },
+    {
+        0xd902, 0xd902, 0xd902, 0xd902, 0xd902, 0xd902, 0xd902, 0xd902,
+        0xd902, 0xd902, 0xd902, 0xd902, 0xd902, 0xd902, 0xd902, 0xd902,
+        0xd905, 0xd905, 0xd905, 0xd905, 0xd905, 0xd905, 0xd905, 0xd905,
+        0xd905, 0xd905, 0xd905, 0xd905, 0xd905, 0xd905, 0xd905, 0xd905,
+        0xd908, 0xd908, 0xd908, 0xd908, 0xd908, 0xd908, 0xd908, 0xd908,
+        0xd908, 0xd908, 0xd908, 0xd908, 0xd908, 0xd908, 0xd908, 0xd908,
+        0x03b1, 0x03b1, 0xd902, 0xd902, 0xd902, 0x0000, 0x03b1, 0xd902,
+        0x03b1, 0x03b1, 0x03b1, 0x03b1, 0xd902, 0x0000, 0x03b9, 0x0000,
+    },
+    {
+        0x0000, 0x00a8, 0xd905, 0xd905, 0xd905, 0x0000, 0x03b7, 0xd905,
+        0x03b5, 0x03b5, 0x03b7, 0x03b7, 0xd905, 0x1fbf, 0x1fbf, 0x1fbf,
+        0x03b9, 0x03b9, 0x03b9, 0x03b9, 0x0000, 0x0000, 0x03b9, 0x03b9,
+        0x03b9, 0x03b9, 0x03b9, 0x03b9, 0x0000, 0x1ffe, 0x1ffe, 0x1ffe,
+        0x03c5, 0x03c5, 0x03c5, 0x03c5, 0x03c1, 0x03c1, 0x03c5, 0x03c5,
+        0x03c5, 0x03c5, 0x03c5, 0x03c5, 0x03c1, 0x00a8, 0x00a8, 0x0060,
+        0x0000, 0x0000, 0xd908, 0xd908, 0xd908, 0x0000, 0x03c9, 0xd908,
+        0x03bf, 0x03bf, 0x03c9, 0x03c9, 0xd908, 0x00b4, 0x0000, 0x0000,
+    },
+    {
+        0x2002, 0x2003, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03c9, 0x0000,
+        0x0000, 0x0000, 0x006b, 0x0061, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x214e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x2170, 0x2171, 0x2172, 0x2173, 0x2174, 0x2175, 0x2176, 0x2177,
+        0x2178, 0x2179, 0x217a, 0x217b, 0x217c, 0x217d, 0x217e, 0x217f,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x2184, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x2190, 0x2192, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2194, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x21d0, 0x21d4, 0x21d2,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x2203, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x2208, 0x0000, 0x0000, 0x220b, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x2223, 0x0000, 0x2225, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x223c, 0x0000, 0x0000, 0x2243, 0x0000, 0x0000, 0x2245,
+        0x0000, 0x2248, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x003d, 0x0000, 0x2261, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x224d, 0x003c, 0x003e,
+        0x2264, 0x2265, 0x0000, 0x0000, 0x2272, 0x2273, 0x0000, 0x0000,
+        0x2276, 0x2277, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x227a, 0x227b, 0x0000, 0x0000, 0x2282, 0x2283, 0x0000, 0x0000,
+        0x2286, 0x2287, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x22a2, 0x22a8, 0x22a9, 0x22ab,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x227c, 0x227d, 0x2291, 0x2292, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x22b2, 0x22b3, 0x22b4, 0x22b5, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x3008, 0x3009, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x24d0, 0x24d1,
+        0x24d2, 0x24d3, 0x24d4, 0x24d5, 0x24d6, 0x24d7, 0x24d8, 0x24d9,
+    },
+    {
+        0x24da, 0x24db, 0x24dc, 0x24dd, 0x24de, 0x24df, 0x24e0, 0x24e1,
+        0x24e2, 0x24e3, 0x24e4, 0x24e5, 0x24e6, 0x24e7, 0x24e8, 0x24e9,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x2add, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x2c30, 0x2c31, 0x2c32, 0x2c33, 0x2c34, 0x2c35, 0x2c36, 0x2c37,
+        0x2c38, 0x2c39, 0x2c3a, 0x2c3b, 0x2c3c, 0x2c3d, 0x2c3e, 0x2c3f,
+        0x2c40, 0x2c41, 0x2c42, 0x2c43, 0x2c44, 0x2c45, 0x2c46, 0x2c47,
+        0x2c48, 0x2c49, 0x2c4a, 0x2c4b, 0x2c4c, 0x2c4d, 0x2c4e, 0x2c4f,
+        0x2c50, 0x2c51, 0x2c52, 0x2c53, 0x2c54, 0x2c55, 0x2c56, 0x2c57,
+        0x2c58, 0x2c59, 0x2c5a, 0x2c5b, 0x2c5c, 0x2c5d, 0x2c5e, 0x2c5f,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x2c61, 0x0000, 0x026b, 0x1d7d, 0x027d, 0x0000, 0x0000, 0x2c68,
+        0x0000, 0x2c6a, 0x0000, 0x2c6c, 0x0000, 0x0251, 0x0271, 0x0250,
+        0x0252, 0x0000, 0x2c73, 0x0000, 0x0000, 0x2c76, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x023f, 0x0240,
+    },
+    {
+        0x2c81, 0x0000, 0x2c83, 0x0000, 0x2c85, 0x0000, 0x2c87, 0x0000,
+        0x2c89, 0x0000, 0x2c8b, 0x0000, 0x2c8d, 0x0000, 0x2c8f, 0x0000,
+        0x2c91, 0x0000, 0x2c93, 0x0000, 0x2c95, 0x0000, 0x2c97, 0x0000,
+        0x2c99, 0x0000, 0x2c9b, 0x0000, 0x2c9d, 0x0000, 0x2c9f, 0x0000,
+        0x2ca1, 0x0000, 0x2ca3, 0x0000, 0x2ca5, 0x0000, 0x2ca7, 0x0000,
+        0x2ca9, 0x0000, 0x2cab, 0x0000, 0x2cad, 0x0000, 0x2caf, 0x0000,
+        0x2cb1, 0x0000, 0x2cb3, 0x0000, 0x2cb5, 0x0000, 0x2cb7, 0x0000,
+        0x2cb9, 0x0000, 0x2cbb, 0x0000, 0x2cbd, 0x0000, 0x2cbf, 0x0000,
+    },
+    {
+        0x2cc1, 0x0000, 0x2cc3, 0x0000, 0x2cc5, 0x0000, 0x2cc7, 0x0000,
+        0x2cc9, 0x0000, 0x2ccb, 0x0000, 0x2ccd, 0x0000, 0x2ccf, 0x0000,
+        0x2cd1, 0x0000, 0x2cd3, 0x0000, 0x2cd5, 0x0000, 0x2cd7, 0x0000,
+        0x2cd9, 0x0000, 0x2cdb, 0x0000, 0x2cdd, 0x0000, 0x2cdf, 0x0000,
+        0x2ce1, 0x0000, 0x2ce3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x2cec, 0x0000, 0x2cee, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x2cf3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0xd90b, 0x0000, 0xd90e, 0x0000,
+        0xd911, 0x0000, 0xd914, 0x0000, 0xd917, 0x0000, 0xd91a, 0x0000,
+        0xd91d, 0x0000, 0xd920, 0x0000, 0xd923, 0x0000, 0xd926, 0x0000,
+        0xd929, 0x0000, 0xd92c, 0x0000, 0x0000, 0xd92f, 0x0000, 0xd932,
+        0x0000, 0xd935, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0xd938, 0xd93b, 0x0000, 0xd93e, 0xd941, 0x0000, 0xd944, 0xd947,
+        0x0000, 0xd94a, 0xd94d, 0x0000, 0xd950, 0xd953, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0xd956, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd959, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0xd95c, 0x0000, 0xd95f, 0x0000,
+        0xd962, 0x0000, 0xd965, 0x0000, 0xd968, 0x0000, 0xd96b, 0x0000,
+        0xd96e, 0x0000, 0xd971, 0x0000, 0xd974, 0x0000, 0xd977, 0x0000,
+    },
+    {
+        0xd97a, 0x0000, 0xd97d, 0x0000, 0x0000, 0xd980, 0x0000, 0xd983,
+        0x0000, 0xd986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0xd989, 0xd98c, 0x0000, 0xd98f, 0xd992, 0x0000, 0xd995, 0xd998,
+        0x0000, 0xd99b, 0xd99e, 0x0000, 0xd9a1, 0xd9a4, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0xd9a7, 0x0000, 0x0000, 0xd9aa,
+        0xd9ad, 0xd9b0, 0xd9b3, 0x0000, 0x0000, 0x0000, 0xd9b6, 0x0000,
+    },
+    {
+        0xa641, 0x0000, 0xa643, 0x0000, 0xa645, 0x0000, 0xa647, 0x0000,
+        0xa649, 0x0000, 0xa64b, 0x0000, 0xa64d, 0x0000, 0xa64f, 0x0000,
+        0xa651, 0x0000, 0xa653, 0x0000, 0xa655, 0x0000, 0xa657, 0x0000,
+        0xa659, 0x0000, 0xa65b, 0x0000, 0xa65d, 0x0000, 0xa65f, 0x0000,
+        0xa661, 0x0000, 0xa663, 0x0000, 0xa665, 0x0000, 0xa667, 0x0000,
+        0xa669, 0x0000, 0xa66b, 0x0000, 0xa66d, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0xa681, 0x0000, 0xa683, 0x0000, 0xa685, 0x0000, 0xa687, 0x0000,
+        0xa689, 0x0000, 0xa68b, 0x0000, 0xa68d, 0x0000, 0xa68f, 0x0000,
+        0xa691, 0x0000, 0xa693, 0x0000, 0xa695, 0x0000, 0xa697, 0x0000,
+        0xa699, 0x0000, 0xa69b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0xa723, 0x0000, 0xa725, 0x0000, 0xa727, 0x0000,
+        0xa729, 0x0000, 0xa72b, 0x0000, 0xa72d, 0x0000, 0xa72f, 0x0000,
+        0x0000, 0x0000, 0xa733, 0x0000, 0xa735, 0x0000, 0xa737, 0x0000,
+        0xa739, 0x0000, 0xa73b, 0x0000, 0xa73d, 0x0000, 0xa73f, 0x0000,
+    },
+    {
+        0xa741, 0x0000, 0xa743, 0x0000, 0xa745, 0x0000, 0xa747, 0x0000,
+        0xa749, 0x0000, 0xa74b, 0x0000, 0xa74d, 0x0000, 0xa74f, 0x0000,
+        0xa751, 0x0000, 0xa753, 0x0000, 0xa755, 0x0000, 0xa757, 0x0000,
+        0xa759, 0x0000, 0xa75b, 0x0000, 0xa75d, 0x0000, 0xa75f, 0x0000,
+        0xa761, 0x0000, 0xa763, 0x0000, 0xa765, 0x0000, 0xa767, 0x0000,
+        0xa769, 0x0000, 0xa76b, 0x0000, 0xa76d, 0x0000, 0xa76f, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0xa77a, 0x0000, 0xa77c, 0x0000, 0x1d79, 0xa77f, 0x0000,
+    },
+    {
+        0xa781, 0x0000, 0xa783, 0x0000, 0xa785, 0x0000, 0xa787, 0x0000,
+        0x0000, 0x0000, 0x0000, 0xa78c, 0x0000, 0x0265, 0x0000, 0x0000,
+        0xa791, 0x0000, 0xa793, 0x0000, 0x0000, 0x0000, 0xa797, 0x0000,
+        0xa799, 0x0000, 0xa79b, 0x0000, 0xa79d, 0x0000, 0xa79f, 0x0000,
+        0xa7a1, 0x0000, 0xa7a3, 0x0000, 0xa7a5, 0x0000, 0xa7a7, 0x0000,
+        0xa7a9, 0x0000, 0x0266, 0x025c, 0x0261, 0x026c, 0x026a, 0x0000,
+        0x029e, 0x0287, 0x029d, 0xab53, 0xa7b5, 0x0000, 0xa7b7, 0x0000,
+        0xa7b9, 0x0000, 0xa7bb, 0x0000, 0xa7bd, 0x0000, 0xa7bf, 0x0000,
+    },
+    {
+        0xa7c1, 0x0000, 0xa7c3, 0x0000, 0xa794, 0x0282, 0x1d8e, 0xa7c8,
+        0x0000, 0xa7ca, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0xa7d1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa7d7, 0x0000,
+        0xa7d9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xa7f6, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x13a0, 0x13a1, 0x13a2, 0x13a3, 0x13a4, 0x13a5, 0x13a6, 0x13a7,
+        0x13a8, 0x13a9, 0x13aa, 0x13ab, 0x13ac, 0x13ad, 0x13ae, 0x13af,
+    },
+    {
+        0x13b0, 0x13b1, 0x13b2, 0x13b3, 0x13b4, 0x13b5, 0x13b6, 0x13b7,
+        0x13b8, 0x13b9, 0x13ba, 0x13bb, 0x13bc, 0x13bd, 0x13be, 0x13bf,
+        0x13c0, 0x13c1, 0x13c2, 0x13c3, 0x13c4, 0x13c5, 0x13c6, 0x13c7,
+        0x13c8, 0x13c9, 0x13ca, 0x13cb, 0x13cc, 0x13cd, 0x13ce, 0x13cf,
+        0x13d0, 0x13d1, 0x13d2, 0x13d3, 0x13d4, 0x13d5, 0x13d6, 0x13d7,
+        0x13d8, 0x13d9, 0x13da, 0x13db, 0x13dc, 0x13dd, 0x13de, 0x13df,
+        0x13e0, 0x13e1, 0x13e2, 0x13e3, 0x13e4, 0x13e5, 0x13e6, 0x13e7,
+        0x13e8, 0x13e9, 0x13ea, 0x13eb, 0x13ec, 0x13ed, 0x13ee, 0x13ef,
+    },
+    {
+        0x8c48, 0x66f4, 0x8eca, 0x8cc8, 0x6ed1, 0x4e32, 0x53e5, 0x9f9c,
+        0x9f9c, 0x5951, 0x91d1, 0x5587, 0x5948, 0x61f6, 0x7669, 0x7f85,
+        0x863f, 0x87ba, 0x88f8, 0x908f, 0x6a02, 0x6d1b, 0x70d9, 0x73de,
+        0x843d, 0x916a, 0x99f1, 0x4e82, 0x5375, 0x6b04, 0x721b, 0x862d,
+        0x9e1e, 0x5d50, 0x6feb, 0x85cd, 0x8964, 0x62c9, 0x81d8, 0x881f,
+        0x5eca, 0x6717, 0x6d6a, 0x72fc, 0x90ce, 0x4f86, 0x51b7, 0x52de,
+        0x64c4, 0x6ad3, 0x7210, 0x76e7, 0x8001, 0x8606, 0x865c, 0x8def,
+        0x9732, 0x9b6f, 0x9dfa, 0x788c, 0x797f, 0x7da0, 0x83c9, 0x9304,
+    },
+    {
+        0x9e7f, 0x8ad6, 0x58df, 0x5f04, 0x7c60, 0x807e, 0x7262, 0x78ca,
+        0x8cc2, 0x96f7, 0x58d8, 0x5c62, 0x6a13, 0x6dda, 0x6f0f, 0x7d2f,
+        0x7e37, 0x964b, 0x52d2, 0x808b, 0x51dc, 0x51cc, 0x7a1c, 0x7dbe,
+        0x83f1, 0x9675, 0x8b80, 0x62cf, 0x6a02, 0x8afe, 0x4e39, 0x5be7,
+        0x6012, 0x7387, 0x7570, 0x5317, 0x78fb, 0x4fbf, 0x5fa9, 0x4e0d,
+        0x6ccc, 0x6578, 0x7d22, 0x53c3, 0x585e, 0x7701, 0x8449, 0x8aaa,
+        0x6bba, 0x8fb0, 0x6c88, 0x62fe, 0x82e5, 0x63a0, 0x7565, 0x4eae,
+        0x5169, 0x51c9, 0x6881, 0x7ce7, 0x826f, 0x8ad2, 0x91cf, 0x52f5,
+    },
+    {
+        0x5442, 0x5973, 0x5eec, 0x65c5, 0x6ffe, 0x792a, 0x95ad, 0x9a6a,
+        0x9e97, 0x9ece, 0x529b, 0x66c6, 0x6b77, 0x8f62, 0x5e74, 0x6190,
+        0x6200, 0x649a, 0x6f23, 0x7149, 0x7489, 0x79ca, 0x7df4, 0x806f,
+        0x8f26, 0x84ee, 0x9023, 0x934a, 0x5217, 0x52a3, 0x54bd, 0x70c8,
+        0x88c2, 0x8aaa, 0x5ec9, 0x5ff5, 0x637b, 0x6bae, 0x7c3e, 0x7375,
+        0x4ee4, 0x56f9, 0x5be7, 0x5dba, 0x601c, 0x73b2, 0x7469, 0x7f9a,
+        0x8046, 0x9234, 0x96f6, 0x9748, 0x9818, 0x4f8b, 0x79ae, 0x91b4,
+        0x96b8, 0x60e1, 0x4e86, 0x50da, 0x5bee, 0x5c3f, 0x6599, 0x6a02,
+    },
+    {
+        0x71ce, 0x7642, 0x84fc, 0x907c, 0x9f8d, 0x6688, 0x962e, 0x5289,
+        0x677b, 0x67f3, 0x6d41, 0x6e9c, 0x7409, 0x7559, 0x786b, 0x7d10,
+        0x985e, 0x516d, 0x622e, 0x9678, 0x502b, 0x5d19, 0x6dea, 0x8f2a,
+        0x5f8b, 0x6144, 0x6817, 0x7387, 0x9686, 0x5229, 0x540f, 0x5c65,
+        0x6613, 0x674e, 0x68a8, 0x6ce5, 0x7406, 0x75e2, 0x7f79, 0x88cf,
+        0x88e1, 0x91cc, 0x96e2, 0x533f, 0x6eba, 0x541d, 0x71d0, 0x7498,
+        0x85fa, 0x96a3, 0x9c57, 0x9e9f, 0x6797, 0x6dcb, 0x81e8, 0x7acb,
+        0x7b20, 0x7c92, 0x72c0, 0x7099, 0x8b58, 0x4ec0, 0x8336, 0x523a,
+    },
+    {
+        0x5207, 0x5ea6, 0x62d3, 0x7cd6, 0x5b85, 0x6d1e, 0x66b4, 0x8f3b,
+        0x884c, 0x964d, 0x898b, 0x5ed3, 0x5140, 0x55c0, 0x0000, 0x0000,
+        0x585a, 0x0000, 0x6674, 0x0000, 0x0000, 0x51de, 0x732a, 0x76ca,
+        0x793c, 0x795e, 0x7965, 0x798f, 0x9756, 0x7cbe, 0x7fbd, 0x0000,
+        0x8612, 0x0000, 0x8af8, 0x0000, 0x0000, 0x9038, 0x90fd, 0x0000,
+        0x0000, 0x0000, 0x98ef, 0x98fc, 0x9928, 0x9db4, 0x90de, 0x96b7,
+        0x4fae, 0x50e7, 0x514d, 0x52c9, 0x52e4, 0x5351, 0x559d, 0x5606,
+        0x5668, 0x5840, 0x58a8, 0x5c64, 0x5c6e, 0x6094, 0x6168, 0x618e,
+    },
+    {
+        0x61f2, 0x654f, 0x65e2, 0x6691, 0x6885, 0x6d77, 0x6e1a, 0x6f22,
+        0x716e, 0x722b, 0x7422, 0x7891, 0x793e, 0x7949, 0x7948, 0x7950,
+        0x7956, 0x795d, 0x798d, 0x798e, 0x7a40, 0x7a81, 0x7bc0, 0x7df4,
+        0x7e09, 0x7e41, 0x7f72, 0x8005, 0x81ed, 0x8279, 0x8279, 0x8457,
+        0x8910, 0x8996, 0x8b01, 0x8b39, 0x8cd3, 0x8d08, 0x8fb6, 0x9038,
+        0x96e3, 0x97ff, 0x983b, 0x6075, 0xd9b9, 0x8218, 0x0000, 0x0000,
+        0x4e26, 0x51b5, 0x5168, 0x4f80, 0x5145, 0x5180, 0x52c7, 0x52fa,
+        0x559d, 0x5555, 0x5599, 0x55e2, 0x585a, 0x58b3, 0x5944, 0x5954,
+    },
+    {
+        0x5a62, 0x5b28, 0x5ed2, 0x5ed9, 0x5f69, 0x5fad, 0x60d8, 0x614e,
+        0x6108, 0x618e, 0x6160, 0x61f2, 0x6234, 0x63c4, 0x641c, 0x6452,
+        0x6556, 0x6674, 0x6717, 0x671b, 0x6756, 0x6b79, 0x6bba, 0x6d41,
+        0x6edb, 0x6ecb, 0x6f22, 0x701e, 0x716e, 0x77a7, 0x7235, 0x72af,
+        0x732a, 0x7471, 0x7506, 0x753b, 0x761d, 0x761f, 0x76ca, 0x76db,
+        0x76f4, 0x774a, 0x7740, 0x78cc, 0x7ab1, 0x7bc0, 0x7c7b, 0x7d5b,
+        0x7df4, 0x7f3e, 0x8005, 0x8352, 0x83ef, 0x8779, 0x8941, 0x8986,
+        0x8996, 0x8abf, 0x8af8, 0x8acb, 0x8b01, 0x8afe, 0x8aed, 0x8b39,
+    },
+    {
+        0x8b8a, 0x8d08, 0x8f38, 0x9072, 0x9199, 0x9276, 0x967c, 0x96e3,
+        0x9756, 0x97db, 0x97ff, 0x980b, 0x983b, 0x9b12, 0x9f9c, 0xd9bb,
+        0xd9bd, 0xd9bf, 0x3b9d, 0x4018, 0x4039, 0xd9c1, 0xd9c3, 0xd9c5,
+        0x9f43, 0x9f8e, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0xd9c7, 0xd9ca, 0xd9cd, 0xd9d0, 0xd9d4, 0xd9d8, 0xd9d8, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0xd9db, 0xd9de, 0xd9e1, 0xd9e4, 0xd9e7,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xd9ea, 0x0000, 0xd9ed,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0xd9f0, 0xd9f3, 0xd9f6, 0xd9fa, 0xd9fe, 0xda01,
+        0xda04, 0xda07, 0xda0a, 0xda0d, 0xda10, 0xda13, 0xda16, 0x0000,
+        0xda19, 0xda1c, 0xda1f, 0xda22, 0xda25, 0x0000, 0xda28, 0x0000,
+    },
+    {
+        0xda2b, 0xda2e, 0x0000, 0xda31, 0xda34, 0x0000, 0xda37, 0xda3a,
+        0xda3d, 0xda40, 0xda43, 0xda46, 0xda49, 0xda4c, 0xda4f, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0xff41, 0xff42, 0xff43, 0xff44, 0xff45, 0xff46, 0xff47,
+        0xff48, 0xff49, 0xff4a, 0xff4b, 0xff4c, 0xff4d, 0xff4e, 0xff4f,
+        0xff50, 0xff51, 0xff52, 0xff53, 0xff54, 0xff55, 0xff56, 0xff57,
+        0xff58, 0xff59, 0xff5a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0428, 0x0429, 0x042a, 0x042b, 0x042c, 0x042d, 0x042e, 0x042f,
+        0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+        0x0438, 0x0439, 0x043a, 0x043b, 0x043c, 0x043d, 0x043e, 0x043f,
+        0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+        0x0448, 0x0449, 0x044a, 0x044b, 0x044c, 0x044d, 0x044e, 0x044f,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x04d8, 0x04d9, 0x04da, 0x04db, 0x04dc, 0x04dd, 0x04de, 0x04df,
+        0x04e0, 0x04e1, 0x04e2, 0x04e3, 0x04e4, 0x04e5, 0x04e6, 0x04e7,
+    },
+    {
+        0x04e8, 0x04e9, 0x04ea, 0x04eb, 0x04ec, 0x04ed, 0x04ee, 0x04ef,
+        0x04f0, 0x04f1, 0x04f2, 0x04f3, 0x04f4, 0x04f5, 0x04f6, 0x04f7,
+        0x04f8, 0x04f9, 0x04fa, 0x04fb, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0597, 0x0598, 0x0599, 0x059a, 0x059b, 0x059c, 0x059d, 0x059e,
+        0x059f, 0x05a0, 0x05a1, 0x0000, 0x05a3, 0x05a4, 0x05a5, 0x05a6,
+    },
+    {
+        0x05a7, 0x05a8, 0x05a9, 0x05aa, 0x05ab, 0x05ac, 0x05ad, 0x05ae,
+        0x05af, 0x05b0, 0x05b1, 0x0000, 0x05b3, 0x05b4, 0x05b5, 0x05b6,
+        0x05b7, 0x05b8, 0x05b9, 0x0000, 0x05bb, 0x05bc, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0cc0, 0x0cc1, 0x0cc2, 0x0cc3, 0x0cc4, 0x0cc5, 0x0cc6, 0x0cc7,
+        0x0cc8, 0x0cc9, 0x0cca, 0x0ccb, 0x0ccc, 0x0ccd, 0x0cce, 0x0ccf,
+        0x0cd0, 0x0cd1, 0x0cd2, 0x0cd3, 0x0cd4, 0x0cd5, 0x0cd6, 0x0cd7,
+        0x0cd8, 0x0cd9, 0x0cda, 0x0cdb, 0x0cdc, 0x0cdd, 0x0cde, 0x0cdf,
+        0x0ce0, 0x0ce1, 0x0ce2, 0x0ce3, 0x0ce4, 0x0ce5, 0x0ce6, 0x0ce7,
+        0x0ce8, 0x0ce9, 0x0cea, 0x0ceb, 0x0cec, 0x0ced, 0x0cee, 0x0cef,
+        0x0cf0, 0x0cf1, 0x0cf2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0xda52, 0x0000, 0xda55, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0xda58, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xda5b, 0xda5e,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0xda61, 0xda64, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0xda67, 0xda6a, 0x0000, 0xda6d, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0xda70, 0xda73, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x18c0, 0x18c1, 0x18c2, 0x18c3, 0x18c4, 0x18c5, 0x18c6, 0x18c7,
+        0x18c8, 0x18c9, 0x18ca, 0x18cb, 0x18cc, 0x18cd, 0x18ce, 0x18cf,
+        0x18d0, 0x18d1, 0x18d2, 0x18d3, 0x18d4, 0x18d5, 0x18d6, 0x18d7,
+        0x18d8, 0x18d9, 0x18da, 0x18db, 0x18dc, 0x18dd, 0x18de, 0x18df,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0xda76, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x6e60, 0x6e61, 0x6e62, 0x6e63, 0x6e64, 0x6e65, 0x6e66, 0x6e67,
+        0x6e68, 0x6e69, 0x6e6a, 0x6e6b, 0x6e6c, 0x6e6d, 0x6e6e, 0x6e6f,
+        0x6e70, 0x6e71, 0x6e72, 0x6e73, 0x6e74, 0x6e75, 0x6e76, 0x6e77,
+        0x6e78, 0x6e79, 0x6e7a, 0x6e7b, 0x6e7c, 0x6e7d, 0x6e7e, 0x6e7f,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xda79, 0xda7c,
+        0xda7f, 0xda83, 0xda87, 0xda8b, 0xda8f, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0xda93, 0xda96, 0xda99, 0xda9d, 0xdaa1,
+    },
+    {
+        0xdaa5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0xe922, 0xe923, 0xe924, 0xe925, 0xe926, 0xe927, 0xe928, 0xe929,
+        0xe92a, 0xe92b, 0xe92c, 0xe92d, 0xe92e, 0xe92f, 0xe930, 0xe931,
+        0xe932, 0xe933, 0xe934, 0xe935, 0xe936, 0xe937, 0xe938, 0xe939,
+        0xe93a, 0xe93b, 0xe93c, 0xe93d, 0xe93e, 0xe93f, 0xe940, 0xe941,
+        0xe942, 0xe943, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+    {
+        0xdaa9, 0xdaab, 0xdaad, 0x0122, 0xdaaf, 0xdab1, 0xdab3, 0xdab5,
+        0xdab7, 0xdab9, 0xdabb, 0xdabd, 0xdabf, 0x063a, 0xdac1, 0xdac3,
+        0xdac5, 0xdac7, 0x051c, 0xdac9, 0xdacb, 0xdacd, 0x054b, 0xdacf,
+        0xdad1, 0xdad3, 0xdad5, 0xdad7, 0x91df, 0xdad9, 0xdadb, 0xdadd,
+        0xdadf, 0xdae1, 0xdae3, 0xdae5, 0xdae7, 0xdae9, 0xdaeb, 0xdaed,
+        0xdaef, 0xdaf1, 0xdaf3, 0xdaf5, 0xdaf7, 0xdaf9, 0xdafb, 0xdafd,
+        0xdaff, 0xdb01, 0xdb01, 0xdb01, 0x0a2c, 0xdb03, 0xdb05, 0xdb07,
+        0x0b63, 0xdb09, 0xdb0b, 0xdb0d, 0xdb0f, 0xdb11, 0xdb13, 0xdb15,
+    },
+    {
+        0xdb17, 0xdb19, 0xdb1b, 0xdb1d, 0xdb1f, 0xdb21, 0xdb21, 0xdb23,
+        0xdb25, 0xdb27, 0xdb29, 0xdb2b, 0xdb2d, 0xdb2f, 0xdb31, 0xdb33,
+        0xdb35, 0xdb37, 0xdb39, 0xdb3b, 0xdb3d, 0xdb3f, 0xdb41, 0xdb43,
+        0xdb45, 0x14e4, 0xdb47, 0xdb49, 0xdb4b, 0xdb4d, 0xdb4f, 0xdb51,
+        0x16a8, 0x16ea, 0xdb53, 0xdb55, 0xdb57, 0xdb59, 0xdb5b, 0xdb5d,
+        0xdb5f, 0xdb61, 0xdb63, 0xdb63, 0x19c8, 0xdb65, 0xdb67, 0xdb69,
+        0xdb6b, 0x1b18, 0xdb6d, 0xdb6f, 0xdb71, 0xdb73, 0xdb75, 0xdb77,
+        0xdb79, 0xdb7b, 0xdb7d, 0x1de4, 0xdb7f, 0x1de6, 0xdb81, 0xdb83,
+    },
+    {
+        0xdb85, 0xdb87, 0xdb89, 0xdb8b, 0xdb8d, 0xdb8f, 0xdb91, 0xdb93,
+        0xdb95, 0x2183, 0xdb97, 0xdb99, 0xdb9b, 0xdb9d, 0xdb9f, 0xa392,
+        0xdba1, 0x2331, 0x2331, 0xdba3, 0xdba5, 0xdba5, 0xdba7, 0x32b8,
+        0x61da, 0xdba9, 0xdbab, 0xdbad, 0xdbaf, 0xdbb1, 0xdbb3, 0xdbb5,
+        0xdbb7, 0xdbb9, 0xdbbb, 0xdbbd, 0x26d4, 0xdbbf, 0xdbc1, 0xdbc3,
+        0xdbc5, 0xdbc3, 0xdbc7, 0xdbc9, 0xdbcb, 0xdbcd, 0xdbcf, 0xdbd1,
+        0xdbd3, 0xdbd5, 0xdbd7, 0xdbd9, 0xdbdb, 0xdbdd, 0xdbdf, 0xdbe1,
+        0x2b0c, 0xdbe3, 0xdbe5, 0xdbe7, 0xdbe9, 0xdbeb, 0x2bf1, 0xdbed,
+    },
+    {
+        0xdbef, 0xdbf1, 0xdbf3, 0xdbf5, 0xdbf7, 0xdbf9, 0xdbfb, 0xdbfd,
+        0xdbff, 0xdc01, 0x300a, 0xdc03, 0xdc05, 0xdc07, 0xdc09, 0xdc0b,
+        0xdc0d, 0xdc0f, 0xdc11, 0xdc13, 0xdc15, 0xdc17, 0xdc19, 0xdc1b,
+        0xdc1d, 0xdc1f, 0xdc21, 0xdc23, 0xdc25, 0x33c3, 0xdc27, 0xdc29,
+        0xdc2b, 0xdc2d, 0xdc2f, 0x346d, 0xdc31, 0xdc33, 0xdc35, 0xdc37,
+        0xdc39, 0xdc3b, 0xdc3d, 0xdc3f, 0x36a3, 0xdc41, 0xdc43, 0xdc45,
+        0x38a7, 0xdc47, 0xdc49, 0xdc4b, 0xdc4d, 0xdc4f, 0xdc51, 0x3a8d,
+        0x1d0b, 0x3afa, 0xdc53, 0x3cbc, 0xdc55, 0xdc57, 0xdc59, 0xdc5b,
+    },
+    {
+        0xdc5d, 0xdc5f, 0xdc61, 0xdc63, 0xdc65, 0xdc67, 0x3d1e, 0xdc69,
+        0xdc6b, 0xdc6d, 0xdc6f, 0xdc71, 0xdc73, 0x3ed1, 0xdc75, 0xdc77,
+        0x3f5e, 0x3f8e, 0xdc79, 0xdc7b, 0xdc7d, 0xdc7f, 0xdc81, 0xdc83,
+        0xdc85, 0xdc87, 0xdc89, 0x0525, 0xdc8b, 0x4263, 0xdc8d, 0x43ab,
+        0xdc8f, 0xdc91, 0xdc93, 0x4608, 0xdc95, 0xdc97, 0x4735, 0x4814,
+        0xdc99, 0xdc9b, 0xdc9d, 0xdc9f, 0xdca1, 0xdca1, 0xdca3, 0xdca5,
+        0xdca7, 0xdca9, 0xdcab, 0xdcad, 0xdcaf, 0x4c36, 0xdcb1, 0x4c92,
+        0xdcb3, 0x219f, 0xdcb5, 0x4fa1, 0x4fb8, 0x5044, 0xdcb7, 0xdcb9,
+    },
+    {
+        0xdcbb, 0x50f3, 0x50f2, 0x5119, 0x5133, 0xdcbd, 0xdcbf, 0xdcbf,
+        0xdcc1, 0xdcc3, 0xdcc5, 0xdcc7, 0xdcc9, 0x541d, 0xdccb, 0xdccd,
+        0xdccf, 0xdcd1, 0x5626, 0xdcd3, 0x569a, 0x56c5, 0xdcd5, 0xdcd7,
+        0xdcd9, 0xdcdb, 0xdcdd, 0xdcdf, 0x597c, 0x5aa7, 0x5aa7, 0xdce1,
+        0xdce3, 0x5bab, 0xdce5, 0xdce7, 0xdce9, 0x5c80, 0xdceb, 0xdced,
+        0xdcef, 0xdcf1, 0xdcf3, 0x5f86, 0xdcf5, 0xdcf7, 0xdcf9, 0xdcfb,
+        0xdcfd, 0xdcff, 0x6228, 0x6247, 0xdd01, 0x62d9, 0xdd03, 0x633e,
+        0xdd05, 0xdd07, 0xdd09, 0x64da, 0x6523, 0xdd0b, 0x65a8, 0xdd0d,
+    },
+    {
+        0x335f, 0xdd0f, 0xdd11, 0xdd13, 0xdd15, 0xdd17, 0xdd19, 0x67a7,
+        0x67b5, 0x3393, 0x339c, 0xdba3, 0xdd1b, 0xdd1d, 0xdd1f, 0xdd21,
+        0xdd23, 0xdd25, 0xdd27, 0xdd29, 0xdd2b, 0xdd2d, 0xdd2f, 0x6b3c,
+        0xdd31, 0xdd33, 0xdd35, 0xdd37, 0xdd39, 0xdd3b, 0xdd3d, 0xdd3f,
+        0xdd41, 0xdd43, 0xdd45, 0xdd47, 0x6c36, 0x6d6b, 0x6cd5, 0xdd49,
+        0xdd4b, 0xdd4d, 0xdd4f, 0x73ca, 0xdd51, 0x6f2c, 0xdd53, 0xdd55,
+        0x6fb1, 0x70d2, 0xdd57, 0xdd59, 0xdd5b, 0xdd5d, 0xdd5f, 0xdd61,
+        0xdd63, 0xdd65, 0xdd67, 0xdd69, 0xdd6b, 0xdd6d, 0xdd6f, 0xdd71,
+    },
+    {
+        0xdd73, 0xdd75, 0xdd77, 0xdd79, 0xdd7b, 0x7667, 0xdd7d, 0xdd7f,
+        0xdd81, 0xdd83, 0xdd85, 0x78ae, 0x7966, 0xdd87, 0xdd89, 0xdd8b,
+        0xdd8d, 0xdd8f, 0xdd91, 0x7ca8, 0xdd93, 0xdd95, 0xdd97, 0xdd99,
+        0x7f2f, 0x0804, 0xdd9b, 0xdd9d, 0xdd9f, 0x08de, 0xdda1, 0xdda3,
+        0x85d2, 0x85ed, 0xdda5, 0xdda7, 0xdda9, 0x872e, 0xddab, 0xddad,
+        0xddaf, 0xddb1, 0xddb3, 0xddb5, 0xddb7, 0x8bfa, 0xddb9, 0xddbb,
+        0xddbd, 0x8d77, 0xddbf, 0xddc1, 0xddc3, 0xddc5, 0x9145, 0x921a,
+        0xddc7, 0xddc9, 0xddcb, 0x940a, 0xddcd, 0x9496, 0xddcf, 0xddcf,
+    },
+    {
+        0xddd1, 0x95b6, 0xddd3, 0xddd5, 0xddd7, 0xddd9, 0xdddb, 0xdddd,
+        0xdddf, 0x9b30, 0xdde1, 0xdde3, 0xdde5, 0xdde7, 0xdde9, 0xddeb,
+        0xa0ce, 0xdded, 0xa105, 0xa20e, 0xa291, 0xddef, 0xddf1, 0xddf3,
+        0xddf5, 0xddf7, 0xddf9, 0xddfb, 0xddfd, 0xa600, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+        0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    },
+};
+
+static const uint32_t kEdistFoldPool[] = {
+    0x00002, 0x00073, 0x00073, 0x00002, 0x002bc, 0x0006e,
+    0x00000, 0x00002, 0x00565, 0x00582, 0x00002, 0x00627,
+    0x00653, 0x00002, 0x00627, 0x00654, 0x00002, 0x00648,
+    0x00654, 0x00002, 0x00627, 0x00655, 0x00002, 0x0064a,
+    0x00654, 0x00002, 0x006d5, 0x00654, 0x00002, 0x006c1,
+    0x00654, 0x00002, 0x006d2, 0x00654, 0x00002, 0x00928,
+    0x0093c, 0x00002, 0x00930, 0x0093c, 0x00002, 0x00933,
+    0x0093c, 0x00002, 0x00915, 0x0093c, 0x00002, 0x00916,
+    0x0093c, 0x00002, 0x00917, 0x0093c, 0x00002, 0x0091c,
+    0x0093c, 0x00002, 0x00921, 0x0093c, 0x00002, 0x00922,
+    0x0093c, 0x00002, 0x0092b, 0x0093c, 0x00002, 0x0092f,
+    0x0093c, 0x00002, 0x009c7, 0x009be, 0x00002, 0x009c7,
+    0x009d7, 0x00002, 0x009a1, 0x009bc, 0x00002, 0x009a2,
+    0x009bc, 0x00002, 0x009af, 0x009bc, 0x00002, 0x00a32,
+    0x00a3c, 0x00002, 0x00a38, 0x00a3c, 0x00002, 0x00a16,
+    0x00a3c, 0x00002, 0x00a17, 0x00a3c, 0x00002, 0x00a1c,
+    0x00a3c, 0x00002, 0x00a2b, 0x00a3c, 0x00002, 0x00b47,
+    0x00b56, 0x00002, 0x00b47, 0x00b3e, 0x00002, 0x00b47,
+    0x00b57, 0x00002, 0x00b21, 0x00b3c, 0x00002, 0x00b22,
+    0x00b3c, 0x00002, 0x00b92, 0x00bd7, 0x00002, 0x00bc6,
+    0x00bbe, 0x00002, 0x00bc7, 0x00bbe, 0x00002, 0x00bc6,
+    0x00bd7, 0x00002, 0x00c46, 0x00c56, 0x00002, 0x00cbf,
+    0x00cd5, 0x00002, 0x00cc6, 0x00cd5, 0x00002, 0x00cc6,
+    0x00cd6, 0x00002, 0x00cc6, 0x00cc2, 0x00003, 0x00cc6,
+    0x00cc2, 0x00cd5, 0x00002, 0x00d46, 0x00d3e, 0x00002,
+    0x00d47, 0x00d3e, 0x00002, 0x00d46, 0x00d57, 0x00002,
+    0x00dd9, 0x00dca, 0x00002, 0x00dd9, 0x00dcf, 0x00003,
+    0x00dd9, 0x00dcf, 0x00dca, 0x00002, 0x00dd9, 0x00ddf,
+    0x00002, 0x00f42, 0x00fb7, 0x00002, 0x00f4c, 0x00fb7,
+    0x00002, 0x00f51, 0x00fb7, 0x00002, 0x00f56, 0x00fb7,
+    0x00002, 0x00f5b, 0x00fb7, 0x00002, 0x00f40, 0x00fb5,
+    0x00002, 0x00f71, 0x00f72, 0x00002, 0x00f71, 0x00f74,
+    0x00002, 0x00fb2, 0x00f80, 0x00002, 0x00fb3, 0x00f80,
+    0x00002, 0x00f71, 0x00f80, 0x00002, 0x00f92, 0x00fb7,
+    0x00002, 0x00f9c, 0x00fb7, 0x00002, 0x00fa1, 0x00fb7,
+    0x00002, 0x00fa6, 0x00fb7, 0x00002, 0x00fab, 0x00fb7,
+    0x00002, 0x00f90, 0x00fb5, 0x00002, 0x01025, 0x0102e,
+    0x00002, 0x01b05, 0x01b35, 0x00002, 0x01b07, 0x01b35,
+    0x00002, 0x01b09, 0x01b35, 0x00002, 0x01b0b, 0x01b35,
+    0x00002, 0x01b0d, 0x01b35, 0x00002, 0x01b11, 0x01b35,
+    0x00002, 0x01b3a, 0x01b35, 0x00002, 0x01b3c, 0x01b35,
+    0x00002, 0x01b3e, 0x01b35, 0x00002, 0x01b3f, 0x01b35,
+    0x00002, 0x01b42, 0x01b35, 0x00002, 0x00061, 0x002be,
+    0x00002, 0x003b1, 0x003b9, 0x00002, 0x003b7, 0x003b9,
+    0x00002, 0x003c9, 0x003b9, 0x00002, 0x0304b, 0x03099,
+    0x00002, 0x0304d, 0x03099, 0x00002, 0x0304f, 0x03099,
+    0x00002, 0x03051, 0x03099, 0x00002, 0x03053, 0x03099,
+    0x00002, 0x03055, 0x03099, 0x00002, 0x03057, 0x03099,
+    0x00002, 0x03059, 0x03099, 0x00002, 0x0305b, 0x03099,
+    0x00002, 0x0305d, 0x03099, 0x00002, 0x0305f, 0x03099,
+    0x00002, 0x03061, 0x03099, 0x00002, 0x03064, 0x03099,
+    0x00002, 0x03066, 0x03099, 0x00002, 0x03068, 0x03099,
+    0x00002, 0x0306f, 0x03099, 0x00002, 0x0306f, 0x0309a,
+    0x00002, 0x03072, 0x03099, 0x00002, 0x03072, 0x0309a,
+    0x00002, 0x03075, 0x03099, 0x00002, 0x03075, 0x0309a,
+    0x00002, 0x03078, 0x03099, 0x00002, 0x03078, 0x0309a,
+    0x00002, 0x0307b, 0x03099, 0x00002, 0x0307b, 0x0309a,
+    0x00002, 0x03046, 0x03099, 0x00002, 0x0309d, 0x03099,
+    0x00002, 0x030ab, 0x03099, 0x00002, 0x030ad, 0x03099,
+    0x00002, 0x030af, 0x03099, 0x00002, 0x030b1, 0x03099,
+    0x00002, 0x030b3, 0x03099, 0x00002, 0x030b5, 0x03099,
+    0x00002, 0x030b7, 0x03099, 0x00002, 0x030b9, 0x03099,
+    0x00002, 0x030bb, 0x03099, 0x00002, 0x030bd, 0x03099,
+    0x00002, 0x030bf, 0x03099, 0x00002, 0x030c1, 0x03099,
+    0x00002, 0x030c4, 0x03099, 0x00002, 0x030c6, 0x03099,
+    0x00002, 0x030c8, 0x03099, 0x00002, 0x030cf, 0x03099,
+    0x00002, 0x030cf, 0x0309a, 0x00002, 0x030d2, 0x03099,
+    0x00002, 0x030d2, 0x0309a, 0x00002, 0x030d5, 0x03099,
+    0x00002, 0x030d5, 0x0309a, 0x00002, 0x030d8, 0x03099,
+    0x00002, 0x030d8, 0x0309a, 0x00002, 0x030db, 0x03099,
+    0x00002, 0x030db, 0x0309a, 0x00002, 0x030a6, 0x03099,
+    0x00002, 0x030ef, 0x03099, 0x00002, 0x030f0, 0x03099,
+    0x00002, 0x030f1, 0x03099, 0x00002, 0x030f2, 0x03099,
+    0x00002, 0x030fd, 0x03099, 0x00001, 0x242ee, 0x00001,
+    0x2284a, 0x00001, 0x22844, 0x00001, 0x233d5, 0x00001,
+    0x25249, 0x00001, 0x25cd0, 0x00001, 0x27ed3, 0x00002,
+    0x00066, 0x00066, 0x00002, 0x00066, 0x00069, 0x00002,
+    0x00066, 0x0006c, 0x00003, 0x00066, 0x00066, 0x00069,
+    0x00003, 0x00066, 0x00066, 0x0006c, 0x00002, 0x00073,
+    0x00074, 0x00002, 0x00574, 0x00576, 0x00002, 0x00574,
+    0x00565, 0x00002, 0x00574, 0x0056b, 0x00002, 0x0057e,
+    0x00576, 0x00002, 0x00574, 0x0056d, 0x00002, 0x005d9,
+    0x005b4, 0x00002, 0x005f2, 0x005b7, 0x00002, 0x005e9,
+    0x005c1, 0x00002, 0x005e9, 0x005c2, 0x00003, 0x005e9,
+    0x005bc, 0x005c1, 0x00003, 0x005e9, 0x005bc, 0x005c2,
+    0x00002, 0x005d0, 0x005b7, 0x00002, 0x005d0, 0x005b8,
+    0x00002, 0x005d0, 0x005bc, 0x00002, 0x005d1, 0x005bc,
+    0x00002, 0x005d2, 0x005bc, 0x00002, 0x005d3, 0x005bc,
+    0x00002, 0x005d4, 0x005bc, 0x00002, 0x005d5, 0x005bc,
+    0x00002, 0x005d6, 0x005bc, 0x00002, 0x005d8, 0x005bc,
+    0x00002, 0x005d9, 0x005bc, 0x00002, 0x005da, 0x005bc,
+    0x00002, 0x005db, 0x005bc, 0x00002, 0x005dc, 0x005bc,
+    0x00002, 0x005de, 0x005bc, 0x00002, 0x005e0, 0x005bc,
+    0x00002, 0x005e1, 0x005bc, 0x00002, 0x005e3, 0x005bc,
+    0x00002, 0x005e4, 0x005bc, 0x00002, 0x005e6, 0x005bc,
+    0x00002, 0x005e7, 0x005bc, 0x00002, 0x005e8, 0x005bc,
+    0x00002, 0x005e9, 0x005bc, 0x00002, 0x005ea, 0x005bc,
+    0x00002, 0x005d5, 0x005b9, 0x00002, 0x005d1, 0x005bf,
+    0x00002, 0x005db, 0x005bf, 0x00002, 0x005e4, 0x005bf,
+    0x00002, 0x11099, 0x110ba, 0x00002, 0x1109b, 0x110ba,
+    0x00002, 0x110a5, 0x110ba, 0x00002, 0x11131, 0x11127,
+    0x00002, 0x11132, 0x11127, 0x00002, 0x11347, 0x1133e,
+    0x00002, 0x11347, 0x11357, 0x00002, 0x114b9, 0x114ba,
+    0x00002, 0x114b9, 0x114b0, 0x00002, 0x114b9, 0x114bd,
+    0x00002, 0x115b8, 0x115af, 0x00002, 0x115b9, 0x115af,
+    0x00002, 0x11935, 0x11930, 0x00002, 0x1d157, 0x1d165,
+    0x00002, 0x1d158, 0x1d165, 0x00003, 0x1d158, 0x1d165,
+    0x1d16e, 0x00003, 0x1d158, 0x1d165, 0x1d16f, 0x00003,
+    0x1d158, 0x1d165, 0x1d170, 0x00003, 0x1d158, 0x1d165,
+    0x1d171, 0x00003, 0x1d158, 0x1d165, 0x1d172, 0x00002,
+    0x1d1b9, 0x1d165, 0x00002, 0x1d1ba, 0x1d165, 0x00003,
+    0x1d1b9, 0x1d165, 0x1d16e, 0x00003, 0x1d1ba, 0x1d165,
+    0x1d16e, 0x00003, 0x1d1b9, 0x1d165, 0x1d16f, 0x00003,
+    0x1d1ba, 0x1d165, 0x1d16f, 0x00001, 0x04e3d, 0x00001,
+    0x04e38, 0x00001, 0x04e41, 0x00001, 0x04f60, 0x00001,
+    0x04fae, 0x00001, 0x04fbb, 0x00001, 0x05002, 0x00001,
+    0x0507a, 0x00001, 0x05099, 0x00001, 0x050e7, 0x00001,
+    0x050cf, 0x00001, 0x0349e, 0x00001, 0x0514d, 0x00001,
+    0x05154, 0x00001, 0x05164, 0x00001, 0x05177, 0x00001,
+    0x034b9, 0x00001, 0x05167, 0x00001, 0x0518d, 0x00001,
+    0x05197, 0x00001, 0x051a4, 0x00001, 0x04ecc, 0x00001,
+    0x051ac, 0x00001, 0x051b5, 0x00001, 0x051f5, 0x00001,
+    0x05203, 0x00001, 0x034df, 0x00001, 0x0523b, 0x00001,
+    0x05246, 0x00001, 0x05272, 0x00001, 0x05277, 0x00001,
+    0x03515, 0x00001, 0x052c7, 0x00001, 0x052c9, 0x00001,
+    0x052e4, 0x00001, 0x052fa, 0x00001, 0x05305, 0x00001,
+    0x05306, 0x00001, 0x05317, 0x00001, 0x05349, 0x00001,
+    0x05351, 0x00001, 0x0535a, 0x00001, 0x05373, 0x00001,
+    0x0537d, 0x00001, 0x0537f, 0x00001, 0x07070, 0x00001,
+    0x053ca, 0x00001, 0x053df, 0x00001, 0x053eb, 0x00001,
+    0x053f1, 0x00001, 0x05406, 0x00001, 0x0549e, 0x00001,
+    0x05438, 0x00001, 0x05448, 0x00001, 0x05468, 0x00001,
+    0x054a2, 0x00001, 0x054f6, 0x00001, 0x05510, 0x00001,
+    0x05553, 0x00001, 0x05563, 0x00001, 0x05584, 0x00001,
+    0x05599, 0x00001, 0x055ab, 0x00001, 0x055b3, 0x00001,
+    0x055c2, 0x00001, 0x05716, 0x00001, 0x05606, 0x00001,
+    0x05717, 0x00001, 0x05651, 0x00001, 0x05674, 0x00001,
+    0x05207, 0x00001, 0x058ee, 0x00001, 0x057ce, 0x00001,
+    0x057f4, 0x00001, 0x0580d, 0x00001, 0x0578b, 0x00001,
+    0x05832, 0x00001, 0x05831, 0x00001, 0x058ac, 0x00001,
+    0x058f2, 0x00001, 0x058f7, 0x00001, 0x05906, 0x00001,
+    0x0591a, 0x00001, 0x05922, 0x00001, 0x05962, 0x00001,
+    0x059ec, 0x00001, 0x05a1b, 0x00001, 0x05a27, 0x00001,
+    0x059d8, 0x00001, 0x05a66, 0x00001, 0x036ee, 0x00001,
+    0x036fc, 0x00001, 0x05b08, 0x00001, 0x05b3e, 0x00001,
+    0x05bc3, 0x00001, 0x05bd8, 0x00001, 0x05be7, 0x00001,
+    0x05bf3, 0x00001, 0x05bff, 0x00001, 0x05c06, 0x00001,
+    0x05f53, 0x00001, 0x05c22, 0x00001, 0x03781, 0x00001,
+    0x05c60, 0x00001, 0x05c6e, 0x00001, 0x05cc0, 0x00001,
+    0x05c8d, 0x00001, 0x05d43, 0x00001, 0x05d6e, 0x00001,
+    0x05d6b, 0x00001, 0x05d7c, 0x00001, 0x05de1, 0x00001,
+    0x05de2, 0x00001, 0x0382f, 0x00001, 0x05dfd, 0x00001,
+    0x05e28, 0x00001, 0x05e3d, 0x00001, 0x05e69, 0x00001,
+    0x03862, 0x00001, 0x0387c, 0x00001, 0x05eb0, 0x00001,
+    0x05eb3, 0x00001, 0x05eb6, 0x00001, 0x05eca, 0x00001,
+    0x05efe, 0x00001, 0x08201, 0x00001, 0x05f22, 0x00001,
+    0x038c7, 0x00001, 0x05f62, 0x00001, 0x05f6b, 0x00001,
+    0x038e3, 0x00001, 0x05f9a, 0x00001, 0x05fcd, 0x00001,
+    0x05fd7, 0x00001, 0x05ff9, 0x00001, 0x06081, 0x00001,
+    0x0393a, 0x00001, 0x0391c, 0x00001, 0x06094, 0x00001,
+    0x060c7, 0x00001, 0x06148, 0x00001, 0x0614c, 0x00001,
+    0x0614e, 0x00001, 0x0617a, 0x00001, 0x0618e, 0x00001,
+    0x061b2, 0x00001, 0x061a4, 0x00001, 0x061af, 0x00001,
+    0x061de, 0x00001, 0x061f2, 0x00001, 0x061f6, 0x00001,
+    0x06210, 0x00001, 0x0621b, 0x00001, 0x0625d, 0x00001,
+    0x062b1, 0x00001, 0x062d4, 0x00001, 0x06350, 0x00001,
+    0x0633d, 0x00001, 0x062fc, 0x00001, 0x06368, 0x00001,
+    0x06383, 0x00001, 0x063e4, 0x00001, 0x06422, 0x00001,
+    0x063c5, 0x00001, 0x063a9, 0x00001, 0x03a2e, 0x00001,
+    0x06469, 0x00001, 0x0647e, 0x00001, 0x0649d, 0x00001,
+    0x06477, 0x00001, 0x03a6c, 0x00001, 0x0654f, 0x00001,
+    0x0656c, 0x00001, 0x065e3, 0x00001, 0x066f8, 0x00001,
+    0x06649, 0x00001, 0x03b19, 0x00001, 0x06691, 0x00001,
+    0x03b08, 0x00001, 0x03ae4, 0x00001, 0x05192, 0x00001,
+    0x05195, 0x00001, 0x06700, 0x00001, 0x0669c, 0x00001,
+    0x080ad, 0x00001, 0x043d9, 0x00001, 0x06717, 0x00001,
+    0x0671b, 0x00001, 0x06721, 0x00001, 0x0675e, 0x00001,
+    0x06753, 0x00001, 0x03b49, 0x00001, 0x067fa, 0x00001,
+    0x06785, 0x00001, 0x06852, 0x00001, 0x06885, 0x00001,
+    0x0688e, 0x00001, 0x0681f, 0x00001, 0x06914, 0x00001,
+    0x03b9d, 0x00001, 0x06942, 0x00001, 0x069a3, 0x00001,
+    0x069ea, 0x00001, 0x06aa8, 0x00001, 0x06adb, 0x00001,
+    0x03c18, 0x00001, 0x06b21, 0x00001, 0x06b54, 0x00001,
+    0x03c4e, 0x00001, 0x06b72, 0x00001, 0x06b9f, 0x00001,
+    0x06bba, 0x00001, 0x06bbb, 0x00001, 0x06c4e, 0x00001,
+    0x06cbf, 0x00001, 0x06ccd, 0x00001, 0x06c67, 0x00001,
+    0x06d16, 0x00001, 0x06d3e, 0x00001, 0x06d77, 0x00001,
+    0x06d41, 0x00001, 0x06d69, 0x00001, 0x06d78, 0x00001,
+    0x06d85, 0x00001, 0x06d34, 0x00001, 0x06e2f, 0x00001,
+    0x06e6e, 0x00001, 0x03d33, 0x00001, 0x06ecb, 0x00001,
+    0x06ec7, 0x00001, 0x06df9, 0x00001, 0x06f6e, 0x00001,
+    0x06fc6, 0x00001, 0x07039, 0x00001, 0x0701e, 0x00001,
+    0x0701b, 0x00001, 0x03d96, 0x00001, 0x0704a, 0x00001,
+    0x0707d, 0x00001, 0x07077, 0x00001, 0x070ad, 0x00001,
+    0x07145, 0x00001, 0x0719c, 0x00001, 0x07228, 0x00001,
+    0x07235, 0x00001, 0x07250, 0x00001, 0x07280, 0x00001,
+    0x07295, 0x00001, 0x0737a, 0x00001, 0x0738b, 0x00001,
+    0x03eac, 0x00001, 0x073a5, 0x00001, 0x03eb8, 0x00001,
+    0x07447, 0x00001, 0x0745c, 0x00001, 0x07471, 0x00001,
+    0x07485, 0x00001, 0x074ca, 0x00001, 0x03f1b, 0x00001,
+    0x07524, 0x00001, 0x0753e, 0x00001, 0x07570, 0x00001,
+    0x07610, 0x00001, 0x03ffc, 0x00001, 0x04008, 0x00001,
+    0x076f4, 0x00001, 0x0771e, 0x00001, 0x0771f, 0x00001,
+    0x0774a, 0x00001, 0x04039, 0x00001, 0x0778b, 0x00001,
+    0x04046, 0x00001, 0x04096, 0x00001, 0x0784e, 0x00001,
+    0x0788c, 0x00001, 0x078cc, 0x00001, 0x040e3, 0x00001,
+    0x07956, 0x00001, 0x0798f, 0x00001, 0x079eb, 0x00001,
+    0x0412f, 0x00001, 0x07a40, 0x00001, 0x07a4a, 0x00001,
+    0x07a4f, 0x00001, 0x07aee, 0x00001, 0x04202, 0x00001,
+    0x07bc6, 0x00001, 0x07bc9, 0x00001, 0x04227, 0x00001,
+    0x07cd2, 0x00001, 0x042a0, 0x00001, 0x07ce8, 0x00001,
+    0x07ce3, 0x00001, 0x07d00, 0x00001, 0x07d63, 0x00001,
+    0x04301, 0x00001, 0x07dc7, 0x00001, 0x07e02, 0x00001,
+    0x07e45, 0x00001, 0x04334, 0x00001, 0x04359, 0x00001,
+    0x07f7a, 0x00001, 0x07f95, 0x00001, 0x07ffa, 0x00001,
+    0x08005, 0x00001, 0x08060, 0x00001, 0x08070, 0x00001,
+    0x043d5, 0x00001, 0x080b2, 0x00001, 0x08103, 0x00001,
+    0x0440b, 0x00001, 0x0813e, 0x00001, 0x05ab5, 0x00001,
+    0x08204, 0x00001, 0x08f9e, 0x00001, 0x0446b, 0x00001,
+    0x08291, 0x00001, 0x0828b, 0x00001, 0x0829d, 0x00001,
+    0x052b3, 0x00001, 0x082b1, 0x00001, 0x082b3, 0x00001,
+    0x082bd, 0x00001, 0x082e6, 0x00001, 0x082e5, 0x00001,
+    0x0831d, 0x00001, 0x08363, 0x00001, 0x083ad, 0x00001,
+    0x08323, 0x00001, 0x083bd, 0x00001, 0x083e7, 0x00001,
+    0x08457, 0x00001, 0x08353, 0x00001, 0x083ca, 0x00001,
+    0x083cc, 0x00001, 0x083dc, 0x00001, 0x0452b, 0x00001,
+    0x084f1, 0x00001, 0x084f3, 0x00001, 0x08516, 0x00001,
+    0x08564, 0x00001, 0x0455d, 0x00001, 0x04561, 0x00001,
+    0x0456b, 0x00001, 0x08650, 0x00001, 0x0865c, 0x00001,
+    0x08667, 0x00001, 0x08669, 0x00001, 0x086a9, 0x00001,
+    0x08688, 0x00001, 0x0870e, 0x00001, 0x086e2, 0x00001,
+    0x08779, 0x00001, 0x08728, 0x00001, 0x0876b, 0x00001,
+    0x08786, 0x00001, 0x045d7, 0x00001, 0x087e1, 0x00001,
+    0x08801, 0x00001, 0x045f9, 0x00001, 0x08860, 0x00001,
+    0x08863, 0x00001, 0x088d7, 0x00001, 0x088de, 0x00001,
+    0x04635, 0x00001, 0x088fa, 0x00001, 0x034bb, 0x00001,
+    0x046be, 0x00001, 0x046c7, 0x00001, 0x08aa0, 0x00001,
+    0x08aed, 0x00001, 0x08b8a, 0x00001, 0x08c55, 0x00001,
+    0x08cab, 0x00001, 0x08cc1, 0x00001, 0x08d1b, 0x00001,
+    0x08d77, 0x00001, 0x08dcb, 0x00001, 0x08dbc, 0x00001,
+    0x08df0, 0x00001, 0x08ed4, 0x00001, 0x08f38, 0x00001,
+    0x09094, 0x00001, 0x090f1, 0x00001, 0x09111, 0x00001,
+    0x0911b, 0x00001, 0x09238, 0x00001, 0x092d7, 0x00001,
+    0x092d8, 0x00001, 0x0927c, 0x00001, 0x093f9, 0x00001,
+    0x09415, 0x00001, 0x0958b, 0x00001, 0x04995, 0x00001,
+    0x095b7, 0x00001, 0x049e6, 0x00001, 0x096c3, 0x00001,
+    0x05db2, 0x00001, 0x09723, 0x00001, 0x04a6e, 0x00001,
+    0x04a76, 0x00001, 0x097e0, 0x00001, 0x04ab2, 0x00001,
+    0x0980b, 0x00001, 0x09829, 0x00001, 0x098e2, 0x00001,
+    0x04b33, 0x00001, 0x09929, 0x00001, 0x099a7, 0x00001,
+    0x099c2, 0x00001, 0x099fe, 0x00001, 0x04bce, 0x00001,
+    0x09b12, 0x00001, 0x09c40, 0x00001, 0x09cfd, 0x00001,
+    0x04cce, 0x00001, 0x04ced, 0x00001, 0x09d67, 0x00001,
+    0x04cf8, 0x00001, 0x09ebb, 0x00001, 0x04d56, 0x00001,
+    0x09ef9, 0x00001, 0x09efe, 0x00001, 0x09f05, 0x00001,
+    0x09f0f, 0x00001, 0x09f16, 0x00001, 0x09f3b,
+};
+
+/** Code points in a script, from first to last. */
+typedef struct edist_script_range_t {
+  uint32_t first; /** First code point. */
+  uint32_t last;  /** Last code point. */
+  uint8_t script; /** Script number. */
+} edist_script_range_t;
+
+/** Ranges of code points in each script, sorted. */
+static const edist_script_range_t kEdistScriptRanges[] = {
+    {0x00041, 0x0005a, 19}, /* latin */
+    {0x00061, 0x0007a, 19}, /* latin */
+    {0x00080, 0x000ff, 20}, /* latin1Sup */
+    {0x00100, 0x0017f, 21}, /* latinExtA */
+    {0x00180, 0x0024f, 22}, /* latinExtB */
+    {0x00370, 0x003ff, 9}, /* greekAndCoptic */
+    {0x00400, 0x004ff, 5}, /* cyrillic */
+    {0x00500, 0x0052f, 5}, /* cyrillic */
+    {0x00530, 0x0058f, 1}, /* armenian */
+    {0x00590, 0x005ff, 13}, /* hebrew */
+    {0x00600, 0x006ff, 0}, /* arabic */
+    {0x00901, 0x0097f, 6}, /* devanagari */
+    {0x00981, 0x009fb, 2}, /* bengali */
+    {0x00a00, 0x00a7f, 11}, /* gurmukhi */
+    {0x00a81, 0x00af1, 10}, /* gujarati */
+    {0x00b01, 0x00b77, 26}, /* oriya */
+    {0x00b82, 0x00bfa, 28}, /* tamil */
+    {0x00c01, 0x00c7f, 29}, /* telugu */
+    {0x00c82, 0x00cf2, 15}, /* kannada */
+    {0x00d02, 0x00d7f, 23}, /* malayalam */
+    {0x00d82, 0x00df4, 27}, /* sinhala */
+    {0x00e01, 0x00e5b, 30}, /* thai */
+    {0x00e81, 0x00edf, 18}, /* lao */
+    {0x00f00, 0x00fda, 31}, /* tibetan */
+    {0x01000, 0x0109f, 3}, /* burmese */
+    {0x010a0, 0x010ff, 8}, /* georgian */
+    {0x01100, 0x011ff, 12}, /* hangul */
+    {0x01200, 0x01399, 7}, /* ethiopic */
+    {0x01780, 0x017ff, 17}, /* khmer */
+    {0x01800, 0x018aa, 24}, /* mongolian */
+    {0x019e0, 0x019ff, 17}, /* khmer */
+    {0x01ea0, 0x01ef9, 32}, /* vietnamese */
+    {0x01f00, 0x01fff, 9}, /* greekAndCoptic */
+    {0x02de0, 0x02dff, 5}, /* cyrillic */
+    {0x02e80, 0x02eff, 4}, /* cjk */
+    {0x02f00, 0x02fdf, 4}, /* cjk */
+    {0x02ff0, 0x02fff, 4}, /* cjk */
+    {0x03000, 0x0303f, 4}, /* cjk */
+    {0x03040, 0x0309f, 14}, /* hiragana */
+    {0x030a0, 0x030ff, 16}, /* katakana */
+    {0x03105, 0x0312c, 25}, /* orientalMisc */
+    {0x03130, 0x0318f, 12}, /* hangul */
+    {0x03190, 0x0319f, 25}, /* orientalMisc */
+    {0x031a0, 0x031bf, 25}, /* orientalMisc */
+    {0x031c0, 0x031ef, 4}, /* cjk */
+    {0x031f0, 0x031ff, 16}, /* katakana */
+    {0x03200, 0x032ff, 4}, /* cjk */
+    {0x03300, 0x033ff, 4}, /* cjk */
+    {0x03400, 0x04dbf, 4}, /* cjk */
+    {0x04dc0, 0x04dff, 25}, /* orientalMisc */
+    {0x04e00, 0x09fff, 4}, /* cjk */
+    {0x0a000, 0x0a4cf, 33}, /* yi */
+    {0x0a640, 0x0a69f, 5}, /* cyrillic */
+    {0x0a960, 0x0a97f, 12}, /* hangul */
+    {0x0ac00, 0x0d7a3, 12}, /* hangul */
+    {0x0d7b0, 0x0d7ff, 12}, /* hangul */
+    {0x0f900, 0x0faff, 4}, /* cjk */
+    {0x0fe30, 0x0fe4f, 4}, /* cjk */
+    {0x20000, 0x2a6d6, 4}, /* cjk */
+    {0x2a700, 0x2b73f, 4}, /* cjk */
+    {0x2b740, 0x2b81f, 4}, /* cjk */
+    {0x2f800, 0x2fa1f, 4}, /* cjk */
+};
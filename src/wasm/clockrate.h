@@ -0,0 +1,132 @@
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+
+/*
+ * Render quantums are timestamped against the clock as they are processed.
+ * The earliest-processed quantum of each bin is the one least delayed by
+ * scheduling jitter, so only it is used for estimation.
+ */
+#define TSIG_CLOCKRATE_BIN_SECS    1
+#define TSIG_CLOCKRATE_MIN_BINS    60  /* Minimum bins before estimating. */
+#define TSIG_CLOCKRATE_WINDOW_BINS 600 /* Time constant of estimator. */
+
+/*
+ * Clock jumps (e.g. NTP steps, output underruns) begin a new segment of
+ * measurements. A jump changes the difference between clocks, but not its
+ * rate of change, so segments share one slope but not their intercepts.
+ */
+#define TSIG_CLOCKRATE_JUMP_MS 50.0
+
+/* Estimates beyond this are assumed to be wrong, not a very bad DAC. */
+#define TSIG_CLOCKRATE_MAX_PPB 1000000
+
+/**
+ * Sample clock rate estimator context.
+ *
+ * Estimates the error of the audio output device's sample clock relative to
+ * the clock by fitting, with exponentially decaying weights, a line to the
+ * difference between the elapsed time measured by each clock.
+ *
+ * Zero-initialize before first use.
+ */
+typedef struct tsig_clockrate_ctx_t {
+  uint32_t sample_rate;  /** Nominal sample rate of AudioContext. */
+  uint64_t base_samples; /** Sample count when segment began. */
+  double base_ms;        /** Clock timestamp when segment began. */
+
+  uint64_t bin_end; /** Sample count at which current bin ends. */
+  double bin_x;     /** Nominal seconds elapsed at bin's earliest quantum. */
+  double bin_y;     /** Difference in ms at bin's earliest quantum. */
+  double last_y;    /** Difference in ms at previous bin's earliest quantum. */
+  uint32_t bins;    /** Count of bins in all segments. */
+
+  double w;   /** Sum of weights in segment. */
+  double mx;  /** Weighted mean of elapsed nominal seconds in segment. */
+  double my;  /** Weighted mean of differences in segment. */
+  double cxx; /** Weighted sum of squared deviations of elapsed seconds. */
+  double cxy; /** Weighted sum of products of deviations. */
+
+  int32_t ppb; /** Latest estimate in parts per billion. */
+} tsig_clockrate_ctx_t;
+
+/**
+ * Begin a new segment of sample clock rate measurements.
+ * @param ctx Pointer to a sample clock rate estimator context.
+ * @param samples Current sample count.
+ * @param now Current clock timestamp in milliseconds.
+ * @note Needed whenever the sample count restarts, e.g. for a new
+ *  transmission. Measurements from previous segments are retained.
+ */
+static void tsig_clockrate_restart(tsig_clockrate_ctx_t *ctx, uint64_t samples,
+                                   double now) {
+  ctx->base_samples = samples;
+  ctx->base_ms = now;
+  ctx->bin_end = samples + TSIG_CLOCKRATE_BIN_SECS * ctx->sample_rate;
+  ctx->bin_y = INFINITY;
+  ctx->w = ctx->mx = ctx->my = 0;
+}
+
+/**
+ * Fold the completed bin into a sample clock rate estimate.
+ * @param ctx Pointer to a sample clock rate estimator context.
+ * @return Whether `ctx->ppb` was updated.
+ */
+static uint8_t tsig_clockrate_add_bin(tsig_clockrate_ctx_t *ctx) {
+  double x = ctx->bin_x;
+  double y = ctx->bin_y;
+
+  if (ctx->w && fabs(y - ctx->last_y) > TSIG_CLOCKRATE_JUMP_MS)
+    ctx->w = ctx->mx = ctx->my = 0;
+
+  /* West's weighted incremental update; stable over arbitrarily long runs. */
+  double decay = 1.0 - 1.0 / TSIG_CLOCKRATE_WINDOW_BINS;
+  ctx->w = decay * ctx->w + 1.0;
+  double dx = x - ctx->mx;
+  ctx->mx += dx / ctx->w;
+  ctx->my += (y - ctx->my) / ctx->w;
+  ctx->cxx = decay * ctx->cxx + dx * (x - ctx->mx);
+  ctx->cxy = decay * ctx->cxy + dx * (y - ctx->my);
+  ctx->last_y = y;
+
+  if (++ctx->bins < TSIG_CLOCKRATE_MIN_BINS || ctx->cxx <= 0)
+    return 0;
+
+  /* Slope is in ms of clock time per second of nominal sample time. */
+  double ppb = -1e6 * ctx->cxy / ctx->cxx;
+  if (fabs(ppb) > TSIG_CLOCKRATE_MAX_PPB)
+    return 0;
+
+  ctx->ppb = lround(ppb);
+  return 1;
+}
+
+/**
+ * Update a sample clock rate estimate once per render quantum.
+ * @param ctx Pointer to a sample clock rate estimator context.
+ * @param samples Sample count at the start of the render quantum.
+ * @param now Clock timestamp in milliseconds when the quantum is processed.
+ * @return Whether `ctx->ppb` was updated.
+ * @note A positive estimate means the sample clock runs fast.
+ */
+static uint8_t tsig_clockrate_update(tsig_clockrate_ctx_t *ctx,
+                                     uint64_t samples, double now) {
+  uint8_t updated = 0;
+
+  if (samples >= ctx->bin_end) {
+    if (!isinf(ctx->bin_y))
+      updated = tsig_clockrate_add_bin(ctx);
+    ctx->bin_end = samples + TSIG_CLOCKRATE_BIN_SECS * ctx->sample_rate;
+    ctx->bin_y = INFINITY;
+  }
+
+  double x = (double)(samples - ctx->base_samples) / ctx->sample_rate;
+  double y = now - ctx->base_ms - 1000.0 * x;
+  if (y < ctx->bin_y) {
+    ctx->bin_x = x;
+    ctx->bin_y = y;
+  }
+
+  return updated;
+}
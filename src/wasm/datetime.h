@@ -155,7 +155,6 @@ uint8_t tsig_datetime_is_us_dst(tsig_datetime_t datetime, uint8_t *out_end) {
     is_dst = 1;
   } else if (mon == 3 || mon == 11) {
     uint8_t sunday = mon == 3 ? 8 : 1;
-    uint8_t hour = datetime.hour;
     uint8_t day = datetime.day;
     uint8_t dow = datetime.dow;
 
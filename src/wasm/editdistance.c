@@ -3,27 +3,54 @@
  *
  * Copyright © 2023 James Seo <james@equiv.tech> (MIT license).
  *
- * Performs the specific task of computing the edit distances between one
- * query string and multiple BCP47-like locale tags or display names. (See
- * editdistance.h for a generalized edit distance mini-library.)
+ * Performs the specific task of finding the BCP47-like locale tags or display
+ * names closest to a query string by edit distance. (See editdistance.h for a
+ * generalized edit distance mini-library.)
  *
- * To ensure this module always uses the minimum possible memory of one 64 KiB
- * Wasm page, "-sSTACK_SIZE=40960 -sINITIAL_MEMORY=65536 -sMALLOC=none" or
- * something similar should be passed as emcc flags. A STACK_SIZE of 40KiB is
- * about as large as possible given the page size and the ~21KiB required for
- * the module's statically allocated internal context.
+ * Known locales are folded at build time into localetable.h by
+ * scripts/localetable.py, so that they are resident in the module from the
+ * start. User locales and queries are folded into code points once, as they
+ * are loaded and searched, by the two-level tables in casefoldingmap.h from
+ * scripts/casefoldingmap.py, which also finds the scripts they are written
+ * in, so that comparing strings is only ever a matter of comparing integers.
+ * Every tag and display name is compared with the query EDIST_LANES at a
+ * time by a bit-parallel kernel, so "-msimd128" should be passed to emcc.
+ * The kernel's state is kept from one query to the next, so that a query
+ * typed a code point at a time costs one step per tag and display name for
+ * each code point typed or deleted, rather than one per code point in it. A
+ * trigram index of the locales, built by the first search after they change,
+ * bounds each locale's score from below, so that only those that might rank
+ * are evaluated at all. A query that was not typed, such as one pasted, is
+ * instead evaluated in one walk over the tags and display names in sorted
+ * order, sharing the steps for their common prefixes as in a trie.
+ *
+ * To ensure this module always uses a predictable twelve 64 KiB Wasm pages
+ * of memory, "-sSTACK_SIZE=8192 -sINITIAL_MEMORY=786432 -sMALLOC=none" or
+ * something similar should be passed as emcc flags. The ~700KiB required for
+ * the locale table and the module's statically allocated internal context,
+ * mostly kernel state (264KiB), the arena (224KiB) and the index (~100KiB),
+ * and the ~25KiB of folding tables leave enough for the stack, which needs
+ * only a fraction of what it is given. A static assertion below keeps it so.
+ * Everything but the tables scales with `EDIST_MAX_LOCALES`. User locales
+ * are allocated from a fixed arena rather than from a heap.
  *
  * Use from JavaScript as follows:
  *
- *   0. Grab a pointer to a bidirectional buffer with edist_get_input_ptr().
+ *   0. Grab a pointer to a bidirectional buffer with edist_get_buf_ptr().
  *
- *   1. Before running each query, call edist_reset() to clear the previous
- *      search space. Then, for each locale in the new search space:
+ *   1. Once, call edist_reset(). Then, for each locale that may be searched,
+ *      in the order that ties should be broken:
  *
- *        a. Pack the locale tag and display name into the buffer as a raw
- *           u16le array, without null terminators and without separators.
+ *        a. If it is in the locale table, call edist_add_locale() with its
+ *           index there (see src/shared/localetable.ts).
  *
- *           As a contrived example, for "ab-AB" and "🖖 (D)":
+ *        b. Otherwise, pack the locale tag and display name into the buffer
+ *           as a raw u16le array, as is, without null terminators and
+ *           without separators, and call edist_load_locale() with the
+ *           lengths of both strings. Length is calculated in the same way as
+ *           String.length from JavaScript as a count of UTF-16 code units
+ *           without a null terminator. As a contrived example, for "ab-AB"
+ *           and "🖖 (D)":
  *
  *             61 00 62 00 2d 00 41 00 42 00 3d d8 96 dd 20 00 28 00 44 00 29 00
  *               a  |  b  |  -  |  A  |  B  |     🖖    |space|  (  |  D  |  )
@@ -33,61 +60,161 @@
  *           (No locale actually contains any surrogate pairs in its tag or
  *           display name, but query strings might, so just roll with it.)
  *
- *        b. Call edist_load_locale() with the lengths of both strings. Length
- *           is calculated in the same way as String.length from JavaScript as
- *           a count of UTF-16 code units without a null terminator.
+ *      Each locale is numbered by the order in which it was added or loaded,
+ *      which both functions return. A locale that cannot be added or loaded,
+ *      as when the module is full, returns `EDIST_NO_LOCALE` and takes no
+ *      number, so later locales are numbered as if it had never been.
  *
  *   2. To run a query:
- *        a. Pack the query string into the buffer as a u16le array per 1.a).
- *        b. Call edist_run_query() with the length of the string.
+ *        a. Pack the query string into the buffer as is, as a u16le array per
+ *           1.b).
+ *        b. Call edist_search() with the length of the string and a count of
+ *           locales to return.
  *
- *   3. Read results from the buffer, which has now become an array of u8.
- *      These are the lesser of editdistance(query, locale_tag) and
- *      editdistance(query, locale_display_name) for each locale previously
- *      specified in 1), given in the same order as each locale was specified.
+ *   3. Read results from the buffer, which has now become an array of u16.
+ *      These are the numbers of as many locales as edist_search() returns,
+ *      ranked by the lesser of editdistance(query, locale_tag) and
+ *      editdistance(query, locale_display_name), ties going to the locale
+ *      added first.
  *
  * Obviously, this isn't thread-safe. Arguably, it's not necessary. So what?
  */
 
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 #include <emscripten/emscripten.h>
+#include "casefoldingmap.h"
 #include "editdistance.h"
+#include "localetable.h"
 
 /*
  * Limits are set such that the reserved memory is sufficient to hold the
- * expected results of running foldUnicodeString() from src/shared/unicode.ts
- * on the locale tag or display name (e.g. "en-US"/"English (United States)").
+ * folded locale tag or display name of every known locale (e.g.
+ * "en-US"/"English (United States)"), and about ten times as many user
+ * locales, e.g. aliases of known locales by their other names. The arena
+ * holds as many code points per locale as known locales have on average,
+ * and a user locale may have longer strings, as long as it holds them.
  */
 
-#define EDIST_MAX_BUF_SIZE        256
-#define EDIST_MAX_LOCALES         200
-#define EDIST_MAX_TAG_CODE_UNITS  12
+#define EDIST_MAX_LOCALES         2048
+#define EDIST_MAX_BUF_SIZE        (2 * EDIST_MAX_LOCALES) /* u16 results. */
+#define EDIST_MAX_RAW_LEN         128 /* Code units read from the buffer. */
 #define EDIST_MAX_NAME_CODE_UNITS 40
 #define EDIST_MAX_CODE_UNITS      EDIST_MAX_NAME_CODE_UNITS
+#define EDIST_MAX_STRING_LEN      64 /* Bits in a column of the kernel. */
+#define EDIST_ARENA_SIZE          (28 * EDIST_MAX_LOCALES)
+#define EDIST_TABLE_POOL_SIZE \
+  (sizeof(kEdistTablePool) / sizeof(*kEdistTablePool))
+#define EDIST_STACK_SIZE          8192 /* As in build_editdistance.sh. */
+#define EDIST_MEMORY_SIZE         786432 /* Likewise, twelve pages. */
+#define EDIST_FAKE_SUBTAG_LEN     5
+#define EDIST_MASK_SIZE           (EDIST_MAX_LOCALES / 8)
+#define EDIST_NO_LOCALE           -1
+#define EDIST_MAX_STRINGS         (2 * EDIST_MAX_LOCALES)
+#define EDIST_BATCHES             (EDIST_MAX_STRINGS / EDIST_LANES)
+#define EDIST_HISTORY             2
+#define EDIST_NO_STATE            UINT8_MAX
+#define EDIST_GRAM_BUCKET_BITS    10
+#define EDIST_GRAM_BUCKETS        (1 << EDIST_GRAM_BUCKET_BITS)
+#define EDIST_MAX_POSTINGS        (24 * EDIST_MAX_LOCALES)
+#define EDIST_MAX_LOCALE_GRAMS    (2 * (EDIST_MAX_STRING_LEN - 2))
+#define EDIST_TRIE_LAG            2
+#define EDIST_HANGUL_FIRST        0xac00
+#define EDIST_HANGUL_COUNT        11172
+#define EDIST_SCRIPT_RANGES \
+  (sizeof(kEdistScriptRanges) / sizeof(*kEdistScriptRanges))
 
 /**
- * User locale.
+ * Locale that may be searched, from the locale table or a user locale.
+ *
+ * Strings and lengths are in code points, as from edist_fold(), and
+ * strings are at offsets into the locale table's pool or, past its end, the
+ * arena that user locales are allocated from (see edist_text()).
+ *
  * @note See src/shared/locales.ts for known locale tags and display names.
- *  No such locale tag/name contains surrogate pairs.
  */
-typedef struct user_locale_t {
-  uint16_t tag[EDIST_MAX_TAG_CODE_UNITS];   /** BCP47-like locale tag. */
-  uint16_t name[EDIST_MAX_NAME_CODE_UNITS]; /** Locale display name. */
-  uint8_t tag_len;                          /** Tag length. */
-  uint8_t name_len;                         /** Display name length. */
-} user_locale_t;
+typedef struct edist_locale_t {
+  uint16_t tag;     /** Folded tag, with any fake script subtag. */
+  uint8_t tag_len;  /** Tag length. */
+  uint8_t fake_at;  /** Index of the fake script subtag, or 0. */
+  uint16_t name;    /** Folded display name. */
+  uint8_t name_len; /** Display name length. */
+} edist_locale_t;
 
 /** Edit distance module context. */
 typedef struct edist_ctx_t {
-  uint8_t buf[EDIST_MAX_BUF_SIZE];          /** Bidirectional static buffer. */
-  user_locale_t locales[EDIST_MAX_LOCALES]; /** Locale tags/display names. */
-  uint8_t idxs[EDIST_MAX_CODE_UNITS];       /** Static index map for locales. */
-  uint8_t count;                            /** Count of locales and idxs. */
+  uint8_t buf[EDIST_MAX_BUF_SIZE];           /** Bidirectional buffer. */
+  edist_locale_t locales[EDIST_MAX_LOCALES]; /** Locales to search. */
+  uint16_t count;                            /** Count of locales. */
+  uint32_t arena[EDIST_ARENA_SIZE];          /** Strings of user locales. */
+  uint16_t arena_used;                       /** Code points allocated. */
+  uint64_t sigs[EDIST_MAX_STRINGS];          /** Code points in each string. */
+  uint64_t scripts[EDIST_MAX_LOCALES];       /** Scripts of each locale. */
+
+  /*
+   * Strings are the tag and display name of every locale, in that order, so
+   * string `s` is that of locale `s >> 1`, its display name if odd. They are
+   * evaluated EDIST_LANES at a time, each batch keeping the state of its last
+   * EDIST_HISTORY evaluations, for some prefix of the query each.
+   */
+  edist_lanes_state_t states[EDIST_BATCHES][EDIST_HISTORY];
+  uint8_t dists[EDIST_BATCHES][EDIST_HISTORY][EDIST_LANES];
+  uint8_t at[EDIST_BATCHES][EDIST_HISTORY];  /** Length of each prefix. */
+  uint32_t prefix[EDIST_MAX_CODE_UNITS];     /** Query so far. */
+  uint8_t prefix_len;                        /** Its length. */
+
+  /*
+   * Trigram index of the locales, from a hash of each trigram in a locale's
+   * tag, without any fake script subtag, or display name to the locales with
+   * one that hashes the same.
+   */
+  uint16_t gram_starts[EDIST_GRAM_BUCKETS + 1]; /** Postings by bucket. */
+  uint16_t postings[EDIST_MAX_POSTINGS];        /** Locale numbers. */
+  uint8_t indexed;                           /** Whether index is current. */
+  uint8_t index_fits;                        /** Whether index is usable. */
+
+  /*
+   * Trie of the strings, implicit in their sorted order: a string shares its
+   * first lcps[j] code points with the one before it, and so do any strings
+   * that follow which share at least as many with it. Walking it steps each
+   * node once, as a trie of nodes would, but reads two flat arrays rather
+   * than chasing links, and needs 3 bytes per string rather than about 13
+   * per code point of string storage (see triebench).
+   */
+  uint16_t sorted[EDIST_MAX_STRINGS];        /** Strings in sorted order. */
+  uint8_t lcps[EDIST_MAX_STRINGS];           /** Common prefix lengths. */
+
+  /* Per-locale scratch space of a search, too large for the stack. */
+  uint8_t hits[EDIST_MAX_LOCALES];   /** See edist_count_hits(). */
+  uint8_t bounds[EDIST_MAX_LOCALES]; /** Lower bound on each score. */
+  uint16_t order[EDIST_MAX_LOCALES]; /** Candidates by bound, then ranked. */
 } edist_ctx_t;
 
+/** Scores of candidate locales so far, and the kth best of them. */
+typedef struct edist_tally_t {
+  uint16_t hist[UINT8_MAX + 1]; /** Count of candidates by score. */
+  uint16_t k;                   /** Count of locales to rank. */
+  uint8_t max_dist;             /** The kth best score so far. */
+  uint16_t at_most;             /** Count of candidates scoring no worse. */
+} edist_tally_t;
+
 edist_ctx_t edist_ctx = {};
 
+/* Emscripten's own static data and the stack have to fit in what is left. */
+_Static_assert(sizeof(edist_ctx) + sizeof(kEdistTablePool) +
+                       sizeof(kEdistTable) + sizeof(kEdistFoldIndex) +
+                       sizeof(kEdistFoldBlocks) + sizeof(kEdistFoldPool) +
+                       sizeof(kEdistScriptRanges) + EDIST_STACK_SIZE <=
+                   EDIST_MEMORY_SIZE,
+               "Edit distance module outgrows its pages of memory");
+_Static_assert(EDIST_TABLE_POOL_SIZE + EDIST_ARENA_SIZE <= UINT16_MAX,
+               "String offsets outgrow 16 bits");
+_Static_assert(EDIST_MAX_POSTINGS <= UINT16_MAX,
+               "Postings outgrow 16-bit bucket starts");
+_Static_assert(EDIST_TABLE_LOCALES <= EDIST_MAX_LOCALES,
+               "Locale table outgrows the locales that may be searched");
+
 static uint8_t edist_has_script_subtag(uint8_t *buf, uint8_t tag_len) {
   uint8_t hyphens = 0;
   for (uint8_t i = 0; i < tag_len; i++)
@@ -95,6 +222,154 @@ static uint8_t edist_has_script_subtag(uint8_t *buf, uint8_t tag_len) {
   return hyphens > 1;
 }
 
+static inline uint8_t edist_mask_has(const uint8_t mask[], uint16_t i) {
+  return mask[i / 8] >> (i % 8) & 1;
+}
+
+/**
+ * Fold a code point for case-insensitive comparison, as
+ * scripts/casefoldingmap.py does: case fold it, decompose it, and drop any
+ * combining diacritical marks.
+ * @param c Code point, or an unpaired surrogate, which folds to itself.
+ * @param[out] out Buffer for `EDIST_MAX_FOLD_LEN` code points.
+ * @return Count of code points that `c` folds to, 0 for a diacritical mark.
+ */
+static uint8_t edist_fold_point(uint32_t c, uint32_t out[]) {
+  if (c < 0x80) {
+    out[0] = 'A' <= c && c <= 'Z' ? c + ('a' - 'A') : c;
+    return 1;
+  }
+
+  /* Hangul syllables decompose by arithmetic rather than by table. */
+  if (c - EDIST_HANGUL_FIRST < EDIST_HANGUL_COUNT) {
+    uint32_t s = c - EDIST_HANGUL_FIRST;
+    out[0] = 0x1100 + s / 588;
+    out[1] = 0x1161 + s % 588 / 28;
+    out[2] = 0x11a7 + s % 28;
+    return s % 28 ? 3 : 2;
+  }
+
+  uint16_t entry = 0;
+  if (c < EDIST_FOLD_LIMIT) {
+    uint8_t block = kEdistFoldIndex[c >> EDIST_FOLD_BLOCK_BITS];
+    entry = kEdistFoldBlocks[block][c & ((1 << EDIST_FOLD_BLOCK_BITS) - 1)];
+  }
+
+  if (!entry) {
+    out[0] = c;
+    return 1;
+  }
+  if (entry < EDIST_FOLD_POOL_TAG || entry > EDIST_UTF16_MAX_SURROGATE) {
+    out[0] = (c & ~(uint32_t)UINT16_MAX) | entry;
+    return 1;
+  }
+
+  const uint32_t *pooled = &kEdistFoldPool[entry - EDIST_FOLD_POOL_TAG];
+  memcpy(out, &pooled[1], pooled[0] * sizeof(*out));
+  return pooled[0];
+}
+
+/**
+ * Find the script that a code point is in.
+ * @param c Code point.
+ * @return Number of the script in casefoldingmap.h, or `EDIST_SCRIPTS` if
+ *  none.
+ */
+static uint8_t edist_script(uint32_t c) {
+  uint8_t lo = 0, hi = EDIST_SCRIPT_RANGES;
+
+  while (lo < hi) {
+    uint8_t mid = (lo + hi) / 2;
+    if (kEdistScriptRanges[mid].last < c)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  if (lo < EDIST_SCRIPT_RANGES && kEdistScriptRanges[lo].first <= c)
+    return kEdistScriptRanges[lo].script;
+  return EDIST_SCRIPTS;
+}
+
+/**
+ * Fold a UTF-16 string into one code point per element, so that comparing
+ * strings never needs to fold or handle surrogates again, and find the
+ * scripts that it is written in.
+ * @param s UTF-16 code units in the string. Not null terminated.
+ * @param code_units Count of code units, at most `EDIST_MAX_RAW_LEN`.
+ * @param[out] out Buffer for `max_len` code points.
+ * @param max_len Most code points to write.
+ * @param[out] scripts Scripts of the string, bit i set for script i.
+ * @return Length of the folded string, which is cut short to `max_len` code
+ *  points if longer.
+ */
+static uint16_t edist_fold(const uint16_t s[], uint8_t code_units,
+                           uint32_t out[], uint8_t max_len,
+                           uint64_t *scripts) {
+  uint16_t folded_len = 0;
+
+  *scripts = 0;
+  for (uint8_t i = 0; i < code_units; i++) {
+    uint32_t c = s[i], folded[EDIST_MAX_FOLD_LEN];
+
+    /* A surrogate pair in order is one code point, a lone surrogate its own. */
+    if (c >= EDIST_UTF16_MIN_SURROGATE && c < 0xdc00 && i + 1 < code_units &&
+        s[i + 1] >= 0xdc00 && s[i + 1] <= EDIST_UTF16_MAX_SURROGATE)
+      c = 0x10000 + ((c - EDIST_UTF16_MIN_SURROGATE) << 10) + (s[++i] - 0xdc00);
+
+    uint8_t script = edist_script(c);
+    if (script < EDIST_SCRIPTS)
+      *scripts |= (uint64_t)1 << script;
+
+    uint8_t n = edist_fold_point(c, folded);
+    for (uint8_t j = 0; j < n; j++, folded_len++)
+      if (folded_len < max_len)
+        out[folded_len] = folded[j];
+  }
+
+  return folded_len;
+}
+
+/**
+ * Resolve the offset of a locale's string.
+ * @param offset Offset into the locale table's pool, or past its end into
+ *  the arena.
+ * @return Pointer to the string's code points.
+ */
+static inline const uint32_t *edist_text(uint16_t offset) {
+  if (offset < EDIST_TABLE_POOL_SIZE)
+    return &kEdistTablePool[offset];
+  return &edist_ctx.arena[offset - EDIST_TABLE_POOL_SIZE];
+}
+
+static const uint32_t *edist_string(uint16_t s, uint8_t *len) {
+  edist_locale_t *locale = &edist_ctx.locales[s >> 1];
+  *len = s & 1 ? locale->name_len : locale->tag_len;
+  return edist_text(s & 1 ? locale->name : locale->tag);
+}
+
+/**
+ * Summarize the code points in a locale's tag and display name, so that
+ * edist_batch_step() can tell at a glance that most strings lack one.
+ * @param i Number of the locale.
+ */
+static void edist_sign(uint16_t i) {
+  for (uint16_t s = 2 * i; s <= 2 * i + 1; s++) {
+    uint8_t len;
+    const uint32_t *text = edist_string(s, &len);
+
+    edist_ctx.sigs[s] = 0;
+    for (uint8_t j = 0; j < len; j++)
+      edist_ctx.sigs[s] |= (uint64_t)1 << (text[j] % 64);
+  }
+}
+
+/** Forget every evaluation so far, as when locales change. */
+static void edist_forget() {
+  memset(edist_ctx.at, EDIST_NO_STATE, sizeof(edist_ctx.at));
+  edist_ctx.prefix_len = 0;
+}
+
 /**
  * Get a pointer to a bidirectional buffer.
  *
@@ -104,20 +379,40 @@ static uint8_t edist_has_script_subtag(uint8_t *buf, uint8_t tag_len) {
  * @return Pointer to a buffer.
  */
 EMSCRIPTEN_KEEPALIVE uint8_t *edist_get_buf_ptr() {
-  /*
-   * On first run, build an index map for a string with no surrogate pairs.
-   * The result is reusable for every locale's tag and display name.
-   */
-  if (!edist_ctx.idxs[0])
-    for (uint8_t i = 0; i < EDIST_MAX_CODE_UNITS; i++)
-      edist_ctx.idxs[i] = i + 1;
-
   return edist_ctx.buf;
 }
 
 /** Reset the edit distance module. */
 EMSCRIPTEN_KEEPALIVE void edist_reset() {
   edist_ctx.count = 0;
+  edist_ctx.arena_used = 0;
+  edist_ctx.indexed = 0;
+  edist_forget();
+}
+
+/**
+ * Add a locale from the locale table to those that may be searched.
+ * @param index Index of the locale in the locale table.
+ * @return Number of the locale, or `EDIST_NO_LOCALE` if `index` is out of
+ *  range or `EDIST_MAX_LOCALES` are already added or loaded.
+ */
+EMSCRIPTEN_KEEPALIVE int32_t edist_add_locale(uint8_t index) {
+  if (index >= EDIST_TABLE_LOCALES || edist_ctx.count >= EDIST_MAX_LOCALES)
+    return EDIST_NO_LOCALE;
+
+  const edist_table_locale_t *entry = &kEdistTable[index];
+  edist_ctx.locales[edist_ctx.count++] = (edist_locale_t){
+      .tag = entry->tag,
+      .tag_len = entry->tag_len,
+      .fake_at = entry->fake_at,
+      .name = entry->name,
+      .name_len = entry->name_len,
+  };
+  edist_ctx.scripts[edist_ctx.count - 1] = entry->scripts;
+  edist_sign(edist_ctx.count - 1);
+  edist_ctx.indexed = 0;
+  edist_forget();
+  return edist_ctx.count - 1;
 }
 
 /**
@@ -125,70 +420,669 @@ EMSCRIPTEN_KEEPALIVE void edist_reset() {
  *
  * Should be called after packing the locale tag and display name into the
  * bidirectional buffer as raw u16le arrays, without null terminators and
- * without separators.
+ * without separators. Both are folded and allocated from the arena, unless
+ * either is longer than `EDIST_MAX_STRING_LEN` code points once folded or the
+ * arena is full, in which case the locale is not loaded and takes no number.
+ * The locale is searched by the scripts of its display name as is.
  *
- * @param tag_len Tag length.
- * @param name_len Display name length.
+ * @param tag_len Tag length, in code units.
+ * @param name_len Display name length, in code units. At most
+ *  `EDIST_MAX_RAW_LEN` together with `tag_len`.
+ * @return Number of the locale, or `EDIST_NO_LOCALE` if it was not loaded.
  */
-EMSCRIPTEN_KEEPALIVE void edist_load_locale(uint8_t tag_len, uint8_t name_len) {
-  user_locale_t *locale = &edist_ctx.locales[edist_ctx.count++];
-  uint8_t offset = tag_len * sizeof(*locale->tag);
+EMSCRIPTEN_KEEPALIVE int32_t edist_load_locale(uint8_t tag_len,
+                                               uint8_t name_len) {
+  uint16_t raw[EDIST_MAX_RAW_LEN];
+  uint32_t points[EDIST_MAX_STRING_LEN], name[EDIST_MAX_STRING_LEN];
   uint8_t *buf = edist_ctx.buf;
+  uint64_t scripts, tag_scripts;
+  uint8_t fake_at = 0;
+
+  if (edist_ctx.count >= EDIST_MAX_LOCALES ||
+      tag_len + name_len > EDIST_MAX_RAW_LEN)
+    return EDIST_NO_LOCALE;
+
+  memcpy(raw, buf, (tag_len + name_len) * sizeof(*raw));
+  uint16_t folded_name_len = edist_fold(&raw[tag_len], name_len, name,
+                                        EDIST_MAX_STRING_LEN, &scripts);
+  uint16_t folded_tag_len = edist_fold(raw, tag_len, points,
+                                       EDIST_MAX_STRING_LEN, &tag_scripts);
+  if (folded_name_len > EDIST_MAX_STRING_LEN ||
+      folded_tag_len > EDIST_MAX_STRING_LEN)
+    return EDIST_NO_LOCALE;
+
+  uint8_t has_script = edist_has_script_subtag(buf, tag_len);
+  name_len = folded_name_len;
+  tag_len = folded_tag_len;
+
+  /*
+   * Locale tags without script subtags (e.g. az-AZ) can have problematically
+   * lower edit distances compared to those that do (e.g. az-Cyrl-AZ).
+   * Insert the fake subtag "\x00\x00\x00\x00-" after the first hyphen.
+   */
+  for (uint8_t i = 0; !has_script && !fake_at && i < tag_len; i++)
+    if (points[i] == '-')
+      fake_at = i + 1;
+
+  uint8_t fake_len = fake_at ? EDIST_FAKE_SUBTAG_LEN : 0;
+  uint16_t size = tag_len + fake_len + name_len;
+  if (tag_len + fake_len > EDIST_MAX_STRING_LEN ||
+      size > EDIST_ARENA_SIZE - edist_ctx.arena_used)
+    return EDIST_NO_LOCALE;
+
+  /* Bump allocation, freed only by edist_reset(). */
+  uint16_t offset = EDIST_TABLE_POOL_SIZE + edist_ctx.arena_used;
+  uint32_t *out = &edist_ctx.arena[edist_ctx.arena_used];
+  edist_ctx.arena_used += size;
+
+  memcpy(out, points, (fake_at ? fake_at : tag_len) * sizeof(*out));
+  if (fake_at) {
+    memcpy(&out[fake_at], U"\0\0\0\0-", fake_len * sizeof(*out));
+    memcpy(&out[fake_at + fake_len], &points[fake_at],
+           (tag_len - fake_at) * sizeof(*out));
+  }
+  memcpy(&out[tag_len + fake_len], name, name_len * sizeof(*out));
+
+  edist_ctx.locales[edist_ctx.count++] = (edist_locale_t){
+      .tag = offset,
+      .tag_len = tag_len + fake_len,
+      .fake_at = fake_at,
+      .name = offset + tag_len + fake_len,
+      .name_len = name_len,
+  };
+  edist_ctx.scripts[edist_ctx.count - 1] = scripts;
+  edist_sign(edist_ctx.count - 1);
+  edist_ctx.indexed = 0;
+  edist_forget();
+  return edist_ctx.count - 1;
+}
+
+static uint8_t edist_contains(const uint32_t *s, uint8_t s_len,
+                              const uint32_t *query, uint8_t len) {
+  if (!len)
+    return 1;
+
+  for (int16_t i = 0; i + len <= s_len; i++)
+    if (s[i] == query[0] && !memcmp(&s[i], query, len * sizeof(*query)))
+      return 1;
+  return 0;
+}
+
+/**
+ * Copy a locale's tag without any fake script subtag.
+ * @param locale Pointer to a locale.
+ * @param[out] out Buffer for `EDIST_MAX_STRING_LEN` code points.
+ * @return Length of the copy.
+ */
+static uint8_t edist_plain_tag(const edist_locale_t *locale, uint32_t out[]) {
+  const uint32_t *tag = edist_text(locale->tag);
+  if (!locale->fake_at) {
+    memcpy(out, tag, locale->tag_len * sizeof(*out));
+    return locale->tag_len;
+  }
+
+  uint8_t after = locale->fake_at + EDIST_FAKE_SUBTAG_LEN;
+  memcpy(out, tag, locale->fake_at * sizeof(*out));
+  memcpy(&out[locale->fake_at], &tag[after],
+         (locale->tag_len - after) * sizeof(*out));
+  return locale->tag_len - EDIST_FAKE_SUBTAG_LEN;
+}
+
+/**
+ * Check whether a locale's tag or display name contains a query outright.
+ * @param locale Pointer to a locale.
+ * @param query Code points in the query, as from edist_fold().
+ * @param len Query length.
+ * @return Whether the tag, without any fake script subtag, or the display
+ *  name contains the query.
+ */
+static uint8_t edist_matches_exactly(const edist_locale_t *locale,
+                                     const uint32_t *query, uint8_t len) {
+  if (edist_contains(edist_text(locale->name), locale->name_len, query, len))
+    return 1;
+
+  uint32_t tag[EDIST_MAX_STRING_LEN];
+  uint8_t tag_len = edist_plain_tag(locale, tag);
+  return edist_contains(tag, tag_len, query, len);
+}
+
+/**
+ * Compare two strings code point by code point.
+ * @param a Index of the first string.
+ * @param b Index of the second string.
+ * @param[out] lcp Length of their common prefix.
+ * @return Whether the first string sorts after the second.
+ */
+static uint8_t edist_sorts_after(uint16_t a, uint16_t b, uint8_t *lcp) {
+  uint8_t a_len, b_len;
+  const uint32_t *a_text = edist_string(a, &a_len);
+  const uint32_t *b_text = edist_string(b, &b_len);
+  uint8_t i = 0;
+
+  while (i < a_len && i < b_len && a_text[i] == b_text[i])
+    i++;
+
+  *lcp = i;
+  if (i == a_len)
+    return 0;
+  return i == b_len || a_text[i] > b_text[i];
+}
+
+static int edist_compare_strings(const void *a, const void *b) {
+  uint16_t s = *(const uint16_t *)a, t = *(const uint16_t *)b;
+  uint8_t lcp;
+
+  if (edist_sorts_after(s, t, &lcp))
+    return 1;
+  return edist_sorts_after(t, s, &lcp) ? -1 : 0;
+}
+
+/** Sort the strings into the order of a depth-first traversal of a trie. */
+static void edist_sort_strings() {
+  uint16_t n_strings = 2 * edist_ctx.count;
+  uint16_t *sorted = edist_ctx.sorted;
+
+  /* Thousands of strings are too many for an insertion sort. */
+  for (uint16_t j = 0; j < n_strings; j++)
+    sorted[j] = j;
+  qsort(sorted, n_strings, sizeof(*sorted), edist_compare_strings);
+
+  edist_ctx.lcps[0] = 0;
+  for (uint16_t j = 1; j < n_strings; j++)
+    edist_sorts_after(sorted[j - 1], sorted[j], &edist_ctx.lcps[j]);
+}
+
+static inline uint16_t edist_gram_bucket(uint32_t a, uint32_t b, uint32_t c) {
+  uint32_t h = a * 0x9e3779b1U ^ b * 0x85ebca6bU ^ c * 0xc2b2ae35U;
+  return h >> (32 - EDIST_GRAM_BUCKET_BITS);
+}
+
+/**
+ * List the buckets of the trigrams in a locale's tag, without any fake
+ * script subtag, and display name.
+ * @param i Number of the locale.
+ * @param[out] out Buffer for `EDIST_MAX_LOCALE_GRAMS` buckets.
+ * @return Count of buckets, each listed once.
+ */
+static uint8_t edist_locale_grams(uint16_t i, uint16_t out[]) {
+  edist_locale_t *locale = &edist_ctx.locales[i];
+  uint32_t tag[EDIST_MAX_STRING_LEN];
+  uint8_t seen[EDIST_GRAM_BUCKETS / 8] = {0};
+  const uint32_t *texts[2] = {tag, edist_text(locale->name)};
+  uint8_t lens[2] = {edist_plain_tag(locale, tag), locale->name_len};
+  uint8_t n = 0;
+
+  for (uint8_t k = 0; k < 2; k++) {
+    for (uint8_t j = 0; j + 2 < lens[k]; j++) {
+      const uint32_t *t = &texts[k][j];
+      uint16_t bucket = edist_gram_bucket(t[0], t[1], t[2]);
+      if (seen[bucket / 8] >> (bucket % 8) & 1)
+        continue;
+      seen[bucket / 8] |= 1 << (bucket % 8);
+      out[n++] = bucket;
+    }
+  }
+
+  return n;
+}
+
+/** Build the trigram index of the locales, unless it is current. */
+static void edist_index() {
+  uint16_t *starts = edist_ctx.gram_starts;
+  uint16_t buckets[EDIST_MAX_LOCALE_GRAMS];
+  uint32_t total = 0;
+
+  if (edist_ctx.indexed)
+    return;
+  edist_ctx.indexed = 1;
+  edist_sort_strings();
+
+  /* Counting sort of every locale by the buckets of its trigrams. */
+  memset(starts, 0, sizeof(edist_ctx.gram_starts));
+  for (uint16_t i = 0; i < edist_ctx.count; i++) {
+    uint8_t n = edist_locale_grams(i, buckets);
+    for (uint8_t j = 0; j < n; j++)
+      starts[buckets[j] + 1]++;
+    total += n;
+  }
+
+  edist_ctx.index_fits = total <= EDIST_MAX_POSTINGS;
+  if (!edist_ctx.index_fits)
+    return;
+
+  for (uint16_t bucket = 1; bucket <= EDIST_GRAM_BUCKETS; bucket++)
+    starts[bucket] += starts[bucket - 1];
+  for (uint16_t i = 0; i < edist_ctx.count; i++) {
+    uint8_t n = edist_locale_grams(i, buckets);
+    for (uint8_t j = 0; j < n; j++)
+      edist_ctx.postings[starts[buckets[j]]++] = i;
+  }
+
+  /* Filling advanced each bucket's start to the next one's. */
+  memmove(&starts[1], starts, EDIST_GRAM_BUCKETS * sizeof(*starts));
+  starts[0] = 0;
+}
+
+/**
+ * Count the trigrams of a query that each locale may share.
+ * @param query Code points in the query, as from edist_fold().
+ * @param len Query length.
+ * @param[out] hits Buffer for, per locale, the count of the query's trigrams
+ *  whose bucket lists it, or that contain a null, which none lists.
+ * @return Count of the query's trigrams, or 0 if the index is of no use.
+ */
+static uint8_t edist_count_hits(const uint32_t query[], uint8_t len,
+                                uint8_t hits[]) {
+  if (len < 3 || !edist_ctx.index_fits)
+    return 0;
+
+  memset(hits, 0, edist_ctx.count);
+  for (uint8_t j = 0; j + 2 < len; j++) {
+    const uint32_t *t = &query[j];
+    if (!t[0] || !t[1] || !t[2]) {
+      for (uint16_t i = 0; i < edist_ctx.count; i++)
+        hits[i]++;
+      continue;
+    }
+
+    uint16_t bucket = edist_gram_bucket(t[0], t[1], t[2]);
+    for (uint16_t p = edist_ctx.gram_starts[bucket];
+         p < edist_ctx.gram_starts[bucket + 1]; p++)
+      hits[edist_ctx.postings[p]]++;
+  }
+
+  return len - 2;
+}
+
+/**
+ * Bound the edit distance of a locale from a query from below.
+ *
+ * A string's edit distance from the query is at least the difference of
+ * their lengths. Each edit also spoils at most 4 of the query's trigrams, 3
+ * for a substitution, insertion, or deletion and 4 for a transposition, so
+ * every 4 of them that neither the tag nor the display name has add another
+ * edit, as in the q-gram lemma.
+ *
+ * @param i Number of the locale.
+ * @param len Query length.
+ * @param grams Count of the query's trigrams, as from edist_count_hits().
+ * @param hits Count of those that the locale may share.
+ * @return Lower bound on the locale's score.
+ */
+static uint8_t edist_bound(uint16_t i, uint8_t len, uint8_t grams,
+                           uint8_t hits) {
+  edist_locale_t *locale = &edist_ctx.locales[i];
+  uint8_t by_len = edist_min(edist_max(locale->tag_len - len,
+                                       len - locale->tag_len),
+                             edist_max(locale->name_len - len,
+                                       len - locale->name_len));
+
+  return edist_max(by_len, (grams - hits + 3) / 4);
+}
+
+/**
+ * Evaluate one more code point of the query against a batch of strings.
+ * @param b Index of the batch.
+ * @param from Index of the state of the query so far.
+ * @param to Index of a state for the query with `c` appended. May be the
+ *  same as `from`.
+ * @param c Code point, as from edist_fold().
+ */
+static void edist_batch_step(uint16_t b, uint8_t from, uint8_t to,
+                             uint32_t c) {
+  uint16_t n_strings = 2 * edist_ctx.count;
+  edist_lanes_t pm = {0};
+  uint8_t lens[EDIST_LANES] = {0};
+
+  for (uint8_t k = 0; k < EDIST_LANES; k++) {
+    uint16_t s = b * EDIST_LANES + k;
+    if (s >= n_strings)
+      break;
+
+    const uint32_t *text = edist_string(s, &lens[k]);
+    if (!(edist_ctx.sigs[s] >> (c % 64) & 1))
+      continue;
+
+    uint64_t match = 0;
+    for (uint8_t i = 0; i < lens[k]; i++)
+      match |= (uint64_t)(text[i] == c) << i;
+    pm[k] = match;
+  }
+
+  edist_ctx.states[b][to] = edist_ctx.states[b][from];
+  memcpy(edist_ctx.dists[b][to], edist_ctx.dists[b][from], EDIST_LANES);
+  edist_lanes_step(&edist_ctx.states[b][to], &pm, lens,
+                   edist_ctx.dists[b][to]);
+  edist_ctx.at[b][to] = edist_ctx.at[b][from] + 1;
+}
 
-  if (edist_has_script_subtag(buf, tag_len)) {
-    memcpy(locale->tag, buf, tag_len * sizeof(*locale->tag));
+/**
+ * Bring a batch of strings up to date with the query so far.
+ *
+ * Typing usually appends or deletes one code point at the end of the query,
+ * so a batch picks up from the longest prefix of the query that one of its
+ * states is for: deleting finds the state before, and appending steps
+ * forward from the latest, keeping it as the state before. Only a batch with
+ * neither starts over. A batch left alone while the query changes catches up
+ * in the same way when next needed.
+ *
+ * @param b Index of the batch.
+ * @return Edit distance of each string in the batch from the query.
+ */
+static const uint8_t *edist_sync(uint16_t b) {
+  uint8_t *at = edist_ctx.at[b];
+  uint8_t len = edist_ctx.prefix_len;
+  uint8_t from = 0;
+
+  for (uint8_t h = 1; h < EDIST_HISTORY; h++)
+    if (at[h] <= len && (at[from] > len || at[h] > at[from]))
+      from = h;
+
+  if (at[from] > len) {
+    edist_lanes_init(&edist_ctx.states[b][from]);
+    for (uint8_t k = 0; k < EDIST_LANES; k++) {
+      uint16_t s = b * EDIST_LANES + k;
+      if (s < 2 * edist_ctx.count)
+        edist_string(s, &edist_ctx.dists[b][from][k]);
+    }
+    at[from] = 0;
+  }
+
+  if (at[from] == len)
+    return edist_ctx.dists[b][from];
+
+  while (at[from] + 1 < len)
+    edist_batch_step(b, from, from, edist_ctx.prefix[at[from]]);
+
+  uint8_t to = (from + 1) % EDIST_HISTORY;
+  edist_batch_step(b, from, to, edist_ctx.prefix[len - 1]);
+  return edist_ctx.dists[b][to];
+}
+
+/**
+ * Replace the query so far, dropping states for prefixes it no longer has.
+ * @param query Code points in the query, as from edist_fold().
+ * @param len Query length, at most `EDIST_MAX_CODE_UNITS`.
+ * @return Length of the prefix it shares with the last query.
+ */
+static uint8_t edist_set_prefix(const uint32_t query[], uint8_t len) {
+  uint8_t common = 0;
+
+  while (common < len && common < edist_ctx.prefix_len &&
+         edist_ctx.prefix[common] == query[common])
+    common++;
+
+  if (common < edist_ctx.prefix_len)
+    for (uint16_t b = 0; b < EDIST_BATCHES; b++)
+      for (uint8_t h = 0; h < EDIST_HISTORY; h++)
+        if (edist_ctx.at[b][h] > common)
+          edist_ctx.at[b][h] = EDIST_NO_STATE;
+
+  memcpy(edist_ctx.prefix, query, len * sizeof(*query));
+  edist_ctx.prefix_len = len;
+  return common;
+}
+
+/**
+ * Start a tally of candidate locales, none scored yet.
+ * @param[out] t Pointer to a tally.
+ * @param n_cands Count of candidate locales.
+ * @param k Count of locales to rank, at most `n_cands`.
+ */
+static void edist_tally_init(edist_tally_t *t, uint16_t n_cands, uint16_t k) {
+  memset(edist_ctx.buf, UINT8_MAX, edist_ctx.count);
+  memset(t->hist, 0, sizeof(t->hist));
+  t->hist[UINT8_MAX] = n_cands;
+  t->k = k;
+  t->max_dist = UINT8_MAX;
+  t->at_most = n_cands;
+}
+
+/**
+ * Record a score for a candidate locale in the buffer, if it is better.
+ * @param t Pointer to a tally.
+ * @param i Number of the locale.
+ * @param score Edit distance of its tag or display name from the query.
+ */
+static void edist_tally(edist_tally_t *t, uint16_t i, uint8_t score) {
+  uint8_t *old = &edist_ctx.buf[i];
+  if (score >= *old)
+    return;
+
+  t->at_most += *old > t->max_dist && score <= t->max_dist;
+  t->hist[*old]--;
+  t->hist[score]++;
+  *old = score;
+
+  while (t->max_dist && t->at_most - t->hist[t->max_dist] >= t->k)
+    t->at_most -= t->hist[t->max_dist--];
+}
+
+/**
+ * Score candidate locales in one depth-first traversal of the trie.
+ *
+ * Unlike edist_sync(), this starts over for every query, with the query as
+ * the pattern of edist_osa_step() and each string as the text. The DP column
+ * for each node of the trie is computed once for every string below it, and
+ * kept on a stack until the traversal leaves it. A node whose column bounds
+ * every string below it to worse than the kth best score so far is pruned,
+ * with everything below it.
+ *
+ * @param t Pointer to a tally.
+ * @param query Code points in the query, as from edist_fold().
+ * @param len Query length, from 1 to `EDIST_MAX_CODE_UNITS`.
+ * @param cands Bitmask of candidate locales.
+ * @param bounds Lower bound on the score of each candidate.
+ */
+static void edist_traverse(edist_tally_t *t, const uint32_t query[],
+                           uint8_t len, const uint8_t cands[],
+                           const uint8_t bounds[]) {
+  edist_pattern_t pattern;
+  edist_osa_state_t stack[EDIST_MAX_STRING_LEN + 1];
+  uint16_t n_strings = 2 * edist_ctx.count;
+  uint8_t depth = 0;             /* Columns on the stack past the root. */
+  uint8_t pruned = UINT8_MAX;    /* Depth of the node pruned, if any. */
+
+  edist_pattern_init(&pattern, (uint32_t *)query, len);
+  edist_osa_init(&stack[0], len);
+
+  for (uint16_t j = 0; j < n_strings; j++) {
+    uint16_t s = edist_ctx.sorted[j];
+    uint16_t i = s >> 1;
+
+    /* Pop columns for nodes that this string is not below. */
+    depth = edist_min(depth, edist_ctx.lcps[j]);
+    if (depth >= pruned || !edist_mask_has(cands, i) ||
+        bounds[i] > t->max_dist)
+      continue;
+
+    uint8_t text_len;
+    const uint32_t *text = edist_string(s, &text_len);
+
+    for (pruned = UINT8_MAX; depth < text_len; depth++) {
+      if (edist_osa_bound(&stack[depth], len, depth) > t->max_dist) {
+        pruned = depth;
+        break;
+      }
+      stack[depth + 1] = stack[depth];
+      edist_osa_step(&stack[depth + 1],
+                     edist_pattern_match(&pattern, text[depth]), len);
+    }
+
+    if (pruned == UINT8_MAX)
+      edist_tally(t, i, stack[text_len].dist);
+  }
+}
+
+/**
+ * Find the locales to search by script if none contains a query.
+ *
+ * Of the scripts that the query is written in, only those with the fewest
+ * locales count, so that a query mixing, say, Latin letters with kanji is
+ * searched among the few locales with kanji. Scripts with no locales at all
+ * do not count.
+ *
+ * @param scripts Scripts of the query, as from edist_fold().
+ * @param[out] mask Buffer for `EDIST_MASK_SIZE` bytes, locale i being bit
+ *  (i % 8) of byte (i / 8).
+ */
+static void edist_mask_scripts(uint64_t scripts, uint8_t mask[]) {
+  uint16_t counts[EDIST_SCRIPTS] = {0};
+  uint16_t fewest = UINT16_MAX;
+  uint64_t searched = 0;
+
+  for (uint16_t i = 0; i < edist_ctx.count; i++)
+    for (uint64_t both = edist_ctx.scripts[i] & scripts; both;
+         both &= both - 1)
+      counts[__builtin_ctzll(both)]++;
+
+  for (uint8_t script = 0; script < EDIST_SCRIPTS; script++)
+    if (counts[script] && counts[script] < fewest)
+      fewest = counts[script];
+  for (uint8_t script = 0; script < EDIST_SCRIPTS; script++)
+    if (counts[script] == fewest)
+      searched |= (uint64_t)1 << script;
+
+  memset(mask, 0, EDIST_MASK_SIZE);
+  for (uint16_t i = 0; i < edist_ctx.count; i++)
+    if (edist_ctx.scripts[i] & searched)
+      mask[i / 8] |= 1 << (i % 8);
+}
+
+/**
+ * Rank the locales that best match a folded query.
+ * @param query Code points in the query, as from edist_fold().
+ * @param query_len Query length, at most `EDIST_MAX_CODE_UNITS`.
+ * @param mask Bitmask of locales to search if none contains the query
+ *  outright.
+ * @param k Most locales to return.
+ * @return Count of locales returned in the buffer, as from edist_search().
+ */
+static uint16_t edist_run(const uint32_t query[], uint8_t query_len,
+                          const uint8_t mask[], uint16_t k) {
+  uint8_t cands[EDIST_MASK_SIZE] = {0};
+  uint8_t *hits = edist_ctx.hits, *bounds = edist_ctx.bounds;
+  uint16_t *order = edist_ctx.order;
+  uint16_t n_cands = 0;
+
+  edist_index();
+  uint8_t grams = edist_count_hits(query, query_len, hits);
+
+  /* Containing the query means containing all of its trigrams. */
+  for (uint16_t i = 0; i < edist_ctx.count; i++) {
+    if ((!grams || hits[i] == grams) &&
+        edist_matches_exactly(&edist_ctx.locales[i], query, query_len)) {
+      cands[i / 8] |= 1 << (i % 8);
+      n_cands++;
+    }
+  }
+
+  if (!n_cands) {
+    for (uint16_t i = 0; i < edist_ctx.count; i++) {
+      if (edist_mask_has(mask, i)) {
+        cands[i / 8] |= 1 << (i % 8);
+        n_cands++;
+      }
+    }
+  }
+
+  k = edist_min(k, n_cands);
+  if (!k)
+    return 0;
+
+  uint16_t starts[UINT8_MAX + 1] = {0};
+  edist_tally_t tally;
+
+  uint8_t common = edist_set_prefix(query, query_len);
+  edist_tally_init(&tally, n_cands, k);
+
+  for (uint16_t i = 0; i < edist_ctx.count; i++)
+    if (edist_mask_has(cands, i))
+      bounds[i] = edist_bound(i, query_len, grams, grams ? hits[i] : 0);
+
+  if (query_len - common > EDIST_TRIE_LAG) {
+    /*
+     * Not typed a code point at a time, as when pasted. Leave the batches
+     * to catch up only if typing goes on.
+     */
+    edist_traverse(&tally, query, query_len, cands, bounds);
   } else {
+    /* Visit candidates from the best bound, stably sorted by counting. */
+    for (uint16_t i = 0; i < edist_ctx.count; i++)
+      if (edist_mask_has(cands, i))
+        starts[bounds[i] + 1]++;
+    for (uint16_t bound = 1; bound <= UINT8_MAX; bound++)
+      starts[bound] += starts[bound - 1];
+    for (uint16_t i = 0; i < edist_ctx.count; i++)
+      if (edist_mask_has(cands, i))
+        order[starts[bounds[i]]++] = i;
+
     /*
-     * Locale tags without script subtags (e.g. az-AZ) can have problematically
-     * lower edit distances compared to those that do (e.g. az-Cyrl-AZ).
-     * Insert the fake subtag "\x00\x00\x00\x00-".
+     * Score candidates a batch at a time until the kth best score so far is
+     * better than the next bound, which no candidate left can then beat.
      */
-    uint16_t *tag = locale->tag;
-    for (uint8_t i = 0; i < tag_len; i++) {
-      uint16_t lo = buf[2 * i];
-      uint16_t hi = buf[2 * i + 1];
-      *tag++ = (hi << 8) | lo;
-      if (lo == '-' && hi == '\0') {
-        for (uint8_t j = 0; j < 4; j++)
-          *tag++ = (uint16_t)'\0';
-        *tag++ = '-';
+    for (uint16_t j = 0; j < n_cands; j++) {
+      uint16_t i = order[j];
+      if (bounds[i] > tally.max_dist)
+        break;
+      if (edist_ctx.buf[i] != UINT8_MAX)
+        continue;
+
+      uint16_t b = 2 * i / EDIST_LANES;
+      const uint8_t *dists = edist_sync(b);
+
+      for (uint8_t lane = 0; lane < EDIST_LANES; lane += 2) {
+        uint16_t l = (b * EDIST_LANES + lane) >> 1;
+        if (l < edist_ctx.count && edist_mask_has(cands, l))
+          edist_tally(&tally, l, edist_min(dists[lane], dists[lane + 1]));
       }
     }
-    tag_len += 5;
   }
-  memcpy(locale->name, &buf[offset], name_len * sizeof(*locale->name));
 
-  locale->tag_len = tag_len;
-  locale->name_len = name_len;
+  /* Counting sort by score, stable so that ties keep their order. */
+  starts[0] = 0;
+  for (uint16_t score = 1; score <= UINT8_MAX; score++)
+    starts[score] = starts[score - 1] + tally.hist[score - 1];
+  for (uint16_t i = 0; i < edist_ctx.count; i++)
+    if (edist_mask_has(cands, i))
+      order[starts[edist_ctx.buf[i]]++] = i;
+
+  memcpy(edist_ctx.buf, order, k * sizeof(*order));
+  return k;
 }
 
 /**
- * Run an edit distance query.
+ * Search for the locales that best match a query.
  *
- * Should be called after packing a query string into the bidirectional buffer
- * as a u16le array. Results are returned in the same buffer as a u8 array,
- * each element being the lesser of editdistance(query, locale_tag) and
- * editdistance(query, locale_display_name) for each locale that has been
- * loaded into the edit distance module context.
+ * Should be called after packing a query string into the bidirectional
+ * buffer as is. The query is folded as locales are, and if no locale's tag or
+ * display name contains it outright, only locales in the scripts that it is
+ * written in are searched (see edist_mask_scripts()). Results are returned in
+ * the same buffer as a u16 array of locale numbers, ranked by the lesser of
+ * editdistance(query, locale_tag) and editdistance(query,
+ * locale_display_name), ties going to the locale added first.
  *
- * @param len Query string length.
+ * Searching for a query that extends or shortens the last one by a code
+ * point is cheapest, as when it is typed or deleted in a search box.
+ *
+ * @param len Query string length, in code units. Only the first
+ *  `EDIST_MAX_RAW_LEN` are read, and only the first
+ *  `EDIST_MAX_CODE_UNITS` code points of the folded query are searched for.
+ * @param k Most locales to return.
+ * @return Count of locales returned, the lesser of `k` and those searched.
  */
-EMSCRIPTEN_KEEPALIVE void edist_run_query(uint8_t len) {
-  uint16_t query[EDIST_MAX_CODE_UNITS];
-  uint8_t query_idxs[EDIST_MAX_CODE_UNITS];
-  uint8_t query_len;
-
-  memcpy(query, edist_ctx.buf, len * sizeof(*query));
-  query_len = edist_make_idxs(query, len, query_idxs);
+EMSCRIPTEN_KEEPALIVE uint16_t edist_search(uint8_t len, uint16_t k) {
+  uint16_t raw[EDIST_MAX_RAW_LEN];
+  uint32_t query[EDIST_MAX_CODE_UNITS];
+  uint8_t mask[EDIST_MASK_SIZE];
+  uint64_t scripts;
 
-  uint8_t *idxs = edist_ctx.idxs;
+  len = edist_min(len, EDIST_MAX_RAW_LEN);
+  memcpy(raw, edist_ctx.buf, len * sizeof(*raw));
+  uint8_t query_len = edist_min(
+      edist_fold(raw, len, query, EDIST_MAX_CODE_UNITS, &scripts),
+      EDIST_MAX_CODE_UNITS);
 
-  for (int i = 0; i < edist_ctx.count; i++) {
-    user_locale_t *locale = &edist_ctx.locales[i];
-    uint8_t tag_score = edist_calc(query, query_idxs, query_len, locale->tag,
-                                   idxs, locale->tag_len);
-    uint8_t name_score = edist_calc(query, query_idxs, query_len, locale->name,
-                                    idxs, locale->name_len);
-    edist_ctx.buf[i] = edist_min(tag_score, name_score);
-  }
+  edist_mask_scripts(scripts, mask);
+  return edist_run(query, query_len, mask, k);
 }
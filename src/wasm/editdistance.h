@@ -4,9 +4,9 @@
  * The unit of difference is a Unicode code point, which is not always the
  * same as a UTF-16 code unit.
  *
- * Both strings must contain < 256 UTF-16 code units. This limitation exists
- * only to ensure that edist_calc() never needs to dynamically allocate memory
- * and could be easily removed.
+ * Both strings must contain < 256 UTF-16 code units, and the shorter one at
+ * most 64 code points, so that edist_calc() never needs to dynamically
+ * allocate memory and each DP column fits in a 64-bit word.
  */
 
 #pragma once
@@ -29,170 +29,274 @@ static inline uint8_t edist_is_surrogate(uint16_t code_unit) {
          code_unit <= EDIST_UTF16_MAX_SURROGATE;
 }
 
-static inline uint8_t edist_is_surrogate_pair(uint8_t idxs[], uint8_t i) {
-  return idxs[i] > (i ? idxs[i - 1] : 0) + 1;
+/**
+ * Decode a UTF-16 string into one 32-bit value per Unicode code point.
+ *
+ * A surrogate pair becomes its two code units side by side, high bits first,
+ * rather than its code point. Values compare equal exactly when their code
+ * units do, even for unpaired or misordered surrogates, and never collide
+ * with a lone code unit.
+ *
+ * @param s UTF-16 code units in the string. Not null terminated.
+ * @param idxs Index map for `s`.
+ * @param len Length of the string in Unicode code points.
+ * @param[out] out Buffer for `len` values.
+ */
+static void edist_utf16_decode(uint16_t s[], uint8_t idxs[], uint8_t len,
+                               uint32_t out[]) {
+  for (uint8_t i = 0, k = 0; i < len; k = idxs[i++])
+    out[i] = idxs[i] - k > 1 ? (uint32_t)s[k] << 16 | s[k + 1] : s[k];
 }
 
-static uint8_t edist_utf16_eq(uint16_t s1[], uint8_t idxs1[], uint8_t i,
-                              uint16_t s2[], uint8_t idxs2[], uint8_t j) {
-  uint8_t is_pair = edist_is_surrogate_pair(idxs1, i);
-  if (is_pair != edist_is_surrogate_pair(idxs2, j))
-    return 0;
-
-  uint8_t k1 = idxs1[i] - 1 - is_pair;
-  uint8_t k2 = idxs2[j] - 1 - is_pair;
-  uint8_t is_first_eq = s1[k1] == s2[k2];
-  if (!is_pair || !is_first_eq)
-    return is_first_eq;
+/** State of edist_osa() after some prefix of the second string. */
+typedef struct edist_osa_state_t {
+  uint64_t vp;  /** Positive vertical differences. */
+  uint64_t vn;  /** Negative vertical differences. */
+  uint64_t d0;  /** Diagonal zero differences. */
+  uint64_t pm;  /** Positions matching the last code point. */
+  uint8_t dist; /** Edit distance from the prefix. */
+} edist_osa_state_t;
 
-  return s1[k1 + 1] == s2[k2 + 1];
+/**
+ * Reset to the empty prefix of the second string.
+ * @param[out] s Pointer to a state.
+ * @param m Length of the first string, at most 64.
+ */
+static inline void edist_osa_init(edist_osa_state_t *s, uint8_t m) {
+  *s = (edist_osa_state_t){.vp = ~(uint64_t)0, .dist = m};
 }
 
-static void edist_utf16_swap_first_two(uint16_t s[], uint8_t idxs[]) {
-  uint8_t code_units = idxs[1];
-  for (uint8_t rotate = idxs[1] - idxs[0]; rotate; rotate--) {
-    uint16_t right = s[code_units - 1];
-    for (uint8_t i = code_units - 1; i; i--)
-      s[i] = s[i - 1];
-    s[0] = right;
-  }
-  uint8_t tmp = idxs[0];
-  idxs[0] = idxs[1] - idxs[0];
-  idxs[1] = idxs[0] + tmp;
+/**
+ * Extend the prefix of the second string by one code point.
+ * @param s Pointer to a state.
+ * @param pm Positions in the first string that match the code point.
+ * @param m Length of the first string, from 1 to 64.
+ */
+static inline void edist_osa_step(edist_osa_state_t *s, uint64_t pm,
+                                  uint8_t m) {
+  uint64_t last = (uint64_t)1 << (m - 1);
+  uint64_t tr = ((~s->d0 & pm) << 1) & s->pm;
+  uint64_t d0 = (((pm & s->vp) + s->vp) ^ s->vp) | pm | s->vn | tr;
+  uint64_t hp = s->vn | ~(d0 | s->vp);
+  uint64_t hn = d0 & s->vp;
+
+  s->dist += !!(hp & last);
+  s->dist -= !!(hn & last);
+
+  hp = hp << 1 | 1;
+  s->vp = hn << 1 | ~(d0 | hp);
+  s->vn = hp & d0;
+  s->d0 = d0;
+  s->pm = pm;
 }
 
-static uint8_t edist_calc_le2(uint16_t s1[], uint8_t idxs1[], uint8_t len1,
-                              uint16_t s2[], uint8_t idxs2[], uint8_t len2) {
-  uint8_t found_second = 0;
-  uint8_t found_first = 0;
-  uint8_t first = 0;
-
-  for (uint8_t i = 0; i < len1 && !found_first; i++) {
-    if (edist_utf16_eq(s1, idxs1, i, s2, idxs2, 0)) {
-      found_first = 1;
-      first = i;
-    }
-  }
-
-  if (len2 == 1)
-    return len1 - found_first;
-
-  if (found_first && first == len1 - 1) {
-    found_first = 0;
-    first = 0;
-  }
-
-  for (uint8_t i = first + 1; i < len1 && !found_second; i++)
-    found_second = edist_utf16_eq(s1, idxs1, i, s2, idxs2, 1);
-
-  return len1 - found_first - found_second;
+/**
+ * Bound the edit distance from any extension of the prefix from below.
+ *
+ * Every alignment of the first string with an extension of the prefix
+ * passes through the prefix's last column of the DP matrix, and no later
+ * column has a lesser minimum. That minimum is at least the top of the
+ * column less every negative difference below it, and at least the bottom
+ * less every positive difference above it.
+ *
+ * @param s Pointer to a state.
+ * @param m Length of the first string, from 1 to 64.
+ * @param n Length of the prefix.
+ * @return Lower bound on the edit distance.
+ */
+static inline uint8_t edist_osa_bound(const edist_osa_state_t *s, uint8_t m,
+                                      uint8_t n) {
+  uint64_t mask = ~(uint64_t)0 >> (64 - m);
+  int from_top = n - __builtin_popcountll(s->vn & mask);
+  int from_bottom = s->dist - __builtin_popcountll(s->vp & mask);
+  return edist_max(edist_max(from_top, from_bottom), 0);
 }
 
 /**
- * Compute edit distance between two UTF-16 strings.
+ * Compute the edit distance between two strings of code points.
  *
- * Wagner-Fischer (detects adjacent transposition) with memory reduction and
- * branch pruning.
+ * Hyyro's bit-parallel algorithm for optimal string alignment distance, i.e.
+ * Levenshtein distance that also counts an adjacent transposition as one
+ * edit. Each column of the DP matrix is encoded as vertical differences in
+ * one 64-bit word, so each code point of the longer string costs a handful
+ * of word operations instead of a pass over the shorter string.
  *
- * cf. https://en.wikipedia.org/wiki/Damerau%E2%80%93Levenshtein_distance
- * cf. https://ceptord.net/wagner-fischer/index.html
+ * cf. https://doi.org/10.1007/978-3-540-44888-8_12 (Myers, 1999)
+ * cf. https://www.researchgate.net/publication/2818799 (Hyyro, 2003)
  *
- * @param s1 UTF-16 code units in the first string. Not null terminated.
- * @param idxs1 Index map for `s1`.
- * @param len1 Length of the first string in Unicode code points.
- * @param s2 UTF-16 code units in the second string Not null terminated.
- * @param idxs2 Index map for `s2`.
- * @param len2 Length of the second string in Unicode code points.
+ * @param p Code points in the first string.
+ * @param m Length of the first string.
+ * @param t Code points in the second string.
+ * @param n Length of the second string.
  * @return Edit distance between the strings.
+ * @note The shorter string must be at most 64 code points long.
  */
-uint8_t edist_calc(uint16_t s1[], uint8_t idxs1[], uint8_t len1,
-                   uint16_t s2[], uint8_t idxs2[], uint8_t len2) {
-  if (len1 < len2)
-    return edist_calc(s2, idxs2, len2, s1, idxs1, len1);
-
-  if (!len2)
-    return len1;
-
-  if (len2 == 1)
-    return edist_calc_le2(s1, idxs1, len1, s2, idxs2, len2);
-
-  if (len2 == 2) {
-    edist_utf16_swap_first_two(s2, idxs2);
-    uint8_t cand = edist_calc_le2(s1, idxs1, len1, s2, idxs2, len2);
-    edist_utf16_swap_first_two(s2, idxs2);
-    return edist_min(cand, edist_calc_le2(s1, idxs1, len1, s2, idxs2, len2));
+static uint8_t edist_osa(uint32_t p[], uint8_t m, uint32_t t[], uint8_t n) {
+  if (m > n)
+    return edist_osa(t, n, p, m);
+
+  if (!m)
+    return n;
+
+  edist_osa_state_t state;
+  edist_osa_init(&state, m);
+
+  for (uint8_t j = 0; j < n; j++) {
+    /* Positions in the shorter string that match this code point. */
+    uint64_t pm = 0;
+    for (uint8_t i = 0; i < m; i++)
+      pm |= (uint64_t)(p[i] == t[j]) << i;
+    edist_osa_step(&state, pm, m);
   }
 
-  uint8_t buf_len = edist_max(len1, len2) + 1;
-
-  uint8_t actual_buf0[buf_len];
-  uint8_t actual_buf1[buf_len];
-  uint8_t actual_buf2[buf_len];
-
-  uint8_t *buf0 = actual_buf0;
-  uint8_t *buf1 = actual_buf1;
-  uint8_t *buf2 = actual_buf2;
-
-  uint8_t rlimit = (len2 - 1) / 2;
-  int16_t llimit = len2 - len1 - rlimit + 1;
+  return state.dist;
+}
 
-  for (uint8_t i = 0; i <= rlimit; i++)
-    buf0[i] = i;
+/** Log2 of the slots in a pattern's match table, twice 64 code points. */
+#define EDIST_PATTERN_SLOT_BITS 7
+#define EDIST_PATTERN_SLOTS     (1 << EDIST_PATTERN_SLOT_BITS)
 
-  for (uint8_t i = 1; i <= len1; i++) {
-    uint8_t *tmp = buf2;
-    buf2 = buf1;
-    buf1 = buf0;
-    buf0 = tmp;
+/** A string prepared for comparison with many others. */
+typedef struct edist_pattern_t {
+  uint32_t keys[EDIST_PATTERN_SLOTS];   /** Code points, open addressed. */
+  uint64_t masks[EDIST_PATTERN_SLOTS];  /** Positions of each, 0 if free. */
+  uint8_t len;                          /** Length in code points. */
+} edist_pattern_t;
 
-    buf0[0] = i;
+static inline uint32_t edist_pattern_slot(uint32_t c) {
+  return (c * 0x9e3779b1U) >> (32 - EDIST_PATTERN_SLOT_BITS);
+}
 
-    uint8_t l = edist_max(llimit++, 1);
-    uint8_t r = edist_min(rlimit++, len2);
+/**
+ * Find the positions in a pattern that match a code point.
+ * @param pat Pointer to a pattern.
+ * @param c Code point, as from edist_utf16_decode().
+ * @return Bit i is set if the pattern's code point i is `c`.
+ */
+static inline uint64_t edist_pattern_match(const edist_pattern_t *pat,
+                                           uint32_t c) {
+  uint32_t slot = edist_pattern_slot(c);
 
-    uint8_t up_left = buf1[l - 1];
-    uint8_t up = buf1[l];
+  for (; pat->masks[slot]; slot = (slot + 1) % EDIST_PATTERN_SLOTS)
+    if (pat->keys[slot] == c)
+      return pat->masks[slot];
 
-    if (!edist_utf16_eq(s1, idxs1, i - 1, s2, idxs2, l - 1))
-      up_left = edist_min(up_left, up) + 1;
+  return 0;
+}
 
-    uint8_t left = up_left;
-    buf0[l] = up_left;
-    up_left = up;
+/**
+ * Prepare a string for comparison with edist_osa_step().
+ * @param[out] pat Pointer to a pattern.
+ * @param p Code points in the string, as from edist_utf16_decode().
+ * @param m Length of the string, at most 64.
+ */
+static inline void edist_pattern_init(edist_pattern_t *pat, uint32_t p[],
+                                      uint8_t m) {
+  for (uint32_t slot = 0; slot < EDIST_PATTERN_SLOTS; slot++)
+    pat->masks[slot] = 0;
+
+  for (uint8_t i = 0; i < m; i++) {
+    uint32_t slot = edist_pattern_slot(p[i]);
+    while (pat->masks[slot] && pat->keys[slot] != p[i])
+      slot = (slot + 1) % EDIST_PATTERN_SLOTS;
+    pat->keys[slot] = p[i];
+    pat->masks[slot] |= (uint64_t)1 << i;
+  }
 
-    if (i > 1 && l > 1 && edist_utf16_eq(s1, idxs1, i - 1, s2, idxs2, l - 2)
-                       && edist_utf16_eq(s1, idxs1, i - 2, s2, idxs2, l - 1))
-      buf0[l] = edist_min(buf0[l], buf2[l - 2] + 1);
+  pat->len = m;
+}
 
-    for (uint8_t j = l + 1; j <= r; j++) {
-      up = buf1[j];
+/** Count of strings that edist_lanes_step() compares at once. */
+#define EDIST_LANES 8
 
-      if (!edist_utf16_eq(s1, idxs1, i - 1, s2, idxs2, j - 1))
-        up_left = edist_min(edist_min(up_left, up), left) + 1;
+/**
+ * One 64-bit word per lane. Each operation on it compiles to a few Wasm SIMD
+ * instructions with -msimd128, or to scalar code without.
+ */
+typedef uint64_t edist_lanes_t
+    __attribute__((vector_size(EDIST_LANES * sizeof(uint64_t))));
 
-      left = up_left;
-      buf0[j] = up_left;
-      up_left = up;
+/**
+ * State of edist_osa() for `EDIST_LANES` patterns, one per lane, after some
+ * prefix of a text that they all share.
+ */
+typedef struct edist_lanes_state_t {
+  edist_lanes_t vp; /** Positive vertical differences. */
+  edist_lanes_t vn; /** Negative vertical differences. */
+  edist_lanes_t d0; /** Diagonal zero differences. */
+  edist_lanes_t pm; /** Positions matching the last code point. */
+} edist_lanes_state_t;
 
-      if (i > 1 && j > 1 && edist_utf16_eq(s1, idxs1, i - 1, s2, idxs2, j - 2)
-                         && edist_utf16_eq(s1, idxs1, i - 2, s2, idxs2, j - 1))
-        buf0[j] = edist_min(buf0[j], buf2[j - 2] + 1);
-    }
+/**
+ * Reset lanes to the empty prefix of a text.
+ * @param[out] s Pointer to a lane state.
+ * @note Each lane's distance starts out as the length of its pattern.
+ */
+static inline void edist_lanes_init(edist_lanes_state_t *s) {
+  edist_lanes_t zero = {0};
+  s->vp = ~zero;
+  s->vn = s->d0 = s->pm = zero;
+}
 
-    if (r == len2)
+/**
+ * Extend the text shared by every lane by one code point.
+ *
+ * Runs one iteration of edist_osa() on every lane at once, so that a text
+ * that grows a code point at a time costs one step per code point rather
+ * than starting over.
+ *
+ * @param s Pointer to a lane state.
+ * @param pm Pointer to the positions in each lane's pattern that match the
+ *  code point.
+ * @param lens Length of each lane's pattern, at most 64.
+ * @param[in,out] dists Edit distance of each lane's pattern from the text.
+ */
+static inline void edist_lanes_step(edist_lanes_state_t *s,
+                                    const edist_lanes_t *pm,
+                                    const uint8_t lens[EDIST_LANES],
+                                    uint8_t dists[EDIST_LANES]) {
+  edist_lanes_t tr = ((~s->d0 & *pm) << 1) & s->pm;
+  edist_lanes_t d0 = (((*pm & s->vp) + s->vp) ^ s->vp) | *pm | s->vn | tr;
+  edist_lanes_t hp = s->vn | ~(d0 | s->vp);
+  edist_lanes_t hn = d0 & s->vp;
+
+  for (uint8_t k = 0; k < EDIST_LANES; k++) {
+    if (!lens[k]) {
+      dists[k]++;
       continue;
+    }
+    dists[k] += hp[k] >> (lens[k] - 1) & 1;
+    dists[k] -= hn[k] >> (lens[k] - 1) & 1;
+  }
 
-    if (!edist_utf16_eq(s1, idxs1, i - 1, s2, idxs2, r))
-      up_left = edist_min(up_left, left) + 1;
-
-    buf0[r + 1] = up_left;
+  hp = hp << 1 | 1;
+  s->vp = hn << 1 | ~(d0 | hp);
+  s->vn = hp & d0;
+  s->d0 = d0;
+  s->pm = *pm;
+}
 
-    if (i > 1 && r > 0 && edist_utf16_eq(s1, idxs1, i - 1, s2, idxs2, r - 1)
-                       && edist_utf16_eq(s1, idxs1, i - 2, s2, idxs2, r))
-      buf0[r + 1] = edist_min(buf0[r + 1], buf2[r - 1] + 1);
-  }
+/**
+ * Compute edit distance between two UTF-16 strings.
+ *
+ * Both strings are decoded once, then compared with edist_osa().
+ *
+ * @param s1 UTF-16 code units in the first string. Not null terminated.
+ * @param idxs1 Index map for `s1`.
+ * @param len1 Length of the first string in Unicode code points.
+ * @param s2 UTF-16 code units in the second string Not null terminated.
+ * @param idxs2 Index map for `s2`.
+ * @param len2 Length of the second string in Unicode code points.
+ * @return Edit distance between the strings.
+ */
+uint8_t edist_calc(uint16_t s1[], uint8_t idxs1[], uint8_t len1,
+                   uint16_t s2[], uint8_t idxs2[], uint8_t len2) {
+  uint32_t p1[len1 ? len1 : 1];
+  uint32_t p2[len2 ? len2 : 1];
 
-  return buf0[len2];
+  edist_utf16_decode(s1, idxs1, len1, p1);
+  edist_utf16_decode(s2, idxs2, len2, p2);
+  return edist_osa(p1, len1, p2, len2);
 }
 
 /**
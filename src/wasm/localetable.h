@@ -0,0 +1,846 @@
+/* Generated by scripts/localetable.py */
+
+#pragma once
+
+#include <stdint.h>
+
+#define EDIST_TABLE_LOCALES 196
+
+/** Folded locale tag and display name, as offsets into the pool. */
+typedef struct edist_table_locale_t {
+  uint16_t tag;     /** Tag, with any fake script subtag. */
+  uint8_t tag_len;  /** Tag length. */
+  uint8_t fake_at;  /** Index of the fake script subtag, or 0. */
+  uint16_t name;    /** Display name. */
+  uint8_t name_len; /** Display name length. */
+  uint64_t scripts; /** Bit i set if in script i (casefoldingmap.h). */
+} edist_table_locale_t;
+
+static const uint32_t kEdistTablePool[] = {
+    0x0061, 0x0066, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x007a,
+    0x0061, 0x0061, 0x0066, 0x0072, 0x0069, 0x006b, 0x0061, 0x0061, 0x006e,
+    0x0073, 0x0020, 0x0028, 0x0073, 0x0075, 0x0069, 0x0064, 0x002d, 0x0061,
+    0x0066, 0x0072, 0x0069, 0x006b, 0x0061, 0x0029, 0x0061, 0x006d, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0065, 0x0074, 0x12a0, 0x121b,
+    0x122d, 0x129b, 0x0020, 0x0028, 0x12a2, 0x1275, 0x12ee, 0x1335, 0x12eb,
+    0x0029, 0x0061, 0x0072, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x0061, 0x0065, 0x0627, 0x0644, 0x0639, 0x0631, 0x0628, 0x064a, 0x0629,
+    0x0020, 0x0028, 0x0627, 0x0644, 0x0627, 0x0655, 0x0645, 0x0627, 0x0631,
+    0x0627, 0x062a, 0x0020, 0x0627, 0x0644, 0x0639, 0x0631, 0x0628, 0x064a,
+    0x0629, 0x0020, 0x0627, 0x0644, 0x0645, 0x062a, 0x062d, 0x062f, 0x0629,
+    0x0029, 0x0061, 0x0072, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x0062, 0x0068, 0x0627, 0x0644, 0x0639, 0x0631, 0x0628, 0x064a, 0x0629,
+    0x0020, 0x0028, 0x0627, 0x0644, 0x0628, 0x062d, 0x0631, 0x064a, 0x0646,
+    0x0029, 0x0061, 0x0072, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x0064, 0x007a, 0x0627, 0x0644, 0x0639, 0x0631, 0x0628, 0x064a, 0x0629,
+    0x0020, 0x0028, 0x0627, 0x0644, 0x062c, 0x0632, 0x0627, 0x064a, 0x0654,
+    0x0631, 0x0029, 0x0061, 0x0072, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x002d, 0x0065, 0x0067, 0x0627, 0x0644, 0x0639, 0x0631, 0x0628, 0x064a,
+    0x0629, 0x0020, 0x0028, 0x0645, 0x0635, 0x0631, 0x0029, 0x0061, 0x0072,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0069, 0x0071, 0x0627,
+    0x0644, 0x0639, 0x0631, 0x0628, 0x064a, 0x0629, 0x0020, 0x0028, 0x0627,
+    0x0644, 0x0639, 0x0631, 0x0627, 0x0642, 0x0029, 0x0061, 0x0072, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x006a, 0x006f, 0x0627, 0x0644,
+    0x0639, 0x0631, 0x0628, 0x064a, 0x0629, 0x0020, 0x0028, 0x0627, 0x0644,
+    0x0627, 0x0654, 0x0631, 0x062f, 0x0646, 0x0029, 0x0061, 0x0072, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x006b, 0x0077, 0x0627, 0x0644,
+    0x0639, 0x0631, 0x0628, 0x064a, 0x0629, 0x0020, 0x0028, 0x0627, 0x0644,
+    0x0643, 0x0648, 0x064a, 0x062a, 0x0029, 0x0061, 0x0072, 0x002d, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x002d, 0x006c, 0x0062, 0x0627, 0x0644, 0x0639,
+    0x0631, 0x0628, 0x064a, 0x0629, 0x0020, 0x0028, 0x0644, 0x0628, 0x0646,
+    0x0627, 0x0646, 0x0029, 0x0061, 0x0072, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x006c, 0x0079, 0x0627, 0x0644, 0x0639, 0x0631, 0x0628,
+    0x064a, 0x0629, 0x0020, 0x0028, 0x0644, 0x064a, 0x0628, 0x064a, 0x0627,
+    0x0029, 0x0061, 0x0072, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x006d, 0x0061, 0x0627, 0x0644, 0x0639, 0x0631, 0x0628, 0x064a, 0x0629,
+    0x0020, 0x0028, 0x0627, 0x0644, 0x0645, 0x063a, 0x0631, 0x0628, 0x0029,
+    0x0061, 0x0072, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x006f,
+    0x006d, 0x0627, 0x0644, 0x0639, 0x0631, 0x0628, 0x064a, 0x0629, 0x0020,
+    0x0028, 0x0639, 0x064f, 0x0645, 0x0627, 0x0646, 0x0029, 0x0061, 0x0072,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0071, 0x0061, 0x0627,
+    0x0644, 0x0639, 0x0631, 0x0628, 0x064a, 0x0629, 0x0020, 0x0028, 0x0642,
+    0x0637, 0x0631, 0x0029, 0x0061, 0x0072, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x0073, 0x0061, 0x0627, 0x0644, 0x0639, 0x0631, 0x0628,
+    0x064a, 0x0629, 0x0020, 0x0028, 0x0627, 0x0644, 0x0645, 0x0645, 0x0644,
+    0x0643, 0x0629, 0x0020, 0x0627, 0x0644, 0x0639, 0x0631, 0x0628, 0x064a,
+    0x0629, 0x0020, 0x0627, 0x0644, 0x0633, 0x0639, 0x0648, 0x062f, 0x064a,
+    0x0629, 0x0029, 0x0061, 0x0072, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x002d, 0x0073, 0x0064, 0x0627, 0x0644, 0x0639, 0x0631, 0x0628, 0x064a,
+    0x0629, 0x0020, 0x0028, 0x0627, 0x0644, 0x0633, 0x0648, 0x062f, 0x0627,
+    0x0646, 0x0029, 0x0061, 0x0072, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x002d, 0x0073, 0x0079, 0x0627, 0x0644, 0x0639, 0x0631, 0x0628, 0x064a,
+    0x0629, 0x0020, 0x0028, 0x0633, 0x0648, 0x0631, 0x064a, 0x0627, 0x0029,
+    0x0061, 0x0072, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0074,
+    0x006e, 0x0627, 0x0644, 0x0639, 0x0631, 0x0628, 0x064a, 0x0629, 0x0020,
+    0x0028, 0x062a, 0x0648, 0x0646, 0x0633, 0x0029, 0x0061, 0x0072, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0079, 0x0065, 0x0627, 0x0644,
+    0x0639, 0x0631, 0x0628, 0x064a, 0x0629, 0x0020, 0x0028, 0x0627, 0x0644,
+    0x064a, 0x0645, 0x0646, 0x0029, 0x0061, 0x0073, 0x002d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x002d, 0x0069, 0x006e, 0x0985, 0x09b8, 0x09ae, 0x09c0,
+    0x09af, 0x09bc, 0x09be, 0x0020, 0x0028, 0x09ad, 0x09be, 0x09f0, 0x09a4,
+    0x0029, 0x0061, 0x007a, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x0061, 0x007a, 0x0061, 0x007a, 0x0259, 0x0072, 0x0062, 0x0061, 0x0079,
+    0x0063, 0x0061, 0x006e, 0x0063, 0x0061, 0x0020, 0x0028, 0x0061, 0x007a,
+    0x0259, 0x0072, 0x0062, 0x0061, 0x0079, 0x0063, 0x0061, 0x006e, 0x0029,
+    0x0061, 0x007a, 0x002d, 0x0063, 0x0079, 0x0072, 0x006c, 0x002d, 0x0061,
+    0x007a, 0x0430, 0x0437, 0x04d9, 0x0440, 0x0431, 0x0430, 0x0458, 0x04b9,
+    0x0430, 0x043d, 0x04b9, 0x0430, 0x0020, 0x0028, 0x043a, 0x0438, 0x0440,
+    0x0438, 0x043b, 0x002c, 0x0020, 0x0430, 0x0437, 0x04d9, 0x0440, 0x0431,
+    0x0430, 0x0458, 0x04b9, 0x0430, 0x043d, 0x0029, 0x0062, 0x0065, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0062, 0x0079, 0x0431, 0x0435,
+    0x043b, 0x0430, 0x0440, 0x0443, 0x0441, 0x043a, 0x0430, 0x044f, 0x0020,
+    0x0028, 0x0431, 0x0435, 0x043b, 0x0430, 0x0440, 0x0443, 0x0441, 0x044c,
+    0x0029, 0x0062, 0x0067, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x0062, 0x0067, 0x0431, 0x044a, 0x043b, 0x0433, 0x0430, 0x0440, 0x0441,
+    0x043a, 0x0438, 0x0020, 0x0028, 0x0431, 0x044a, 0x043b, 0x0433, 0x0430,
+    0x0440, 0x0438, 0x044f, 0x0029, 0x0062, 0x006e, 0x002d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x002d, 0x0062, 0x0064, 0x09ac, 0x09be, 0x0982, 0x09b2,
+    0x09be, 0x0020, 0x0028, 0x09ac, 0x09be, 0x0982, 0x09b2, 0x09be, 0x09a6,
+    0x09c7, 0x09b6, 0x0029, 0x0062, 0x006e, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x0069, 0x006e, 0x09ac, 0x09be, 0x0982, 0x09b2, 0x09be,
+    0x0020, 0x0028, 0x09ad, 0x09be, 0x09b0, 0x09a4, 0x0029, 0x0062, 0x006f,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0063, 0x006e, 0x0f56,
+    0x0f7c, 0x0f51, 0x0f0b, 0x0f66, 0x0f90, 0x0f51, 0x0f0b, 0x0020, 0x0028,
+    0x0f62, 0x0f92, 0x0fb1, 0x0f0b, 0x0f53, 0x0f42, 0x0029, 0x0062, 0x0072,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0066, 0x0072, 0x0062,
+    0x0072, 0x0065, 0x007a, 0x0068, 0x006f, 0x006e, 0x0065, 0x0067, 0x0020,
+    0x0028, 0x0066, 0x0072, 0x0061, 0x006e, 0x0073, 0x0029, 0x0062, 0x0073,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0062, 0x0061, 0x0062,
+    0x006f, 0x0073, 0x0061, 0x006e, 0x0073, 0x006b, 0x0069, 0x0020, 0x0028,
+    0x0062, 0x006f, 0x0073, 0x006e, 0x0061, 0x0020, 0x0069, 0x0020, 0x0068,
+    0x0065, 0x0072, 0x0063, 0x0065, 0x0067, 0x006f, 0x0076, 0x0069, 0x006e,
+    0x0061, 0x0029, 0x0062, 0x0073, 0x002d, 0x0063, 0x0079, 0x0072, 0x006c,
+    0x002d, 0x0062, 0x0061, 0x0431, 0x043e, 0x0441, 0x0430, 0x043d, 0x0441,
+    0x043a, 0x0438, 0x0020, 0x0028, 0x045b, 0x0438, 0x0440, 0x0438, 0x043b,
+    0x0438, 0x0446, 0x0430, 0x002c, 0x0020, 0x0431, 0x043e, 0x0441, 0x043d,
+    0x0430, 0x0020, 0x0438, 0x0020, 0x0445, 0x0435, 0x0440, 0x0446, 0x0435,
+    0x0433, 0x043e, 0x0432, 0x0438, 0x043d, 0x0430, 0x0029, 0x0063, 0x0061,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0065, 0x0073, 0x0063,
+    0x0061, 0x0074, 0x0061, 0x006c, 0x0061, 0x0020, 0x0028, 0x0065, 0x0073,
+    0x0070, 0x0061, 0x006e, 0x0079, 0x0061, 0x0029, 0x0063, 0x0073, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0063, 0x007a, 0x0063, 0x0065,
+    0x0073, 0x0074, 0x0069, 0x006e, 0x0061, 0x0020, 0x0028, 0x0063, 0x0065,
+    0x0073, 0x006b, 0x006f, 0x0029, 0x0063, 0x0079, 0x002d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x002d, 0x0067, 0x0062, 0x0063, 0x0079, 0x006d, 0x0072,
+    0x0061, 0x0065, 0x0067, 0x0020, 0x0028, 0x0079, 0x0020, 0x0064, 0x0065,
+    0x0079, 0x0072, 0x006e, 0x0061, 0x0073, 0x0020, 0x0075, 0x006e, 0x0065,
+    0x0064, 0x0069, 0x0067, 0x0029, 0x0064, 0x0061, 0x002d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x002d, 0x0064, 0x006b, 0x0064, 0x0061, 0x006e, 0x0073,
+    0x006b, 0x0020, 0x0028, 0x0064, 0x0061, 0x006e, 0x006d, 0x0061, 0x0072,
+    0x006b, 0x0029, 0x0064, 0x0065, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x002d, 0x0061, 0x0074, 0x0064, 0x0065, 0x0075, 0x0074, 0x0073, 0x0063,
+    0x0068, 0x0020, 0x0028, 0x006f, 0x0073, 0x0074, 0x0065, 0x0072, 0x0072,
+    0x0065, 0x0069, 0x0063, 0x0068, 0x0029, 0x0064, 0x0065, 0x002d, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x002d, 0x0063, 0x0068, 0x0064, 0x0065, 0x0075,
+    0x0074, 0x0073, 0x0063, 0x0068, 0x0020, 0x0028, 0x0073, 0x0063, 0x0068,
+    0x0077, 0x0065, 0x0069, 0x007a, 0x0029, 0x0064, 0x0065, 0x002d, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x002d, 0x0064, 0x0065, 0x0064, 0x0065, 0x0075,
+    0x0074, 0x0073, 0x0063, 0x0068, 0x0020, 0x0028, 0x0064, 0x0065, 0x0075,
+    0x0074, 0x0073, 0x0063, 0x0068, 0x006c, 0x0061, 0x006e, 0x0064, 0x0029,
+    0x0064, 0x0065, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x006c,
+    0x0069, 0x0064, 0x0065, 0x0075, 0x0074, 0x0073, 0x0063, 0x0068, 0x0020,
+    0x0028, 0x006c, 0x0069, 0x0065, 0x0063, 0x0068, 0x0074, 0x0065, 0x006e,
+    0x0073, 0x0074, 0x0065, 0x0069, 0x006e, 0x0029, 0x0064, 0x0065, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x006c, 0x0075, 0x0064, 0x0065,
+    0x0075, 0x0074, 0x0073, 0x0063, 0x0068, 0x0020, 0x0028, 0x006c, 0x0075,
+    0x0078, 0x0065, 0x006d, 0x0062, 0x0075, 0x0072, 0x0067, 0x0029, 0x0064,
+    0x0073, 0x0062, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0064,
+    0x0065, 0x0064, 0x006f, 0x006c, 0x006e, 0x006f, 0x0073, 0x0065, 0x0072,
+    0x0062, 0x0073, 0x0063, 0x0069, 0x006e, 0x0061, 0x0020, 0x0028, 0x006e,
+    0x0069, 0x006d, 0x0073, 0x006b, 0x0061, 0x0029, 0x0065, 0x006c, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0063, 0x0079, 0x03b5, 0x03bb,
+    0x03bb, 0x03b7, 0x03bd, 0x03b9, 0x03ba, 0x03b1, 0x0020, 0x0028, 0x03ba,
+    0x03c5, 0x03c0, 0x03c1, 0x03bf, 0x03c3, 0x0029, 0x0065, 0x006c, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0067, 0x0072, 0x03b5, 0x03bb,
+    0x03bb, 0x03b7, 0x03bd, 0x03b9, 0x03ba, 0x03b1, 0x0020, 0x0028, 0x03b5,
+    0x03bb, 0x03bb, 0x03b1, 0x03b4, 0x03b1, 0x0029, 0x0065, 0x006e, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0030, 0x0032, 0x0039, 0x0065,
+    0x006e, 0x0067, 0x006c, 0x0069, 0x0073, 0x0068, 0x0020, 0x0028, 0x0063,
+    0x0061, 0x0072, 0x0069, 0x0062, 0x0062, 0x0065, 0x0061, 0x006e, 0x0029,
+    0x0065, 0x006e, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0061,
+    0x0075, 0x0065, 0x006e, 0x0067, 0x006c, 0x0069, 0x0073, 0x0068, 0x0020,
+    0x0028, 0x0061, 0x0075, 0x0073, 0x0074, 0x0072, 0x0061, 0x006c, 0x0069,
+    0x0061, 0x0029, 0x0065, 0x006e, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x002d, 0x0062, 0x007a, 0x0065, 0x006e, 0x0067, 0x006c, 0x0069, 0x0073,
+    0x0068, 0x0020, 0x0028, 0x0062, 0x0065, 0x006c, 0x0069, 0x007a, 0x0065,
+    0x0029, 0x0065, 0x006e, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x0063, 0x0061, 0x0065, 0x006e, 0x0067, 0x006c, 0x0069, 0x0073, 0x0068,
+    0x0020, 0x0028, 0x0063, 0x0061, 0x006e, 0x0061, 0x0064, 0x0061, 0x0029,
+    0x0065, 0x006e, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0067,
+    0x0062, 0x0065, 0x006e, 0x0067, 0x006c, 0x0069, 0x0073, 0x0068, 0x0020,
+    0x0028, 0x0075, 0x006e, 0x0069, 0x0074, 0x0065, 0x0064, 0x0020, 0x006b,
+    0x0069, 0x006e, 0x0067, 0x0064, 0x006f, 0x006d, 0x0029, 0x0065, 0x006e,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0069, 0x0065, 0x0065,
+    0x006e, 0x0067, 0x006c, 0x0069, 0x0073, 0x0068, 0x0020, 0x0028, 0x0069,
+    0x0072, 0x0065, 0x006c, 0x0061, 0x006e, 0x0064, 0x0029, 0x0065, 0x006e,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0069, 0x006e, 0x0065,
+    0x006e, 0x0067, 0x006c, 0x0069, 0x0073, 0x0068, 0x0020, 0x0028, 0x0069,
+    0x006e, 0x0064, 0x0069, 0x0061, 0x0029, 0x0065, 0x006e, 0x002d, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x002d, 0x006a, 0x006d, 0x0065, 0x006e, 0x0067,
+    0x006c, 0x0069, 0x0073, 0x0068, 0x0020, 0x0028, 0x006a, 0x0061, 0x006d,
+    0x0061, 0x0069, 0x0063, 0x0061, 0x0029, 0x0065, 0x006e, 0x002d, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x002d, 0x006d, 0x0074, 0x0065, 0x006e, 0x0067,
+    0x006c, 0x0069, 0x0073, 0x0068, 0x0020, 0x0028, 0x006d, 0x0061, 0x006c,
+    0x0074, 0x0061, 0x0029, 0x0065, 0x006e, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x006d, 0x0079, 0x0065, 0x006e, 0x0067, 0x006c, 0x0069,
+    0x0073, 0x0068, 0x0020, 0x0028, 0x006d, 0x0061, 0x006c, 0x0061, 0x0079,
+    0x0073, 0x0069, 0x0061, 0x0029, 0x0065, 0x006e, 0x002d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x002d, 0x006e, 0x007a, 0x0065, 0x006e, 0x0067, 0x006c,
+    0x0069, 0x0073, 0x0068, 0x0020, 0x0028, 0x006e, 0x0065, 0x0077, 0x0020,
+    0x007a, 0x0065, 0x0061, 0x006c, 0x0061, 0x006e, 0x0064, 0x0029, 0x0065,
+    0x006e, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0070, 0x0068,
+    0x0065, 0x006e, 0x0067, 0x006c, 0x0069, 0x0073, 0x0068, 0x0020, 0x0028,
+    0x0070, 0x0068, 0x0069, 0x006c, 0x0069, 0x0070, 0x0070, 0x0069, 0x006e,
+    0x0065, 0x0073, 0x0029, 0x0065, 0x006e, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x0073, 0x0067, 0x0065, 0x006e, 0x0067, 0x006c, 0x0069,
+    0x0073, 0x0068, 0x0020, 0x0028, 0x0073, 0x0069, 0x006e, 0x0067, 0x0061,
+    0x0070, 0x006f, 0x0072, 0x0065, 0x0029, 0x0065, 0x006e, 0x002d, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x002d, 0x0074, 0x0074, 0x0065, 0x006e, 0x0067,
+    0x006c, 0x0069, 0x0073, 0x0068, 0x0020, 0x0028, 0x0074, 0x0072, 0x0069,
+    0x006e, 0x0069, 0x0064, 0x0061, 0x0064, 0x0020, 0x0026, 0x0020, 0x0074,
+    0x006f, 0x0062, 0x0061, 0x0067, 0x006f, 0x0029, 0x0065, 0x006e, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0075, 0x0073, 0x0065, 0x006e,
+    0x0067, 0x006c, 0x0069, 0x0073, 0x0068, 0x0020, 0x0028, 0x0075, 0x006e,
+    0x0069, 0x0074, 0x0065, 0x0064, 0x0020, 0x0073, 0x0074, 0x0061, 0x0074,
+    0x0065, 0x0073, 0x0029, 0x0065, 0x006e, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x007a, 0x0061, 0x0065, 0x006e, 0x0067, 0x006c, 0x0069,
+    0x0073, 0x0068, 0x0020, 0x0028, 0x0073, 0x006f, 0x0075, 0x0074, 0x0068,
+    0x0020, 0x0061, 0x0066, 0x0072, 0x0069, 0x0063, 0x0061, 0x0029, 0x0065,
+    0x006e, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x007a, 0x0077,
+    0x0065, 0x006e, 0x0067, 0x006c, 0x0069, 0x0073, 0x0068, 0x0020, 0x0028,
+    0x007a, 0x0069, 0x006d, 0x0062, 0x0061, 0x0062, 0x0077, 0x0065, 0x0029,
+    0x0065, 0x0073, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0061,
+    0x0072, 0x0065, 0x0073, 0x0070, 0x0061, 0x006e, 0x006f, 0x006c, 0x0020,
+    0x0028, 0x0061, 0x0072, 0x0067, 0x0065, 0x006e, 0x0074, 0x0069, 0x006e,
+    0x0061, 0x0029, 0x0065, 0x0073, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x002d, 0x0062, 0x006f, 0x0065, 0x0073, 0x0070, 0x0061, 0x006e, 0x006f,
+    0x006c, 0x0020, 0x0028, 0x0062, 0x006f, 0x006c, 0x0069, 0x0076, 0x0069,
+    0x0061, 0x0029, 0x0065, 0x0073, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x002d, 0x0063, 0x006c, 0x0065, 0x0073, 0x0070, 0x0061, 0x006e, 0x006f,
+    0x006c, 0x0020, 0x0028, 0x0063, 0x0068, 0x0069, 0x006c, 0x0065, 0x0029,
+    0x0065, 0x0073, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0063,
+    0x006f, 0x0065, 0x0073, 0x0070, 0x0061, 0x006e, 0x006f, 0x006c, 0x0020,
+    0x0028, 0x0063, 0x006f, 0x006c, 0x006f, 0x006d, 0x0062, 0x0069, 0x0061,
+    0x0029, 0x0065, 0x0073, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x0063, 0x0072, 0x0065, 0x0073, 0x0070, 0x0061, 0x006e, 0x006f, 0x006c,
+    0x0020, 0x0028, 0x0063, 0x006f, 0x0073, 0x0074, 0x0061, 0x0020, 0x0072,
+    0x0069, 0x0063, 0x0061, 0x0029, 0x0065, 0x0073, 0x002d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x002d, 0x0064, 0x006f, 0x0065, 0x0073, 0x0070, 0x0061,
+    0x006e, 0x006f, 0x006c, 0x0020, 0x0028, 0x0072, 0x0065, 0x0070, 0x0075,
+    0x0062, 0x006c, 0x0069, 0x0063, 0x0061, 0x0020, 0x0064, 0x006f, 0x006d,
+    0x0069, 0x006e, 0x0069, 0x0063, 0x0061, 0x006e, 0x0061, 0x0029, 0x0065,
+    0x0073, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0065, 0x0063,
+    0x0065, 0x0073, 0x0070, 0x0061, 0x006e, 0x006f, 0x006c, 0x0020, 0x0028,
+    0x0065, 0x0063, 0x0075, 0x0061, 0x0064, 0x006f, 0x0072, 0x0029, 0x0065,
+    0x0073, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0065, 0x0073,
+    0x0065, 0x0073, 0x0070, 0x0061, 0x006e, 0x006f, 0x006c, 0x0020, 0x0028,
+    0x0065, 0x0073, 0x0070, 0x0061, 0x006e, 0x0061, 0x0029, 0x0065, 0x0073,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0067, 0x0074, 0x0065,
+    0x0073, 0x0070, 0x0061, 0x006e, 0x006f, 0x006c, 0x0020, 0x0028, 0x0067,
+    0x0075, 0x0061, 0x0074, 0x0065, 0x006d, 0x0061, 0x006c, 0x0061, 0x0029,
+    0x0065, 0x0073, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0068,
+    0x006e, 0x0065, 0x0073, 0x0070, 0x0061, 0x006e, 0x006f, 0x006c, 0x0020,
+    0x0028, 0x0068, 0x006f, 0x006e, 0x0064, 0x0075, 0x0072, 0x0061, 0x0073,
+    0x0029, 0x0065, 0x0073, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x006d, 0x0078, 0x0065, 0x0073, 0x0070, 0x0061, 0x006e, 0x006f, 0x006c,
+    0x0020, 0x0028, 0x006d, 0x0065, 0x0078, 0x0069, 0x0063, 0x006f, 0x0029,
+    0x0065, 0x0073, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x006e,
+    0x0069, 0x0065, 0x0073, 0x0070, 0x0061, 0x006e, 0x006f, 0x006c, 0x0020,
+    0x0028, 0x006e, 0x0069, 0x0063, 0x0061, 0x0072, 0x0061, 0x0067, 0x0075,
+    0x0061, 0x0029, 0x0065, 0x0073, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x002d, 0x0070, 0x0061, 0x0065, 0x0073, 0x0070, 0x0061, 0x006e, 0x006f,
+    0x006c, 0x0020, 0x0028, 0x0070, 0x0061, 0x006e, 0x0061, 0x006d, 0x0061,
+    0x0029, 0x0065, 0x0073, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x0070, 0x0065, 0x0065, 0x0073, 0x0070, 0x0061, 0x006e, 0x006f, 0x006c,
+    0x0020, 0x0028, 0x0070, 0x0065, 0x0072, 0x0075, 0x0029, 0x0065, 0x0073,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0070, 0x0072, 0x0065,
+    0x0073, 0x0070, 0x0061, 0x006e, 0x006f, 0x006c, 0x0020, 0x0028, 0x0070,
+    0x0075, 0x0065, 0x0072, 0x0074, 0x006f, 0x0020, 0x0072, 0x0069, 0x0063,
+    0x006f, 0x0029, 0x0065, 0x0073, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x002d, 0x0070, 0x0079, 0x0065, 0x0073, 0x0070, 0x0061, 0x006e, 0x006f,
+    0x006c, 0x0020, 0x0028, 0x0070, 0x0061, 0x0072, 0x0061, 0x0067, 0x0075,
+    0x0061, 0x0079, 0x0029, 0x0065, 0x0073, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x0073, 0x0076, 0x0065, 0x0073, 0x0070, 0x0061, 0x006e,
+    0x006f, 0x006c, 0x0020, 0x0028, 0x0065, 0x006c, 0x0020, 0x0073, 0x0061,
+    0x006c, 0x0076, 0x0061, 0x0064, 0x006f, 0x0072, 0x0029, 0x0065, 0x0073,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0075, 0x0073, 0x0065,
+    0x0073, 0x0070, 0x0061, 0x006e, 0x006f, 0x006c, 0x0020, 0x0028, 0x0065,
+    0x0073, 0x0074, 0x0061, 0x0064, 0x006f, 0x0073, 0x0020, 0x0075, 0x006e,
+    0x0069, 0x0064, 0x006f, 0x0073, 0x0029, 0x0065, 0x0073, 0x002d, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x002d, 0x0075, 0x0079, 0x0065, 0x0073, 0x0070,
+    0x0061, 0x006e, 0x006f, 0x006c, 0x0020, 0x0028, 0x0075, 0x0072, 0x0075,
+    0x0067, 0x0075, 0x0061, 0x0079, 0x0029, 0x0065, 0x0073, 0x002d, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x002d, 0x0076, 0x0065, 0x0065, 0x0073, 0x0070,
+    0x0061, 0x006e, 0x006f, 0x006c, 0x0020, 0x0028, 0x0076, 0x0065, 0x006e,
+    0x0065, 0x007a, 0x0075, 0x0065, 0x006c, 0x0061, 0x0029, 0x0065, 0x0074,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0065, 0x0065, 0x0065,
+    0x0065, 0x0073, 0x0074, 0x0069, 0x0020, 0x0028, 0x0065, 0x0065, 0x0073,
+    0x0074, 0x0069, 0x0029, 0x0065, 0x0075, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x0065, 0x0073, 0x0065, 0x0075, 0x0073, 0x006b, 0x0061,
+    0x0072, 0x0061, 0x0020, 0x0028, 0x0065, 0x0073, 0x0070, 0x0061, 0x0069,
+    0x006e, 0x0069, 0x0061, 0x0029, 0x0066, 0x0061, 0x002d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x002d, 0x0061, 0x0066, 0x0641, 0x0627, 0x0631, 0x0633,
+    0x06cc, 0x0020, 0x0028, 0x0627, 0x0641, 0x063a, 0x0627, 0x0646, 0x0633,
+    0x062a, 0x0627, 0x0646, 0x0029, 0x0066, 0x0061, 0x002d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x002d, 0x0069, 0x0072, 0x0641, 0x0627, 0x0631, 0x0633,
+    0x06cc, 0x0020, 0x0028, 0x0627, 0x06cc, 0x0631, 0x0627, 0x0646, 0x0029,
+    0x0066, 0x0069, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0066,
+    0x0069, 0x0073, 0x0075, 0x006f, 0x006d, 0x0069, 0x0020, 0x0028, 0x0073,
+    0x0075, 0x006f, 0x006d, 0x0069, 0x0029, 0x0066, 0x0069, 0x006c, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0070, 0x0068, 0x0066, 0x0069,
+    0x006c, 0x0069, 0x0070, 0x0069, 0x006e, 0x006f, 0x0020, 0x0028, 0x0070,
+    0x0069, 0x006c, 0x0069, 0x0070, 0x0069, 0x006e, 0x0061, 0x0073, 0x0029,
+    0x0066, 0x006f, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0066,
+    0x006f, 0x0066, 0x00f8, 0x0072, 0x006f, 0x0079, 0x0073, 0x006b, 0x0074,
+    0x0020, 0x0028, 0x0066, 0x00f8, 0x0072, 0x006f, 0x0079, 0x0061, 0x0072,
+    0x0029, 0x0066, 0x0072, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x0062, 0x0065, 0x0066, 0x0072, 0x0061, 0x006e, 0x0063, 0x0061, 0x0069,
+    0x0073, 0x0020, 0x0028, 0x0062, 0x0065, 0x006c, 0x0067, 0x0069, 0x0071,
+    0x0075, 0x0065, 0x0029, 0x0066, 0x0072, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x0063, 0x0061, 0x0066, 0x0072, 0x0061, 0x006e, 0x0063,
+    0x0061, 0x0069, 0x0073, 0x0020, 0x0028, 0x0063, 0x0061, 0x006e, 0x0061,
+    0x0064, 0x0061, 0x0029, 0x0066, 0x0072, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x0063, 0x0068, 0x0066, 0x0072, 0x0061, 0x006e, 0x0063,
+    0x0061, 0x0069, 0x0073, 0x0020, 0x0028, 0x0073, 0x0075, 0x0069, 0x0073,
+    0x0073, 0x0065, 0x0029, 0x0066, 0x0072, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x0066, 0x0072, 0x0066, 0x0072, 0x0061, 0x006e, 0x0063,
+    0x0061, 0x0069, 0x0073, 0x0020, 0x0028, 0x0066, 0x0072, 0x0061, 0x006e,
+    0x0063, 0x0065, 0x0029, 0x0066, 0x0072, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x006c, 0x0075, 0x0066, 0x0072, 0x0061, 0x006e, 0x0063,
+    0x0061, 0x0069, 0x0073, 0x0020, 0x0028, 0x006c, 0x0075, 0x0078, 0x0065,
+    0x006d, 0x0062, 0x006f, 0x0075, 0x0072, 0x0067, 0x0029, 0x0066, 0x0072,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x006d, 0x0063, 0x0066,
+    0x0072, 0x0061, 0x006e, 0x0063, 0x0061, 0x0069, 0x0073, 0x0020, 0x0028,
+    0x006d, 0x006f, 0x006e, 0x0061, 0x0063, 0x006f, 0x0029, 0x0066, 0x0079,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x006e, 0x006c, 0x0066,
+    0x0072, 0x0079, 0x0073, 0x006b, 0x0020, 0x0028, 0x006e, 0x0065, 0x0064,
+    0x0065, 0x0072, 0x006c, 0x0061, 0x006e, 0x0029, 0x0067, 0x0061, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0069, 0x0065, 0x0067, 0x0061,
+    0x0065, 0x0069, 0x006c, 0x0067, 0x0065, 0x0020, 0x0028, 0x0065, 0x0069,
+    0x0072, 0x0065, 0x0029, 0x0067, 0x0064, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x0067, 0x0062, 0x0067, 0x0061, 0x0069, 0x0064, 0x0068,
+    0x006c, 0x0069, 0x0067, 0x0020, 0x0028, 0x0061, 0x006e, 0x0020, 0x0072,
+    0x0069, 0x006f, 0x0067, 0x0068, 0x0061, 0x0063, 0x0068, 0x0064, 0x0020,
+    0x0061, 0x006f, 0x006e, 0x0061, 0x0069, 0x0063, 0x0068, 0x0074, 0x0065,
+    0x0029, 0x0067, 0x0064, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x0069, 0x0065, 0x0067, 0x0061, 0x0069, 0x0064, 0x0068, 0x006c, 0x0069,
+    0x0067, 0x0020, 0x0028, 0x0065, 0x0069, 0x0072, 0x0069, 0x006e, 0x006e,
+    0x0029, 0x0067, 0x006c, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x0065, 0x0073, 0x0067, 0x0061, 0x006c, 0x0065, 0x0067, 0x006f, 0x0020,
+    0x0028, 0x0065, 0x0073, 0x0070, 0x0061, 0x006e, 0x0061, 0x0029, 0x0067,
+    0x0073, 0x0077, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0066,
+    0x0072, 0x0073, 0x0063, 0x0068, 0x0077, 0x0069, 0x0069, 0x007a, 0x0065,
+    0x0072, 0x0074, 0x0075, 0x0075, 0x0074, 0x0073, 0x0063, 0x0068, 0x0020,
+    0x0028, 0x0066, 0x0072, 0x0061, 0x006e, 0x006b, 0x0072, 0x0069, 0x0069,
+    0x0063, 0x0068, 0x0029, 0x0067, 0x0075, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x0069, 0x006e, 0x0a97, 0x0ac1, 0x0a9c, 0x0ab0, 0x0abe,
+    0x0aa4, 0x0ac0, 0x0020, 0x0028, 0x0aad, 0x0abe, 0x0ab0, 0x0aa4, 0x0029,
+    0x0068, 0x0061, 0x002d, 0x006c, 0x0061, 0x0074, 0x006e, 0x002d, 0x006e,
+    0x0067, 0x0068, 0x0061, 0x0075, 0x0073, 0x0061, 0x0020, 0x0028, 0x006c,
+    0x0061, 0x0074, 0x0069, 0x006e, 0x002c, 0x0020, 0x006e, 0x0069, 0x006a,
+    0x0065, 0x0072, 0x0069, 0x0079, 0x0061, 0x0029, 0x0068, 0x0065, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0069, 0x006c, 0x05e2, 0x05d1,
+    0x05e8, 0x05d9, 0x05ea, 0x0020, 0x0028, 0x05d9, 0x05e9, 0x05e8, 0x05d0,
+    0x05dc, 0x0029, 0x0068, 0x0069, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x002d, 0x0069, 0x006e, 0x0939, 0x093f, 0x0928, 0x094d, 0x0926, 0x0940,
+    0x0020, 0x0028, 0x092d, 0x093e, 0x0930, 0x0924, 0x0029, 0x0068, 0x0072,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0062, 0x0061, 0x0068,
+    0x0072, 0x0076, 0x0061, 0x0074, 0x0073, 0x006b, 0x0069, 0x0020, 0x0028,
+    0x0062, 0x006f, 0x0073, 0x006e, 0x0061, 0x0020, 0x0069, 0x0020, 0x0068,
+    0x0065, 0x0072, 0x0063, 0x0065, 0x0067, 0x006f, 0x0076, 0x0069, 0x006e,
+    0x0061, 0x0029, 0x0068, 0x0072, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x002d, 0x0068, 0x0072, 0x0068, 0x0072, 0x0076, 0x0061, 0x0074, 0x0073,
+    0x006b, 0x0069, 0x0020, 0x0028, 0x0068, 0x0072, 0x0076, 0x0061, 0x0074,
+    0x0073, 0x006b, 0x0061, 0x0029, 0x0068, 0x0073, 0x0062, 0x002d, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x002d, 0x0064, 0x0065, 0x0068, 0x006f, 0x0072,
+    0x006e, 0x006a, 0x006f, 0x0073, 0x0065, 0x0072, 0x0062, 0x0073, 0x0063,
+    0x0069, 0x006e, 0x0061, 0x0020, 0x0028, 0x006e, 0x0065, 0x006d, 0x0073,
+    0x006b, 0x0061, 0x0029, 0x0068, 0x0075, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x0068, 0x0075, 0x006d, 0x0061, 0x0067, 0x0079, 0x0061,
+    0x0072, 0x0020, 0x0028, 0x006d, 0x0061, 0x0067, 0x0079, 0x0061, 0x0072,
+    0x006f, 0x0072, 0x0073, 0x007a, 0x0061, 0x0067, 0x0029, 0x0068, 0x0079,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0061, 0x006d, 0x0570,
+    0x0561, 0x0575, 0x0565, 0x0580, 0x0565, 0x0576, 0x0020, 0x0028, 0x0570,
+    0x0561, 0x0575, 0x0561, 0x057d, 0x057f, 0x0561, 0x0576, 0x0029, 0x0069,
+    0x0064, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0069, 0x0064,
+    0x0069, 0x006e, 0x0064, 0x006f, 0x006e, 0x0065, 0x0073, 0x0069, 0x0061,
+    0x0020, 0x0028, 0x0069, 0x006e, 0x0064, 0x006f, 0x006e, 0x0065, 0x0073,
+    0x0069, 0x0061, 0x0029, 0x0069, 0x0067, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x006e, 0x0067, 0x0069, 0x0067, 0x0062, 0x006f, 0x0020,
+    0x0028, 0x006e, 0x0061, 0x0069, 0x006a, 0x0069, 0x0072, 0x0069, 0x0061,
+    0x0029, 0x0069, 0x0069, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x0063, 0x006e, 0xa188, 0xa320, 0xa259, 0x0020, 0x0028, 0xa34f, 0xa1e9,
+    0x0029, 0x0069, 0x0073, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x0069, 0x0073, 0x0069, 0x0073, 0x006c, 0x0065, 0x006e, 0x0073, 0x006b,
+    0x0061, 0x0020, 0x0028, 0x0069, 0x0073, 0x006c, 0x0061, 0x006e, 0x0064,
+    0x0029, 0x0069, 0x0074, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x0063, 0x0068, 0x0069, 0x0074, 0x0061, 0x006c, 0x0069, 0x0061, 0x006e,
+    0x006f, 0x0020, 0x0028, 0x0073, 0x0076, 0x0069, 0x007a, 0x007a, 0x0065,
+    0x0072, 0x0061, 0x0029, 0x0069, 0x0074, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x0069, 0x0074, 0x0069, 0x0074, 0x0061, 0x006c, 0x0069,
+    0x0061, 0x006e, 0x006f, 0x0020, 0x0028, 0x0069, 0x0074, 0x0061, 0x006c,
+    0x0069, 0x0061, 0x0029, 0x006a, 0x0061, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x006a, 0x0070, 0x65e5, 0x672c, 0x8a9e, 0x0020, 0x0028,
+    0x65e5, 0x672c, 0x0029, 0x006b, 0x0061, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x0067, 0x0065, 0x10e5, 0x10d0, 0x10e0, 0x10d7, 0x10e3,
+    0x10da, 0x10d8, 0x0020, 0x0028, 0x10e1, 0x10d0, 0x10e5, 0x10d0, 0x10e0,
+    0x10d7, 0x10d5, 0x10d4, 0x10da, 0x10dd, 0x0029, 0x006b, 0x006b, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x006b, 0x007a, 0x049b, 0x0430,
+    0x0437, 0x0430, 0x049b, 0x0448, 0x0430, 0x0020, 0x0028, 0x049b, 0x0430,
+    0x0437, 0x0430, 0x049b, 0x0441, 0x0442, 0x0430, 0x043d, 0x0029, 0x006b,
+    0x006c, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0067, 0x006c,
+    0x006b, 0x0061, 0x006c, 0x0061, 0x0061, 0x006c, 0x006c, 0x0069, 0x0073,
+    0x0075, 0x0074, 0x0020, 0x0028, 0x006b, 0x0061, 0x006c, 0x0061, 0x0061,
+    0x006c, 0x006c, 0x0069, 0x0074, 0x0020, 0x006e, 0x0075, 0x006e, 0x0061,
+    0x0061, 0x0074, 0x0029, 0x006b, 0x006d, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x006b, 0x0068, 0x1781, 0x17d2, 0x1798, 0x17c2, 0x179a,
+    0x0020, 0x0028, 0x1780, 0x1798, 0x17d2, 0x1796, 0x17bb, 0x1787, 0x17b6,
+    0x0029, 0x006b, 0x006e, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x0069, 0x006e, 0x0c95, 0x0ca8, 0x0ccd, 0x0ca8, 0x0ca1, 0x0020, 0x0028,
+    0x0cad, 0x0cbe, 0x0cb0, 0x0ca4, 0x0029, 0x006b, 0x006f, 0x002d, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x002d, 0x006b, 0x0072, 0x1112, 0x1161, 0x11ab,
+    0x1100, 0x116e, 0x11a8, 0x110b, 0x1165, 0x0020, 0x0028, 0x1103, 0x1162,
+    0x1112, 0x1161, 0x11ab, 0x1106, 0x1175, 0x11ab, 0x1100, 0x116e, 0x11a8,
+    0x0029, 0x006b, 0x006f, 0x006b, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x002d, 0x0069, 0x006e, 0x0915, 0x094b, 0x0902, 0x0915, 0x0923, 0x0940,
+    0x0020, 0x0028, 0x092d, 0x093e, 0x0930, 0x0924, 0x0029, 0x006b, 0x0079,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x006b, 0x0067, 0x043a,
+    0x044b, 0x0440, 0x0433, 0x044b, 0x0437, 0x0447, 0x0430, 0x0020, 0x0028,
+    0x043a, 0x044b, 0x0440, 0x0433, 0x044b, 0x0437, 0x0441, 0x0442, 0x0430,
+    0x043d, 0x0029, 0x006c, 0x0062, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x002d, 0x006c, 0x0075, 0x006c, 0x0065, 0x0074, 0x007a, 0x0065, 0x0062,
+    0x0075, 0x0065, 0x0072, 0x0067, 0x0065, 0x0073, 0x0063, 0x0068, 0x0020,
+    0x0028, 0x006c, 0x0065, 0x0074, 0x007a, 0x0065, 0x0062, 0x0075, 0x0065,
+    0x0072, 0x0067, 0x0029, 0x006c, 0x006f, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x006c, 0x0061, 0x0ea5, 0x0eb2, 0x0ea7, 0x0020, 0x0028,
+    0x0ea5, 0x0eb2, 0x0ea7, 0x0029, 0x006c, 0x0074, 0x002d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x002d, 0x006c, 0x0074, 0x006c, 0x0069, 0x0065, 0x0074,
+    0x0075, 0x0076, 0x0069, 0x0075, 0x0020, 0x0028, 0x006c, 0x0069, 0x0065,
+    0x0074, 0x0075, 0x0076, 0x0061, 0x0029, 0x006c, 0x0076, 0x002d, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x002d, 0x006c, 0x0076, 0x006c, 0x0061, 0x0074,
+    0x0076, 0x0069, 0x0065, 0x0073, 0x0075, 0x0020, 0x0028, 0x006c, 0x0061,
+    0x0074, 0x0076, 0x0069, 0x006a, 0x0061, 0x0029, 0x006d, 0x0069, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x006e, 0x007a, 0x006d, 0x0061,
+    0x006f, 0x0072, 0x0069, 0x0020, 0x0028, 0x0061, 0x006f, 0x0074, 0x0065,
+    0x0061, 0x0072, 0x006f, 0x0061, 0x0029, 0x006d, 0x006b, 0x002d, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x002d, 0x006d, 0x006b, 0x043c, 0x0430, 0x043a,
+    0x0435, 0x0434, 0x043e, 0x043d, 0x0441, 0x043a, 0x0438, 0x0020, 0x0028,
+    0x0441, 0x0435, 0x0432, 0x0435, 0x0440, 0x043d, 0x0430, 0x0020, 0x043c,
+    0x0430, 0x043a, 0x0435, 0x0434, 0x043e, 0x043d, 0x0438, 0x0458, 0x0430,
+    0x0029, 0x006d, 0x006c, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x0069, 0x006e, 0x0d2e, 0x0d32, 0x0d2f, 0x0d3e, 0x0d33, 0x0d02, 0x0020,
+    0x0028, 0x0d07, 0x0d28, 0x0d4d, 0x0d24, 0x0d4d, 0x0d2f, 0x0029, 0x006d,
+    0x006e, 0x002d, 0x006d, 0x006f, 0x006e, 0x0067, 0x002d, 0x0063, 0x006e,
+    0x043c, 0x043e, 0x043d, 0x0433, 0x043e, 0x043b, 0x0020, 0x0028, 0x043c,
+    0x043e, 0x043d, 0x0433, 0x043e, 0x043b, 0x0020, 0x0431, 0x0438, 0x0447,
+    0x0438, 0x0433, 0x002c, 0x0020, 0x0445, 0x044f, 0x0442, 0x0430, 0x0434,
+    0x0029, 0x006d, 0x006e, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x006d, 0x006e, 0x043c, 0x043e, 0x043d, 0x0433, 0x043e, 0x043b, 0x0020,
+    0x0028, 0x043c, 0x043e, 0x043d, 0x0433, 0x043e, 0x043b, 0x0029, 0x006d,
+    0x0072, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0069, 0x006e,
+    0x092e, 0x0930, 0x093e, 0x0920, 0x0940, 0x0020, 0x0028, 0x092d, 0x093e,
+    0x0930, 0x0924, 0x0029, 0x006d, 0x0073, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x0062, 0x006e, 0x006d, 0x0065, 0x006c, 0x0061, 0x0079,
+    0x0075, 0x0020, 0x0028, 0x0062, 0x0072, 0x0075, 0x006e, 0x0065, 0x0069,
+    0x0029, 0x006d, 0x0073, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x006d, 0x0079, 0x006d, 0x0065, 0x006c, 0x0061, 0x0079, 0x0075, 0x0020,
+    0x0028, 0x006d, 0x0061, 0x006c, 0x0061, 0x0079, 0x0073, 0x0069, 0x0061,
+    0x0029, 0x006d, 0x0074, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x006d, 0x0074, 0x006d, 0x0061, 0x006c, 0x0074, 0x0069, 0x0020, 0x0028,
+    0x006d, 0x0061, 0x006c, 0x0074, 0x0061, 0x0029, 0x006e, 0x0062, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x006e, 0x006f, 0x006e, 0x006f,
+    0x0072, 0x0073, 0x006b, 0x0020, 0x0062, 0x006f, 0x006b, 0x006d, 0x0061,
+    0x006c, 0x0020, 0x0028, 0x006e, 0x006f, 0x0072, 0x0067, 0x0065, 0x0029,
+    0x006e, 0x0065, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x006e,
+    0x0070, 0x0928, 0x0947, 0x092a, 0x093e, 0x0932, 0x0940, 0x0020, 0x0028,
+    0x0928, 0x0947, 0x092a, 0x093e, 0x0932, 0x0029, 0x006e, 0x006c, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0062, 0x0065, 0x006e, 0x0065,
+    0x0064, 0x0065, 0x0072, 0x006c, 0x0061, 0x006e, 0x0064, 0x0073, 0x0020,
+    0x0028, 0x0062, 0x0065, 0x006c, 0x0067, 0x0069, 0x0065, 0x0029, 0x006e,
+    0x006c, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x006e, 0x006c,
+    0x006e, 0x0065, 0x0064, 0x0065, 0x0072, 0x006c, 0x0061, 0x006e, 0x0064,
+    0x0073, 0x0020, 0x0028, 0x006e, 0x0065, 0x0064, 0x0065, 0x0072, 0x006c,
+    0x0061, 0x006e, 0x0064, 0x0029, 0x006e, 0x006e, 0x002d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x002d, 0x006e, 0x006f, 0x006e, 0x006f, 0x0072, 0x0073,
+    0x006b, 0x0020, 0x006e, 0x0079, 0x006e, 0x006f, 0x0072, 0x0073, 0x006b,
+    0x0020, 0x0028, 0x006e, 0x006f, 0x0072, 0x0065, 0x0067, 0x0029, 0x006e,
+    0x006f, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x006e, 0x006f,
+    0x006e, 0x006f, 0x0072, 0x0073, 0x006b, 0x0020, 0x0028, 0x006e, 0x006f,
+    0x0072, 0x0067, 0x0065, 0x0029, 0x006f, 0x0072, 0x002d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x002d, 0x0069, 0x006e, 0x0b13, 0x0b21, 0x0b3c, 0x0b3f,
+    0x0b06, 0x0020, 0x0028, 0x0b2d, 0x0b3e, 0x0b30, 0x0b24, 0x0029, 0x0070,
+    0x0061, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0069, 0x006e,
+    0x0a2a, 0x0a70, 0x0a1c, 0x0a3e, 0x0a2c, 0x0a40, 0x0020, 0x0028, 0x0a2d,
+    0x0a3e, 0x0a30, 0x0a24, 0x0029, 0x0070, 0x006c, 0x002d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x002d, 0x0070, 0x006c, 0x0070, 0x006f, 0x006c, 0x0073,
+    0x006b, 0x0069, 0x0020, 0x0028, 0x0070, 0x006f, 0x006c, 0x0073, 0x006b,
+    0x0061, 0x0029, 0x0070, 0x0073, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x002d, 0x0061, 0x0066, 0x067e, 0x069a, 0x062a, 0x0648, 0x0020, 0x0028,
+    0x0627, 0x0641, 0x063a, 0x0627, 0x0646, 0x0633, 0x062a, 0x0627, 0x0646,
+    0x0029, 0x0070, 0x0074, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x0062, 0x0072, 0x0070, 0x006f, 0x0072, 0x0074, 0x0075, 0x0067, 0x0075,
+    0x0065, 0x0073, 0x0020, 0x0028, 0x0062, 0x0072, 0x0061, 0x0073, 0x0069,
+    0x006c, 0x0029, 0x0070, 0x0074, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x002d, 0x0070, 0x0074, 0x0070, 0x006f, 0x0072, 0x0074, 0x0075, 0x0067,
+    0x0075, 0x0065, 0x0073, 0x0020, 0x0028, 0x0070, 0x006f, 0x0072, 0x0074,
+    0x0075, 0x0067, 0x0061, 0x006c, 0x0029, 0x0071, 0x0075, 0x002d, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x002d, 0x0062, 0x006f, 0x0072, 0x0075, 0x006e,
+    0x0061, 0x0073, 0x0069, 0x006d, 0x0069, 0x0020, 0x0028, 0x0062, 0x006f,
+    0x006c, 0x0069, 0x0076, 0x0069, 0x0061, 0x0029, 0x0071, 0x0075, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0065, 0x0063, 0x0072, 0x0075,
+    0x006e, 0x0061, 0x0073, 0x0069, 0x006d, 0x0069, 0x0020, 0x0028, 0x0065,
+    0x0063, 0x0075, 0x0061, 0x0064, 0x006f, 0x0072, 0x0029, 0x0071, 0x0075,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0070, 0x0065, 0x0072,
+    0x0075, 0x006e, 0x0061, 0x0073, 0x0069, 0x006d, 0x0069, 0x0020, 0x0028,
+    0x0070, 0x0065, 0x0072, 0x0075, 0x0029, 0x0072, 0x006d, 0x002d, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x002d, 0x0063, 0x0068, 0x0072, 0x0075, 0x006d,
+    0x0061, 0x006e, 0x0074, 0x0073, 0x0063, 0x0068, 0x0020, 0x0028, 0x0073,
+    0x0076, 0x0069, 0x007a, 0x0072, 0x0061, 0x0029, 0x0072, 0x006f, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0072, 0x006f, 0x0072, 0x006f,
+    0x006d, 0x0061, 0x006e, 0x0061, 0x0020, 0x0028, 0x0072, 0x006f, 0x006d,
+    0x0061, 0x006e, 0x0069, 0x0061, 0x0029, 0x0072, 0x0075, 0x002d, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x002d, 0x0072, 0x0075, 0x0440, 0x0443, 0x0441,
+    0x0441, 0x043a, 0x0438, 0x0438, 0x0020, 0x0028, 0x0440, 0x043e, 0x0441,
+    0x0441, 0x0438, 0x044f, 0x0029, 0x0072, 0x0077, 0x002d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x002d, 0x0072, 0x0077, 0x0069, 0x006b, 0x0069, 0x006e,
+    0x0079, 0x0061, 0x0072, 0x0077, 0x0061, 0x006e, 0x0064, 0x0061, 0x0020,
+    0x0028, 0x0075, 0x0020, 0x0072, 0x0077, 0x0061, 0x006e, 0x0064, 0x0061,
+    0x0029, 0x0073, 0x0061, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x0069, 0x006e, 0x0938, 0x0902, 0x0938, 0x094d, 0x0915, 0x0943, 0x0924,
+    0x0020, 0x092d, 0x093e, 0x0937, 0x093e, 0x0020, 0x0028, 0x092d, 0x093e,
+    0x0930, 0x0924, 0x0903, 0x0029, 0x0073, 0x0061, 0x0068, 0x002d, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x002d, 0x0072, 0x0075, 0x0441, 0x0430, 0x0445,
+    0x0430, 0x0020, 0x0442, 0x044b, 0x043b, 0x0430, 0x0020, 0x0028, 0x0430,
+    0x0440, 0x0430, 0x0441, 0x0441, 0x044b, 0x044b, 0x0438, 0x0430, 0x0029,
+    0x0073, 0x0065, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0066,
+    0x0069, 0x0064, 0x0061, 0x0076, 0x0076, 0x0069, 0x0073, 0x0061, 0x006d,
+    0x0065, 0x0067, 0x0069, 0x0065, 0x006c, 0x006c, 0x0061, 0x0020, 0x0028,
+    0x0073, 0x0075, 0x006f, 0x0070, 0x006d, 0x0061, 0x0029, 0x0073, 0x0065,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x006e, 0x006f, 0x0064,
+    0x0061, 0x0076, 0x0076, 0x0069, 0x0073, 0x0061, 0x006d, 0x0065, 0x0067,
+    0x0069, 0x0065, 0x006c, 0x006c, 0x0061, 0x0020, 0x0028, 0x006e, 0x006f,
+    0x0072, 0x0067, 0x0061, 0x0029, 0x0073, 0x0065, 0x002d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x002d, 0x0073, 0x0065, 0x0064, 0x0061, 0x0076, 0x0076,
+    0x0069, 0x0073, 0x0061, 0x006d, 0x0065, 0x0067, 0x0069, 0x0065, 0x006c,
+    0x006c, 0x0061, 0x0020, 0x0028, 0x0072, 0x0075, 0x006f, 0x0167, 0x0167,
+    0x0061, 0x0029, 0x0073, 0x0069, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x002d, 0x006c, 0x006b, 0x0dc3, 0x0dd2, 0x0d82, 0x0dc4, 0x0dbd, 0x0020,
+    0x0028, 0x0dc1, 0x0dca, 0x200d, 0x0dbb, 0x0dd3, 0x0020, 0x0dbd, 0x0d82,
+    0x0d9a, 0x0dcf, 0x0dc0, 0x0029, 0x0073, 0x006b, 0x002d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x002d, 0x0073, 0x006b, 0x0073, 0x006c, 0x006f, 0x0076,
+    0x0065, 0x006e, 0x0063, 0x0069, 0x006e, 0x0061, 0x0020, 0x0028, 0x0073,
+    0x006c, 0x006f, 0x0076, 0x0065, 0x006e, 0x0073, 0x006b, 0x006f, 0x0029,
+    0x0073, 0x006c, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0073,
+    0x0069, 0x0073, 0x006c, 0x006f, 0x0076, 0x0065, 0x006e, 0x0073, 0x0063,
+    0x0069, 0x006e, 0x0061, 0x0020, 0x0028, 0x0073, 0x006c, 0x006f, 0x0076,
+    0x0065, 0x006e, 0x0069, 0x006a, 0x0061, 0x0029, 0x0073, 0x006d, 0x006e,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0066, 0x0069, 0x0061,
+    0x006e, 0x0061, 0x0072, 0x0061, 0x0073, 0x006b, 0x0069, 0x0065, 0x006c,
+    0x0061, 0x0020, 0x0028, 0x0073, 0x0075, 0x006f, 0x006d, 0x0061, 0x0029,
+    0x0073, 0x0071, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0061,
+    0x006c, 0x0073, 0x0068, 0x0071, 0x0069, 0x0070, 0x0020, 0x0028, 0x0073,
+    0x0068, 0x0071, 0x0069, 0x0070, 0x0065, 0x0072, 0x0069, 0x0029, 0x0073,
+    0x0072, 0x002d, 0x0063, 0x0079, 0x0072, 0x006c, 0x002d, 0x0062, 0x0061,
+    0x0441, 0x0440, 0x043f, 0x0441, 0x043a, 0x0438, 0x0020, 0x0028, 0x045b,
+    0x0438, 0x0440, 0x0438, 0x043b, 0x0438, 0x0446, 0x0430, 0x002c, 0x0020,
+    0x0431, 0x043e, 0x0441, 0x043d, 0x0430, 0x0020, 0x0438, 0x0020, 0x0445,
+    0x0435, 0x0440, 0x0446, 0x0435, 0x0433, 0x043e, 0x0432, 0x0438, 0x043d,
+    0x0430, 0x0029, 0x0073, 0x0072, 0x002d, 0x006c, 0x0061, 0x0074, 0x006e,
+    0x002d, 0x0062, 0x0061, 0x0073, 0x0072, 0x0070, 0x0073, 0x006b, 0x0069,
+    0x0020, 0x0028, 0x006c, 0x0061, 0x0074, 0x0069, 0x006e, 0x0069, 0x0063,
+    0x0061, 0x002c, 0x0020, 0x0062, 0x006f, 0x0073, 0x006e, 0x0061, 0x0020,
+    0x0069, 0x0020, 0x0068, 0x0065, 0x0072, 0x0063, 0x0065, 0x0067, 0x006f,
+    0x0076, 0x0069, 0x006e, 0x0061, 0x0029, 0x0073, 0x0072, 0x002d, 0x0063,
+    0x0079, 0x0072, 0x006c, 0x002d, 0x006d, 0x0065, 0x0441, 0x0440, 0x043f,
+    0x0441, 0x043a, 0x0438, 0x0020, 0x0028, 0x045b, 0x0438, 0x0440, 0x0438,
+    0x043b, 0x0438, 0x0446, 0x0430, 0x002c, 0x0020, 0x0446, 0x0440, 0x043d,
+    0x0430, 0x0020, 0x0433, 0x043e, 0x0440, 0x0430, 0x0029, 0x0073, 0x0072,
+    0x002d, 0x006c, 0x0061, 0x0074, 0x006e, 0x002d, 0x006d, 0x0065, 0x0073,
+    0x0072, 0x0070, 0x0073, 0x006b, 0x0069, 0x0020, 0x0028, 0x006c, 0x0061,
+    0x0074, 0x0069, 0x006e, 0x0069, 0x0063, 0x0061, 0x002c, 0x0020, 0x0063,
+    0x0072, 0x006e, 0x0061, 0x0020, 0x0067, 0x006f, 0x0072, 0x0061, 0x0029,
+    0x0073, 0x0072, 0x002d, 0x0063, 0x0079, 0x0072, 0x006c, 0x002d, 0x0072,
+    0x0073, 0x0441, 0x0440, 0x043f, 0x0441, 0x043a, 0x0438, 0x0020, 0x0028,
+    0x045b, 0x0438, 0x0440, 0x0438, 0x043b, 0x0438, 0x0446, 0x0430, 0x002c,
+    0x0020, 0x0441, 0x0440, 0x0431, 0x0438, 0x0458, 0x0430, 0x0029, 0x0073,
+    0x0072, 0x002d, 0x006c, 0x0061, 0x0074, 0x006e, 0x002d, 0x0072, 0x0073,
+    0x0073, 0x0072, 0x0070, 0x0073, 0x006b, 0x0069, 0x0020, 0x0028, 0x006c,
+    0x0061, 0x0074, 0x0069, 0x006e, 0x0069, 0x0063, 0x0061, 0x002c, 0x0020,
+    0x0073, 0x0072, 0x0062, 0x0069, 0x006a, 0x0061, 0x0029, 0x0073, 0x0076,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0066, 0x0069, 0x0073,
+    0x0076, 0x0065, 0x006e, 0x0073, 0x006b, 0x0061, 0x0020, 0x0028, 0x0066,
+    0x0069, 0x006e, 0x006c, 0x0061, 0x006e, 0x0064, 0x0029, 0x0073, 0x0076,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0073, 0x0065, 0x0073,
+    0x0076, 0x0065, 0x006e, 0x0073, 0x006b, 0x0061, 0x0020, 0x0028, 0x0073,
+    0x0076, 0x0065, 0x0072, 0x0069, 0x0067, 0x0065, 0x0029, 0x0073, 0x0077,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x006b, 0x0065, 0x006b,
+    0x0069, 0x0073, 0x0077, 0x0061, 0x0068, 0x0069, 0x006c, 0x0069, 0x0020,
+    0x0028, 0x006b, 0x0065, 0x006e, 0x0079, 0x0061, 0x0029, 0x0074, 0x0061,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0069, 0x006e, 0x0ba4,
+    0x0bae, 0x0bbf, 0x0bb4, 0x0bcd, 0x0020, 0x0028, 0x0b87, 0x0ba8, 0x0bcd,
+    0x0ba4, 0x0bbf, 0x0baf, 0x0bbe, 0x0029, 0x0074, 0x0065, 0x002d, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x002d, 0x0069, 0x006e, 0x0c24, 0x0c46, 0x0c32,
+    0x0c41, 0x0c17, 0x0c41, 0x0020, 0x0028, 0x0c2d, 0x0c3e, 0x0c30, 0x0c24,
+    0x0c26, 0x0c47, 0x0c36, 0x0c02, 0x0029, 0x0074, 0x0067, 0x002d, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x002d, 0x0074, 0x006a, 0x0442, 0x043e, 0x04b7,
+    0x0438, 0x043a, 0x0438, 0x0020, 0x0028, 0x0442, 0x043e, 0x04b7, 0x0438,
+    0x043a, 0x0438, 0x0441, 0x0442, 0x043e, 0x043d, 0x0029, 0x0074, 0x0068,
+    0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0074, 0x0068, 0x0e44,
+    0x0e17, 0x0e22, 0x0020, 0x0028, 0x0e44, 0x0e17, 0x0e22, 0x0029, 0x0074,
+    0x006b, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0074, 0x006d,
+    0x0074, 0x0075, 0x0072, 0x006b, 0x006d, 0x0065, 0x006e, 0x0063, 0x0065,
+    0x0020, 0x0028, 0x0074, 0x0075, 0x0072, 0x006b, 0x006d, 0x0065, 0x006e,
+    0x0069, 0x0073, 0x0074, 0x0061, 0x006e, 0x0029, 0x0074, 0x0072, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0074, 0x0072, 0x0074, 0x0075,
+    0x0072, 0x006b, 0x0063, 0x0065, 0x0020, 0x0028, 0x0074, 0x0075, 0x0072,
+    0x006b, 0x0069, 0x0079, 0x0065, 0x0029, 0x0074, 0x0074, 0x002d, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x002d, 0x0072, 0x0075, 0x0442, 0x0430, 0x0442,
+    0x0430, 0x0440, 0x0020, 0x0028, 0x0440, 0x043e, 0x0441, 0x0441, 0x0438,
+    0x044f, 0x0029, 0x0074, 0x007a, 0x006d, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x0064, 0x007a, 0x0074, 0x0061, 0x006d, 0x0061, 0x007a,
+    0x0069, 0x0263, 0x0074, 0x0020, 0x006e, 0x0020, 0x006c, 0x0061, 0x0074,
+    0x006c, 0x0061, 0x0073, 0x0020, 0x0028, 0x0064, 0x007a, 0x0061, 0x0079,
+    0x0065, 0x0072, 0x0029, 0x0075, 0x0067, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x0063, 0x006e, 0x064a, 0x0654, 0x06c7, 0x064a, 0x063a,
+    0x06c7, 0x0631, 0x0686, 0x06d5, 0x0020, 0x0028, 0x062c, 0x06c7, 0x06ad,
+    0x06af, 0x0648, 0x0029, 0x0075, 0x006b, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x0075, 0x0061, 0x0443, 0x043a, 0x0440, 0x0430, 0x0456,
+    0x043d, 0x0441, 0x044c, 0x043a, 0x0430, 0x0020, 0x0028, 0x0443, 0x043a,
+    0x0440, 0x0430, 0x0456, 0x043d, 0x0430, 0x0029, 0x0075, 0x0072, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0070, 0x006b, 0x0627, 0x0631,
+    0x062f, 0x0648, 0x0020, 0x0028, 0x067e, 0x0627, 0x06a9, 0x0633, 0x062a,
+    0x0627, 0x0646, 0x0029, 0x0075, 0x007a, 0x002d, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x002d, 0x0075, 0x007a, 0x006f, 0x02bb, 0x007a, 0x0062, 0x0065,
+    0x006b, 0x0063, 0x0068, 0x0061, 0x0020, 0x0028, 0x006f, 0x02bb, 0x007a,
+    0x0062, 0x0065, 0x006b, 0x0069, 0x0073, 0x0074, 0x006f, 0x006e, 0x0029,
+    0x0075, 0x007a, 0x002d, 0x0063, 0x0079, 0x0072, 0x006c, 0x002d, 0x0075,
+    0x007a, 0x0443, 0x0437, 0x0431, 0x0435, 0x043a, 0x0447, 0x0430, 0x0020,
+    0x0028, 0x043a, 0x0438, 0x0440, 0x0438, 0x043b, 0x002c, 0x0020, 0x0443,
+    0x0437, 0x0431, 0x0435, 0x043a, 0x0438, 0x0441, 0x0442, 0x043e, 0x043d,
+    0x0029, 0x0076, 0x0069, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x0076, 0x006e, 0x0074, 0x0069, 0x0065, 0x006e, 0x0067, 0x0020, 0x0076,
+    0x0069, 0x0065, 0x0074, 0x0020, 0x0028, 0x0076, 0x0069, 0x0065, 0x0074,
+    0x0020, 0x006e, 0x0061, 0x006d, 0x0029, 0x0077, 0x006f, 0x002d, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x002d, 0x0073, 0x006e, 0x0077, 0x006f, 0x006c,
+    0x006f, 0x0066, 0x0020, 0x0028, 0x0073, 0x0065, 0x006e, 0x0065, 0x0067,
+    0x0061, 0x0061, 0x006c, 0x0029, 0x0078, 0x0068, 0x002d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x002d, 0x007a, 0x0061, 0x0069, 0x0073, 0x0069, 0x0078,
+    0x0068, 0x006f, 0x0073, 0x0061, 0x0020, 0x0028, 0x0075, 0x006d, 0x007a,
+    0x0061, 0x006e, 0x0074, 0x0073, 0x0069, 0x0020, 0x0061, 0x0066, 0x0072,
+    0x0069, 0x006b, 0x0061, 0x0029, 0x0079, 0x006f, 0x002d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x002d, 0x006e, 0x0067, 0x0065, 0x0064, 0x0065, 0x0020,
+    0x0079, 0x006f, 0x0072, 0x0075, 0x0062, 0x0061, 0x0020, 0x0028, 0x006e,
+    0x0061, 0x0069, 0x006a, 0x0069, 0x0072, 0x0069, 0x0061, 0x0029, 0x007a,
+    0x0068, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0063, 0x006e,
+    0x4e2d, 0x6587, 0xff08, 0x4e2d, 0x56fd, 0xff09, 0x007a, 0x0068, 0x002d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x0068, 0x006b, 0x4e2d, 0x6587,
+    0xff08, 0x9999, 0x6e2f, 0xff09, 0x007a, 0x0068, 0x002d, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x002d, 0x006d, 0x006f, 0x4e2d, 0x6587, 0xff08, 0x6fb3,
+    0x9580, 0xff09, 0x007a, 0x0068, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x002d, 0x0073, 0x0067, 0x4e2d, 0x6587, 0xff08, 0x65b0, 0x52a0, 0x5761,
+    0xff09, 0x007a, 0x0068, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d,
+    0x0074, 0x0077, 0x4e2d, 0x6587, 0xff08, 0x53f0, 0x7063, 0xff09, 0x007a,
+    0x0075, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x002d, 0x007a, 0x0061,
+    0x0069, 0x0073, 0x0069, 0x007a, 0x0075, 0x006c, 0x0075, 0x0020, 0x0028,
+    0x0069, 0x006e, 0x0069, 0x006e, 0x0067, 0x0069, 0x007a, 0x0069, 0x006d,
+    0x0075, 0x0020, 0x0061, 0x0066, 0x0072, 0x0069, 0x006b, 0x0061, 0x0029,
+};
+
+static const edist_table_locale_t kEdistTable[EDIST_TABLE_LOCALES] = {
+    {0, 10, 3, 10, 23, 0x80000}, /* af-ZA */
+    {33, 10, 3, 43, 12, 0x80}, /* am-ET */
+    {55, 10, 3, 65, 35, 0x1}, /* ar-AE */
+    {100, 10, 3, 110, 17, 0x1}, /* ar-BH */
+    {127, 10, 3, 137, 18, 0x1}, /* ar-DZ */
+    {155, 10, 3, 165, 13, 0x1}, /* ar-EG */
+    {178, 10, 3, 188, 16, 0x1}, /* ar-IQ */
+    {204, 10, 3, 214, 17, 0x1}, /* ar-JO */
+    {231, 10, 3, 241, 16, 0x1}, /* ar-KW */
+    {257, 10, 3, 267, 15, 0x1}, /* ar-LB */
+    {282, 10, 3, 292, 15, 0x1}, /* ar-LY */
+    {307, 10, 3, 317, 16, 0x1}, /* ar-MA */
+    {333, 10, 3, 343, 15, 0x1}, /* ar-OM */
+    {358, 10, 3, 368, 13, 0x1}, /* ar-QA */
+    {381, 10, 3, 391, 34, 0x1}, /* ar-SA */
+    {425, 10, 3, 435, 17, 0x1}, /* ar-SD */
+    {452, 10, 3, 462, 15, 0x1}, /* ar-SY */
+    {477, 10, 3, 487, 14, 0x1}, /* ar-TN */
+    {501, 10, 3, 511, 15, 0x1}, /* ar-YE */
+    {526, 10, 3, 536, 14, 0x4}, /* as-IN */
+    {550, 10, 3, 560, 25, 0x80000}, /* az-AZ */
+    {585, 10, 0, 595, 32, 0x20}, /* az-Cyrl-AZ */
+    {627, 10, 3, 637, 21, 0x20}, /* be-BY */
+    {658, 10, 3, 668, 20, 0x20}, /* bg-BG */
+    {688, 10, 3, 698, 16, 0x4}, /* bn-BD */
+    {714, 10, 3, 724, 12, 0x4}, /* bn-IN */
+    {736, 10, 3, 746, 17, 0x80000000}, /* bo-CN */
+    {763, 10, 3, 773, 17, 0x180000}, /* br-FR */
+    {790, 10, 3, 800, 30, 0x80000}, /* bs-BA */
+    {830, 10, 0, 840, 40, 0x20}, /* bs-Cyrl-BA */
+    {880, 10, 3, 890, 16, 0x180000}, /* ca-ES */
+    {906, 10, 3, 916, 15, 0x280000}, /* cs-CZ */
+    {931, 10, 3, 941, 26, 0x80000}, /* cy-GB */
+    {967, 10, 3, 977, 15, 0x80000}, /* da-DK */
+    {992, 10, 3, 1002, 20, 0x180000}, /* de-AT */
+    {1022, 10, 3, 1032, 17, 0x80000}, /* de-CH */
+    {1049, 10, 3, 1059, 21, 0x80000}, /* de-DE */
+    {1080, 10, 3, 1090, 23, 0x80000}, /* de-LI */
+    {1113, 10, 3, 1123, 19, 0x80000}, /* de-LU */
+    {1142, 11, 4, 1153, 23, 0x280000}, /* dsb-DE */
+    {1176, 10, 3, 1186, 17, 0x200}, /* el-CY */
+    {1203, 10, 3, 1213, 17, 0x200}, /* el-GR */
+    {1230, 11, 3, 1241, 19, 0x80000}, /* en-029 */
+    {1260, 10, 3, 1270, 19, 0x80000}, /* en-AU */
+    {1289, 10, 3, 1299, 16, 0x80000}, /* en-BZ */
+    {1315, 10, 3, 1325, 16, 0x80000}, /* en-CA */
+    {1341, 10, 3, 1351, 24, 0x80000}, /* en-GB */
+    {1375, 10, 3, 1385, 17, 0x80000}, /* en-IE */
+    {1402, 10, 3, 1412, 15, 0x80000}, /* en-IN */
+    {1427, 10, 3, 1437, 17, 0x80000}, /* en-JM */
+    {1454, 10, 3, 1464, 15, 0x80000}, /* en-MT */
+    {1479, 10, 3, 1489, 18, 0x80000}, /* en-MY */
+    {1507, 10, 3, 1517, 21, 0x80000}, /* en-NZ */
+    {1538, 10, 3, 1548, 21, 0x80000}, /* en-PH */
+    {1569, 10, 3, 1579, 19, 0x80000}, /* en-SG */
+    {1598, 10, 3, 1608, 27, 0x80000}, /* en-TT */
+    {1635, 10, 3, 1645, 23, 0x80000}, /* en-US */
+    {1668, 10, 3, 1678, 22, 0x80000}, /* en-ZA */
+    {1700, 10, 3, 1710, 18, 0x80000}, /* en-ZW */
+    {1728, 10, 3, 1738, 19, 0x180000}, /* es-AR */
+    {1757, 10, 3, 1767, 17, 0x180000}, /* es-BO */
+    {1784, 10, 3, 1794, 15, 0x180000}, /* es-CL */
+    {1809, 10, 3, 1819, 18, 0x180000}, /* es-CO */
+    {1837, 10, 3, 1847, 20, 0x180000}, /* es-CR */
+    {1867, 10, 3, 1877, 30, 0x180000}, /* es-DO */
+    {1907, 10, 3, 1917, 17, 0x180000}, /* es-EC */
+    {1934, 10, 3, 1944, 16, 0x180000}, /* es-ES */
+    {1960, 10, 3, 1970, 19, 0x180000}, /* es-GT */
+    {1989, 10, 3, 1999, 18, 0x180000}, /* es-HN */
+    {2017, 10, 3, 2027, 16, 0x180000}, /* es-MX */
+    {2043, 10, 3, 2053, 19, 0x180000}, /* es-NI */
+    {2072, 10, 3, 2082, 16, 0x180000}, /* es-PA */
+    {2098, 10, 3, 2108, 14, 0x180000}, /* es-PE */
+    {2122, 10, 3, 2132, 21, 0x180000}, /* es-PR */
+    {2153, 10, 3, 2163, 18, 0x180000}, /* es-PY */
+    {2181, 10, 3, 2191, 21, 0x180000}, /* es-SV */
+    {2212, 10, 3, 2222, 24, 0x180000}, /* es-US */
+    {2246, 10, 3, 2256, 17, 0x180000}, /* es-UY */
+    {2273, 10, 3, 2283, 19, 0x180000}, /* es-VE */
+    {2302, 10, 3, 2312, 13, 0x80000}, /* et-EE */
+    {2325, 10, 3, 2335, 18, 0x80000}, /* eu-ES */
+    {2353, 10, 3, 2363, 17, 0x1}, /* fa-AF */
+    {2380, 10, 3, 2390, 13, 0x1}, /* fa-IR */
+    {2403, 10, 3, 2413, 13, 0x80000}, /* fi-FI */
+    {2426, 11, 4, 2437, 20, 0x80000}, /* fil-PH */
+    {2457, 10, 3, 2467, 18, 0x180000}, /* fo-FO */
+    {2485, 10, 3, 2495, 19, 0x180000}, /* fr-BE */
+    {2514, 10, 3, 2524, 17, 0x180000}, /* fr-CA */
+    {2541, 10, 3, 2551, 17, 0x180000}, /* fr-CH */
+    {2568, 10, 3, 2578, 17, 0x180000}, /* fr-FR */
+    {2595, 10, 3, 2605, 21, 0x180000}, /* fr-LU */
+    {2626, 10, 3, 2636, 17, 0x180000}, /* fr-MC */
+    {2653, 10, 3, 2663, 16, 0x180000}, /* fy-NL */
+    {2679, 10, 3, 2689, 14, 0x180000}, /* ga-IE */
+    {2703, 10, 3, 2713, 33, 0x180000}, /* gd-GB */
+    {2746, 10, 3, 2756, 17, 0x180000}, /* gd-IE */
+    {2773, 10, 3, 2783, 15, 0x180000}, /* gl-ES */
+    {2798, 11, 4, 2809, 29, 0x180000}, /* gsw-FR */
+    {2838, 10, 3, 2848, 14, 0x400}, /* gu-IN */
+    {2862, 10, 0, 2872, 23, 0x80000}, /* ha-Latn-NG */
+    {2895, 10, 3, 2905, 13, 0x2000}, /* he-IL */
+    {2918, 10, 3, 2928, 13, 0x40}, /* hi-IN */
+    {2941, 10, 3, 2951, 30, 0x80000}, /* hr-BA */
+    {2981, 10, 3, 2991, 19, 0x80000}, /* hr-HR */
+    {3010, 11, 4, 3021, 24, 0x280000}, /* hsb-DE */
+    {3045, 10, 3, 3055, 21, 0x180000}, /* hu-HU */
+    {3076, 10, 3, 3086, 18, 0x2}, /* hy-AM */
+    {3104, 10, 3, 3114, 21, 0x80000}, /* id-ID */
+    {3135, 10, 3, 3145, 15, 0x100080000}, /* ig-NG */
+    {3160, 10, 3, 3170, 8, 0x200000000}, /* ii-CN */
+    {3178, 10, 3, 3188, 17, 0x180000}, /* is-IS */
+    {3205, 10, 3, 3215, 19, 0x80000}, /* it-CH */
+    {3234, 10, 3, 3244, 17, 0x80000}, /* it-IT */
+    {3261, 10, 3, 3271, 8, 0x14010}, /* ja-JP */
+    {3279, 10, 3, 3289, 20, 0x100}, /* ka-GE */
+    {3309, 10, 3, 3319, 19, 0x20}, /* kk-KZ */
+    {3338, 10, 3, 3348, 30, 0x80000}, /* kl-GL */
+    {3378, 10, 3, 3388, 15, 0x20000}, /* km-KH */
+    {3403, 10, 3, 3413, 12, 0x8000}, /* kn-IN */
+    {3425, 10, 3, 3435, 22, 0x1000}, /* ko-KR */
+    {3457, 11, 4, 3468, 13, 0x40}, /* kok-IN */
+    {3481, 10, 3, 3491, 21, 0x20}, /* ky-KG */
+    {3512, 10, 3, 3522, 27, 0x180000}, /* lb-LU */
+    {3549, 10, 3, 3559, 9, 0x40000}, /* lo-LA */
+    {3568, 10, 3, 3578, 18, 0x280000}, /* lt-LT */
+    {3596, 10, 3, 3606, 18, 0x280000}, /* lv-LV */
+    {3624, 10, 3, 3634, 16, 0x280000}, /* mi-NZ */
+    {3650, 10, 3, 3660, 31, 0x20}, /* mk-MK */
+    {3691, 10, 3, 3701, 15, 0x800000}, /* ml-IN */
+    {3716, 10, 0, 3726, 28, 0x20}, /* mn-Mong-CN */
+    {3754, 10, 3, 3764, 15, 0x20}, /* mn-MN */
+    {3779, 10, 3, 3789, 12, 0x40}, /* mr-IN */
+    {3801, 10, 3, 3811, 15, 0x80000}, /* ms-BN */
+    {3826, 10, 3, 3836, 17, 0x80000}, /* ms-MY */
+    {3853, 10, 3, 3863, 13, 0x80000}, /* mt-MT */
+    {3876, 10, 3, 3886, 20, 0x180000}, /* nb-NO */
+    {3906, 10, 3, 3916, 14, 0x40}, /* ne-NP */
+    {3930, 10, 3, 3940, 19, 0x180000}, /* nl-BE */
+    {3959, 10, 3, 3969, 22, 0x80000}, /* nl-NL */
+    {3991, 10, 3, 4001, 21, 0x80000}, /* nn-NO */
+    {4022, 10, 3, 4032, 13, 0x80000}, /* no-NO */
+    {4045, 10, 3, 4055, 12, 0x4000000}, /* or-IN */
+    {4067, 10, 3, 4077, 13, 0x800}, /* pa-IN */
+    {4090, 10, 3, 4100, 15, 0x80000}, /* pl-PL */
+    {4115, 10, 3, 4125, 16, 0x1}, /* ps-AF */
+    {4141, 10, 3, 4151, 18, 0x180000}, /* pt-BR */
+    {4169, 10, 3, 4179, 20, 0x180000}, /* pt-PT */
+    {4199, 10, 3, 4209, 18, 0x80000}, /* qu-BO */
+    {4227, 10, 3, 4237, 18, 0x80000}, /* qu-EC */
+    {4255, 10, 3, 4265, 15, 0x180000}, /* qu-PE */
+    {4280, 10, 3, 4290, 18, 0x80000}, /* rm-CH */
+    {4308, 10, 3, 4318, 16, 0x380000}, /* ro-RO */
+    {4334, 10, 3, 4344, 16, 0x20}, /* ru-RU */
+    {4360, 10, 3, 4370, 23, 0x80000}, /* rw-RW */
+    {4393, 10, 3, 4403, 20, 0x40}, /* sa-IN */
+    {4423, 11, 4, 4434, 21, 0x20}, /* sah-RU */
+    {4455, 10, 3, 4465, 24, 0x180000}, /* se-FI */
+    {4489, 10, 3, 4499, 23, 0x180000}, /* se-NO */
+    {4522, 10, 3, 4532, 24, 0x380000}, /* se-SE */
+    {4556, 10, 3, 4566, 19, 0x8000000}, /* si-LK */
+    {4585, 10, 3, 4595, 22, 0x280000}, /* sk-SK */
+    {4617, 10, 3, 4627, 23, 0x280000}, /* sl-SI */
+    {4650, 11, 4, 4661, 19, 0x380000}, /* smn-FI */
+    {4680, 10, 3, 4690, 16, 0x180000}, /* sq-AL */
+    {4706, 10, 0, 4716, 38, 0x20}, /* sr-Cyrl-BA */
+    {4754, 10, 0, 4764, 38, 0x80000}, /* sr-Latn-BA */
+    {4802, 10, 0, 4812, 28, 0x20}, /* sr-Cyrl-ME */
+    {4840, 10, 0, 4850, 28, 0x80000}, /* sr-Latn-ME */
+    {4878, 10, 0, 4888, 25, 0x20}, /* sr-Cyrl-RS */
+    {4913, 10, 0, 4923, 25, 0x80000}, /* sr-Latn-RS */
+    {4948, 10, 3, 4958, 17, 0x80000}, /* sv-FI */
+    {4975, 10, 3, 4985, 17, 0x80000}, /* sv-SE */
+    {5002, 10, 3, 5012, 17, 0x80000}, /* sw-KE */
+    {5029, 10, 3, 5039, 15, 0x10000000}, /* ta-IN */
+    {5054, 10, 3, 5064, 17, 0x20000000}, /* te-IN */
+    {5081, 10, 3, 5091, 19, 0x20}, /* tg-TJ */
+    {5110, 10, 3, 5120, 9, 0x40000000}, /* th-TH */
+    {5129, 10, 3, 5139, 24, 0x180000}, /* tk-TM */
+    {5163, 10, 3, 5173, 16, 0x180000}, /* tr-TR */
+    {5189, 10, 3, 5199, 14, 0x20}, /* tt-RU */
+    {5213, 11, 4, 5224, 26, 0x80000}, /* tzm-DZ */
+    {5250, 10, 3, 5260, 17, 0x1}, /* ug-CN */
+    {5277, 10, 3, 5287, 20, 0x20}, /* uk-UA */
+    {5307, 10, 3, 5317, 14, 0x1}, /* ur-PK */
+    {5331, 10, 3, 5341, 23, 0x80000}, /* uz-UZ */
+    {5364, 10, 0, 5374, 27, 0x20}, /* uz-Cyrl-UZ */
+    {5401, 10, 3, 5411, 21, 0x100080000}, /* vi-VN */
+    {5432, 10, 3, 5442, 16, 0x80000}, /* wo-SN */
+    {5458, 10, 3, 5468, 26, 0x80000}, /* xh-ZA */
+    {5494, 10, 3, 5504, 21, 0x180000}, /* yo-NG */
+    {5525, 10, 3, 5535, 6, 0x10}, /* zh-CN */
+    {5541, 10, 3, 5551, 6, 0x10}, /* zh-HK */
+    {5557, 10, 3, 5567, 6, 0x10}, /* zh-MO */
+    {5573, 10, 3, 5583, 7, 0x10}, /* zh-SG */
+    {5590, 10, 3, 5600, 6, 0x10}, /* zh-TW */
+    {5606, 10, 3, 5616, 27, 0x80000}, /* zu-ZA */
+};
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+#include "timesignal.h"
+
+/*
+ * Capacity of the ring in render quantums, a power of 2. 65536 samples last
+ * 1.37 s at 48 kHz and 341 ms at 192 kHz.
+ */
+#define TSIG_RING_QUANTUMS 512
+#define TSIG_RING_LEN      (TSIG_RING_QUANTUMS * TSIG_RENDER_QUANTUM)
+
+/** Tag of a quantum after which no state transition was initiated. */
+#define TSIG_RING_NO_STATE -1
+
+/**
+ * Lock-free single-producer, single-consumer ring of render quantums.
+ *
+ * Indices count quantums ever written and read, wrapping only at 2^32, and
+ * each is stored by one side only. Quantums are output at a fixed pace, so
+ * the consumer reads one whenever it is due, rendered or not: if the ring
+ * is empty, it outputs silence and still advances, and the producer skips
+ * past the quantums it missed to keep every later sample on time.
+ *
+ * Zero-initialize before first use.
+ */
+typedef struct tsig_ring_t {
+  float buf[TSIG_RING_LEN];             /** Rendered samples. */
+  int8_t states[TSIG_RING_QUANTUMS];    /** State transition after each. */
+  atomic_uint head;                     /** Quantums written by producer. */
+  atomic_uint tail;                     /** Quantums read by consumer. */
+  atomic_uint underflows;               /** Quantums due but not rendered. */
+} tsig_ring_t;
+
+/**
+ * Find how many quantums are rendered but not yet read.
+ * @param ring Pointer to a ring.
+ * @return Count of quantums, 0 if the consumer has passed the producer.
+ */
+static inline uint32_t tsig_ring_fill(tsig_ring_t *ring) {
+  uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+  int32_t fill = atomic_load_explicit(&ring->head, memory_order_acquire) - tail;
+  return fill > 0 ? fill : 0;
+}
+
+/**
+ * Skip the producer past quantums the consumer has already passed.
+ * @param ring Pointer to a ring.
+ * @return Count of quantums skipped.
+ * @note Producer only.
+ */
+static inline uint32_t tsig_ring_catch_up(tsig_ring_t *ring) {
+  uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+  uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+  int32_t lag = tail - head;
+
+  if (lag <= 0)
+    return 0;
+
+  atomic_store_explicit(&ring->head, tail, memory_order_release);
+  return lag;
+}
+
+/**
+ * Get the next quantum to render into, if the ring is not filled to a lead.
+ * @param ring Pointer to a ring.
+ * @param lead Most quantums to render ahead, less than `TSIG_RING_QUANTUMS`.
+ * @return Pointer to `TSIG_RENDER_QUANTUM` samples, or NULL if there are
+ *  already `lead` quantums ahead of the consumer.
+ * @note Producer only. The quantum must be committed before the next call.
+ */
+static inline float *tsig_ring_acquire(tsig_ring_t *ring, uint32_t lead) {
+  uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+  uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+
+  if ((int32_t)(head - tail) >= (int32_t)lead)
+    return NULL;
+
+  return &ring->buf[(head % TSIG_RING_QUANTUMS) * TSIG_RENDER_QUANTUM];
+}
+
+/**
+ * Publish the quantum last acquired to the consumer.
+ * @param ring Pointer to a ring.
+ * @param state State transition initiated after the quantum, if any, else
+ *  `TSIG_RING_NO_STATE`.
+ * @note Producer only.
+ */
+static inline void tsig_ring_commit(tsig_ring_t *ring, int state) {
+  uint32_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+  ring->states[head % TSIG_RING_QUANTUMS] = state;
+  atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+}
+
+/**
+ * Drop every quantum rendered but not yet read.
+ * @param ring Pointer to a ring.
+ * @note Consumer only.
+ */
+static inline void tsig_ring_discard(tsig_ring_t *ring) {
+  uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+  uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+
+  if ((int32_t)(head - tail) > 0)
+    atomic_store_explicit(&ring->tail, head, memory_order_release);
+}
+
+/**
+ * Read the next quantum, or silence if it has not been rendered.
+ * @param ring Pointer to a ring.
+ * @param[out] out Buffer for `TSIG_RENDER_QUANTUM` samples.
+ * @param skip Count of quantums to skip first, e.g. dropped by the browser.
+ * @param count Whether a missing quantum counts as an underflow.
+ * @return Latest state transition initiated after the quantums skipped or
+ *  the quantum read, if any, else `TSIG_RING_NO_STATE`.
+ * @note Consumer only. Bounded: a copy or a fill of one quantum, and a look
+ *  at the tag of each quantum skipped that was rendered.
+ */
+static inline int tsig_ring_read(tsig_ring_t *ring, float *out, uint32_t skip,
+                                 uint8_t count) {
+  uint32_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+  uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+  int state = TSIG_RING_NO_STATE;
+
+  /* A transition after a quantum skipped still happened, e.g. to idle. */
+  for (; skip && (int32_t)(head - tail) > 0; skip--, tail++) {
+    int skipped = ring->states[tail % TSIG_RING_QUANTUMS];
+    if (skipped != TSIG_RING_NO_STATE)
+      state = skipped;
+  }
+
+  tail += skip;
+  if ((int32_t)(head - tail) > 0) {
+    uint32_t i = tail % TSIG_RING_QUANTUMS;
+    memcpy(out, &ring->buf[i * TSIG_RENDER_QUANTUM],
+           TSIG_RENDER_QUANTUM * sizeof(float));
+    if (ring->states[i] != TSIG_RING_NO_STATE)
+      state = ring->states[i];
+  } else {
+    memset(out, 0, TSIG_RENDER_QUANTUM * sizeof(float));
+    if (count)
+      atomic_fetch_add_explicit(&ring->underflows, 1, memory_order_relaxed);
+  }
+
+  atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+  return state;
+}
@@ -12,12 +12,12 @@
  *
  *  emcc timesignal.c -o timesignal.js -sEXPORT_NAME=createTimeSignalModule \
  *    -sMODULARIZE -sAUDIO_WORKLET -sWASM_WORKERS -sJS_MATH -sEXPORT_ES6 \
- *    -sALLOW_TABLE_GROWTH -sSTACK_SIZE=32768 -sINITIAL_MEMORY=65536 -sMALLOC=none \
+ *    -sALLOW_TABLE_GROWTH -sSTACK_SIZE=32768 -sINITIAL_MEMORY=524288 -sMALLOC=none \
  *    -sEXPORTED_RUNTIME_METHODS="addFunction,emscriptenGetAudioObject,emscriptenRegisterAudioObject,wasmTable"
  *
  * timesignal.js, timesignal.wasm, timesignal.aw.js, and timesignal.ww.js are
- * created. Only the first 3 are necessary; the .ww.js file can be deleted.
- * However, timesignal.js needs to be modified before it can be used.
+ * created. All 4 are necessary, the last for the Wasm Worker that renders
+ * ahead. However, timesignal.js needs to be modified before it can be used.
  *
  * Prior to v3.1.54 (cf. https://github.com/emscripten-core/emscripten/pull/21192),
  * emscripten generates broken JS glue code for a module using the Wasm Audio
@@ -49,6 +49,7 @@
  * will fail if timesignal.aw.js is not in the server root directory. That is
  * unlikely, so the URL string must either be modified to have the correct
  * prefix relative to the server root or be wrapped in a call to locateFile().
+ * The same goes for timesignal.ww.js.
  *
  * The final hurdle is that these changes must be made on minified JS if this
  * module was compiled with -O3.
@@ -85,28 +86,51 @@
  *    AudioContext.resume(). This returns a Promise that resolves when the
  *    AudioContext has been resumed, which is a good point at which to...
  *
- * 6. Call tsig_start(). The goal is to load user params into the module, but
- *    not just yet. Eventually, the second callback from 0) is called with the
- *    state `TSIG_STATE_REQ_PARAMS`, which is a good point at which to...
+ * 6. Call tsig_start(), asking the module to render in the Audio Worklet
+ *    thread or ahead in a Wasm Worker. The goal is to load user params into
+ *    the module, but not just yet. Eventually, the second callback from 0)
+ *    is called with the state `TSIG_STATE_REQ_PARAMS`, which is a good point
+ *    at which to...
  *
- * 6. Call tsig_load_params() to load user params. At last, the module
- *    begins generating and outputting a time station "radio signal".
+ * 7. Call tsig_set_latency() with the AudioContext's output latency, then
+ *    call tsig_load_params() to load user params. At last, the module
+ *    begins generating and outputting a time station "radio signal". Keep
+ *    calling tsig_set_latency() periodically, as output latency can change.
  *
- * 7. Shutting the module down is another roundabout process that begins with
+ * 8. Shutting the module down is another roundabout process that begins with
  *    a call to tsig_stop(). Eventually, the second callback from 0) is called
  *    with the module state `TSIG_STATE_REQ_IDLE`, which is a good point at
- *    which to call AudioContext.suspend().
+ *    which to call AudioContext.suspend(). While idle, the module does next
+ *    to nothing even if the AudioContext runs, so the AudioWorkletNode may
+ *    also be disconnected.
  *
- * 8. For subsequent startups, simply GOTO 5.
+ * 9. For subsequent startups, reconnect the AudioWorkletNode and GOTO 5.
+ *
+ * To start faster, ask tsig_start() to stand by once stopped. After it fades
+ * out, the module enters `TSIG_STATE_STANDBY` and keeps time silently, and a
+ * call to tsig_start() then fades in at once, even when rendering ahead. tsig_get_first_sample_ms()
+ * tells when the first sample since was heard.
+ *
+ * Alternatively, the module can leave rendering to Web Audio entirely. Call
+ * tsig_sched_load_params(), then tsig_sched_minute() and
+ * tsig_sched_next_minute() to compute each minute's edges, and read them back
+ * with tsig_sched_edge_ms() and tsig_sched_edge_gain() to be scheduled as
+ * automation on a GainNode keying an OscillatorNode. This is cheaper, but
+ * follows neither sample clock error nor output latency changes as closely,
+ * and cannot spread DCF77's carrier.
  */
 
 #include <stdio.h>
 #include <stdatomic.h>
 #include <stdint.h>
+#include <emscripten/atomic.h>
 #include <emscripten/emscripten.h>
+#include <emscripten/wasm_worker.h>
 #include <emscripten/webaudio.h>
 #include "timesignal.h"
+#include "clockrate.h"
 #include "datetime.h"
+#include "ring.h"
 #include "waveform.h"
 
 /** AudioWorkletProcessor thread state. */
@@ -120,13 +144,83 @@ typedef struct tsig_ctx_t {
   /** Waveform context. */
   tsig_waveform_ctx_t waveform_ctx;
 
+  /** Sample clock rate estimator context. */
+  tsig_clockrate_ctx_t clockrate_ctx;
+
+  /** Sample clock correction in use, in parts per billion. */
+  atomic_int ppb;
+
+  /** Output latency most recently measured by JS, in microseconds. */
+  atomic_int latency_us;
+
+  /** Output latency applied to waveform, in milliseconds. */
+  double latency_ms;
+
+  /**
+   * Whether a Wasm Worker renders ahead for the AWP to copy. Cleared once
+   * the AWP outputs the transition to `TSIG_STATE_IDLE`, which puts the
+   * worker to sleep until tsig_start().
+   */
+  atomic_int render_ahead;
+
+  /** How far ahead of output rendering began, in milliseconds. */
+  double ahead_ms;
+
+  /** AudioWorkletGlobalScope frame at which waveform sample count is 0. */
+  uint64_t base_frame;
+
+  /** Count of resynchronizations after dropped render quantums. */
+  atomic_int resyncs;
+
+  /** Subharmonic of target frequency generated, or 1 if generated directly. */
+  atomic_int subharmonic;
+
   /** Count of render quantums to delay when starting/stopping. */
   uint32_t delay_quantums;
+
+  /** Whether to idle on warm standby, not suspend, when not transmitting. */
+  atomic_int warm;
+
+  /** Whether tsig_start() was called since tsig_stop(). */
+  atomic_int on_air;
+
+  /** Whether the first nonzero sample since tsig_start() is yet to come. */
+  atomic_int marking;
+
+  /** Local timestamp at which that sample is heard. */
+  double first_sample_ms;
 } tsig_ctx_t;
 
+/** Render-ahead pipeline state, shared by its Wasm Worker and the AWP. */
+typedef struct tsig_pipeline_t {
+  /** Ring of quantums rendered by the worker for the AWP to copy. */
+  tsig_ring_t ring;
+
+  /** Quantums to render ahead of output. */
+  uint32_t lead;
+
+  /** Quantums to render ahead of output on warm standby. */
+  uint32_t standby_lead;
+
+  /** Wasm Worker that renders ahead, or 0 if not yet created. */
+  emscripten_wasm_worker_t worker;
+
+  /** Frame the worker is rendering, as the AWP will output it. */
+  uint64_t frame;
+
+  /** Frame the AWP expects to output next, or 0 if not yet known. */
+  uint64_t next_frame;
+
+  /** Whether the AWP should drop what was rendered before tsig_start(). */
+  atomic_int discard;
+} tsig_pipeline_t;
+
 /** Global stack for all threads in AudioWorkletGlobalScope.*/
 uint8_t tsig_awp_stack[TSIG_AWP_STACK_SIZE];
 
+/** Stack and TLS of the Wasm Worker that renders ahead. */
+_Alignas(16) uint8_t tsig_worker_stack[TSIG_WORKER_STACK_SIZE];
+
 /**
  * JavaScript callback that looks like a C function pointer.
  *
@@ -134,8 +228,26 @@ uint8_t tsig_awp_stack[TSIG_AWP_STACK_SIZE];
  */
 tsig_js_cb_func tsig_js_cb;
 
+/** Main thread state of the Web Audio automation engine. */
+typedef struct tsig_sched_ctx_t {
+  /** User parameters of the schedule. */
+  tsig_params_t params;
+
+  /** Synthesis chosen for the AudioContext's sample rate. */
+  tsig_waveform_synth_t synth;
+
+  /** Edges of the station minute most recently scheduled. */
+  tsig_waveform_frame_t frame;
+
+  /** Station timestamp of the start of that minute. */
+  double min_ms;
+} tsig_sched_ctx_t;
+
 tsig_params_t tsig_params = {};
+tsig_waveform_synth_t tsig_synth = {}; /** Chosen for `tsig_params`. */
 tsig_ctx_t tsig_ctx = {};
+tsig_sched_ctx_t tsig_sched_ctx = {};
+tsig_pipeline_t tsig_pipeline = {};
 
 static inline uint8_t rearm_state_transition_delay() {
   tsig_ctx.delay_quantums =
@@ -151,22 +263,85 @@ static inline uint8_t is_state_transition_delay_finished() {
 }
 
 /**
- * Process `TSIG_RENDER_QUANTUM` samples of audio.
- * @param n_inputs Count of audio input channels.
- * @param inputs Array of audio input buffers.
+ * Retune the waveform if a new sample clock error estimate differs enough.
+ * @param ppb Sample clock error estimate in parts per billion.
+ */
+static inline void update_ppb(int32_t ppb) {
+  int32_t delta = ppb - tsig_ctx.waveform_ctx.ppb;
+  if (delta < -TSIG_RETUNE_PPB || TSIG_RETUNE_PPB < delta) {
+    tsig_waveform_set_ppb(&tsig_ctx.waveform_ctx, &tsig_ctx.params, ppb);
+    atomic_store(&tsig_ctx.ppb, ppb);
+  }
+}
+
+/**
+ * Get the frame of the audio block being processed.
+ * @return AudioWorkletGlobalScope.currentFrame.
+ * @note Only meaningful in the Audio Worklet thread.
+ */
+EM_JS(double, tsig_current_frame, (), { return currentFrame; });
+
+/**
+ * Resynchronize the waveform if render quantums were dropped.
+ * @param frame Frame at which the quantum being rendered is output.
+ * @note The browser may skip calling process() under load, yet frames it
+ *  did not render still count towards currentFrame. Without resynchronizing,
+ *  every later tick would be late until the next restart. Likewise, the AWP
+ *  outputs silence for quantums it is due before the Wasm Worker renders
+ *  them.
+ */
+static inline void detect_gap(uint64_t frame) {
+  uint64_t expected = tsig_ctx.base_frame + tsig_ctx.waveform_ctx.samples;
+
+  if (frame > expected) {
+#ifdef TSIG_DEBUG
+    printf("Wasm resync after %llu dropped frames\n", frame - expected);
+#endif /* TSIG_DEBUG */
+
+    tsig_waveform_resync(&tsig_ctx.waveform_ctx, frame - tsig_ctx.base_frame);
+    atomic_fetch_add(&tsig_ctx.resyncs, 1);
+  }
+}
+
+/**
+ * Slew applied output latency towards that most recently measured by JS.
+ * @note Station timestamps move by at most 1 sample per render quantum, so
+ *  transmit level changes shift gradually instead of jumping.
+ */
+static inline void update_latency() {
+  double max_slew = 1000.0 / tsig_ctx.waveform_ctx.sample_rate;
+  double latency_ms = atomic_load(&tsig_ctx.latency_us) / 1000.0;
+  double slew = latency_ms + tsig_ctx.ahead_ms - tsig_ctx.latency_ms;
+
+  if (slew) {
+    slew = slew < -max_slew ? -max_slew : slew > max_slew ? max_slew : slew;
+    tsig_waveform_shift(&tsig_ctx.waveform_ctx, &tsig_ctx.params, slew);
+    tsig_ctx.latency_ms += slew;
+  }
+}
+
+/**
+ * Find how far rendering is ahead of output.
+ * @return Count of samples rendered but not yet output, 0 unless a Wasm
+ *  Worker renders ahead.
+ */
+static inline uint32_t ahead_samples() {
+  if (!atomic_load(&tsig_ctx.render_ahead))
+    return 0;
+  return tsig_ring_fill(&tsig_pipeline.ring) * TSIG_RENDER_QUANTUM;
+}
+
+/**
+ * Render `TSIG_RENDER_QUANTUM` samples of audio, advancing the module state.
  * @param n_outputs Count of audio output channels.
  * @param outputs Array of audio output buffers.
- * @param n_params Count of audio parameters. Unused.
- * @param params Array of audio parameters. Unused.
- * @param userdata Pointer to user data. Unused.
- * @return Always `EM_TRUE`.
- * @note Equivalent to AudioWorkletProcessor.process(). Runs in a real-time
- *  Audio Worklet thread within AudioWorkletGlobalScope.
+ * @param frame Frame at which the samples are output.
+ * @return State transition initiated, if any, else `TSIG_RING_NO_STATE`.
+ * @note Runs in the Audio Worklet thread, or in the Wasm Worker that renders
+ *  ahead, never both.
  */
-EM_BOOL tsig_awp_process_cb(int n_inputs, const AudioSampleFrame *inputs,
-                            int n_outputs, AudioSampleFrame *outputs,
-                            int n_params, const AudioParamFrame *params,
-                            void *userdata) {
+static int render_quantum(int n_outputs, AudioSampleFrame *outputs,
+                          uint64_t frame) {
   int state = atomic_load(&tsig_ctx.state);
   int next_state = state;
   uint8_t silent = 1;
@@ -193,25 +368,69 @@ EM_BOOL tsig_awp_process_cb(int n_inputs, const AudioSampleFrame *inputs,
     case TSIG_STATE_LOAD_PARAMS:
       tsig_ctx.params = tsig_params;
 
-      tsig_waveform_init(&tsig_ctx.waveform_ctx, &tsig_ctx.params);
+      /* Samples are output as much later as the ring is filled now. */
+      tsig_ctx.ahead_ms =
+          1000.0 * ahead_samples() / tsig_ctx.waveform_ctx.sample_rate;
+
+      tsig_waveform_init(&tsig_ctx.waveform_ctx, &tsig_ctx.params,
+                         &tsig_synth);
+      atomic_store(&tsig_ctx.subharmonic, tsig_ctx.waveform_ctx.subharmonic);
+      tsig_waveform_set_ppb(&tsig_ctx.waveform_ctx, &tsig_ctx.params,
+                            atomic_load(&tsig_ctx.ppb));
+      tsig_ctx.latency_ms = atomic_load(&tsig_ctx.latency_us) / 1000.0 +
+                            tsig_ctx.ahead_ms;
+      tsig_waveform_shift(&tsig_ctx.waveform_ctx, &tsig_ctx.params,
+                          tsig_ctx.latency_ms);
+      tsig_clockrate_restart(&tsig_ctx.clockrate_ctx, 0, emscripten_get_now());
+
+      /* Generation starts with the next render quantum. */
+      tsig_ctx.base_frame = frame + TSIG_RENDER_QUANTUM;
 
 #ifdef TSIG_DEBUG
-      printf("Wasm loaded params at %f, phase delta is %u / %u\n",
-             tsig_ctx.waveform_ctx.timestamp, tsig_ctx.waveform_ctx.phase_delta,
-             tsig_ctx.waveform_ctx.phase_base);
+      printf(
+          "Wasm loaded params at %f, phase delta is %llu (%d ppb), "
+          "subharmonic is %u\n",
+          tsig_ctx.waveform_ctx.timestamp, tsig_ctx.waveform_ctx.phase_delta,
+          tsig_ctx.waveform_ctx.ppb, tsig_ctx.waveform_ctx.subharmonic);
 #endif /* TSIG_DEBUG */
 
-      next_state = TSIG_STATE_FADE_IN;
+      /* Without a call to tsig_start(), just stay ready for one. */
+      next_state = atomic_load(&tsig_ctx.on_air) ? TSIG_STATE_FADE_IN
+                                                 : TSIG_STATE_STANDBY;
       break;
 
-    /* Fade in to prevent crackling. Run until tsig_stop() forces us to stop. */
+    /*
+     * Fade in to prevent crackling. Run until tsig_stop() forces us to stop.
+     * On warm standby, keep time just the same, but silently.
+     */
+    case TSIG_STATE_STANDBY:
     case TSIG_STATE_FADE_IN:
     case TSIG_STATE_RUNNING:
     case TSIG_STATE_FADE_OUT:
+      detect_gap(frame);
+
+      /* Keep the emitted frequency on target despite sample clock error. */
+      if (tsig_clockrate_update(&tsig_ctx.clockrate_ctx,
+                                tsig_ctx.waveform_ctx.samples - ahead_samples(),
+                                emscripten_get_now()))
+        update_ppb(tsig_ctx.clockrate_ctx.ppb);
+
+      /* Keep the emitted signal aligned with UTC as output latency changes. */
+      update_latency();
+
+      if (state == TSIG_STATE_STANDBY) {
+        tsig_waveform_advance(&tsig_ctx.waveform_ctx, &tsig_ctx.params);
+        break;
+      }
+
       /* NOTE: tsig_waveform_generate() can initiate state transitions. */
       tsig_waveform_generate(&tsig_ctx.waveform_ctx, &tsig_ctx.params, state,
                              &next_state, n_outputs, outputs);
       silent = 0;
+
+      /* Once faded out, stay ready for the next start if asked to. */
+      if (next_state == TSIG_STATE_SUSPEND && atomic_load(&tsig_ctx.warm))
+        next_state = TSIG_STATE_STANDBY;
       break;
 
     /* Delay to ensure no audible pop occurs upon AudioContext.suspend(). */
@@ -224,17 +443,168 @@ EM_BOOL tsig_awp_process_cb(int n_inputs, const AudioSampleFrame *inputs,
       break;
   }
 
-  /* Inform JS about state transitions we initiated. */
-  if (next_state != state) {
-    atomic_store(&tsig_ctx.state, next_state);
+  if (silent)
+    tsig_waveform_generate_silence(n_outputs, outputs);
+
+  /*
+   * JS in the main thread may have forced a state transition meanwhile, e.g.
+   * tsig_stop() to fade out. Only move on from the state rendered against.
+   */
+  if (next_state == state ||
+      !atomic_compare_exchange_strong(&tsig_ctx.state, &state, next_state))
+    return TSIG_RING_NO_STATE;
+
+  return next_state;
+}
+
+/**
+ * Render ahead into the ring for as long as the module runs.
+ * @note Runs in a Wasm Worker, which may be slow to render a quantum now and
+ *  then without the AWP missing a deadline. Sleeps while the module is idle
+ *  or the AWP renders.
+ */
+static void pipeline_worker_main() {
+  tsig_ring_t *ring = &tsig_pipeline.ring;
+
+  for (;;) {
+    /* Sleep for as long as the module is idle or renders in the AWP. */
+    if (!atomic_load(&tsig_ctx.render_ahead)) {
+      emscripten_atomic_wait_u32(&tsig_ctx.render_ahead, 0, -1);
+      continue;
+    }
+
+    uint32_t tail = atomic_load(&ring->tail);
+
+    /* The AWP output silence for quantums it was due before we got there. */
+    tsig_pipeline.frame +=
+        (uint64_t)tsig_ring_catch_up(ring) * TSIG_RENDER_QUANTUM;
+
+    /*
+     * On warm standby, stay just ahead of output, so that the fade in upon
+     * tsig_start() is heard at once rather than after the full lead. Output
+     * is on time however far ahead it is rendered, and the lead then grows
+     * back as the worker catches up.
+     */
+    uint32_t lead = atomic_load(&tsig_ctx.state) == TSIG_STATE_STANDBY
+                        ? tsig_pipeline.standby_lead
+                        : tsig_pipeline.lead;
+    float *out = tsig_ring_acquire(ring, lead);
+
+    /* Sleep until the AWP reads a quantum, or check back in a while. */
+    if (!out) {
+      emscripten_atomic_wait_u32(&ring->tail, tail,
+                                 1000000LL * TSIG_AHEAD_MS / 2);
+      continue;
+    }
+
+    AudioSampleFrame output = {.numberOfChannels = 1, .data = out};
+    int next_state = render_quantum(1, &output, tsig_pipeline.frame);
+    tsig_pipeline.frame += TSIG_RENDER_QUANTUM;
+    tsig_ring_commit(ring, next_state);
+  }
+}
+
+/**
+ * Copy a quantum rendered ahead to the output.
+ * @param n_outputs Count of audio output channels.
+ * @param outputs Array of audio output buffers.
+ * @return State transition initiated after the quantum, if any, else
+ *  `TSIG_RING_NO_STATE`.
+ * @note Runs in the Audio Worklet thread, in bounded time.
+ */
+static int pipeline_read(int n_outputs, AudioSampleFrame *outputs) {
+  tsig_ring_t *ring = &tsig_pipeline.ring;
+  int state = atomic_load(&tsig_ctx.state);
+  uint8_t is_live = (state >= TSIG_STATE_FADE_IN &&
+                     state <= TSIG_STATE_FADE_OUT) ||
+                    state == TSIG_STATE_STANDBY;
+  uint64_t frame = tsig_current_frame();
+  uint32_t skip = 0;
+
+  /* Stay on time past quantums the browser dropped, as detect_gap() does. */
+  if (is_live && tsig_pipeline.next_frame &&
+      frame > tsig_pipeline.next_frame)
+    skip = (frame - tsig_pipeline.next_frame) / TSIG_RENDER_QUANTUM;
+  tsig_pipeline.next_frame = frame + TSIG_RENDER_QUANTUM;
+
+  /* Quantums rendered before a restart may carry stale state transitions. */
+  if (atomic_exchange(&tsig_pipeline.discard, 0))
+    tsig_ring_discard(ring);
+
+  /* A quantum missed on warm standby would have been silent anyway. */
+  tsig_waveform_generate_silence(n_outputs, outputs);
+  int next_state = tsig_ring_read(ring, outputs[0].data, skip,
+                                  is_live && state != TSIG_STATE_STANDBY);
+  emscripten_atomic_notify(&ring->tail, 1);
+
+  return next_state;
+}
+
+/**
+ * Note when the first nonzero sample since tsig_start() is heard, if output.
+ * @param out Buffer of `TSIG_RENDER_QUANTUM` samples just output.
+ * @note Runs in the Audio Worklet thread, only until the sample is found.
+ */
+static void mark_first_sample(const float *out) {
+  for (int i = 0; i < TSIG_RENDER_QUANTUM; i++) {
+    if (out[i] != 0.0F) {
+      double latency_ms = atomic_load(&tsig_ctx.latency_us) / 1000.0;
+      tsig_ctx.first_sample_ms =
+          emscripten_get_now() + latency_ms +
+          1000.0 * i / tsig_ctx.waveform_ctx.sample_rate;
+      atomic_store(&tsig_ctx.marking, 0);
+      return;
+    }
+  }
+}
+
+/**
+ * Process `TSIG_RENDER_QUANTUM` samples of audio.
+ * @param n_inputs Count of audio input channels.
+ * @param inputs Array of audio input buffers.
+ * @param n_outputs Count of audio output channels.
+ * @param outputs Array of audio output buffers.
+ * @param n_params Count of audio parameters. Unused.
+ * @param params Array of audio parameters. Unused.
+ * @param userdata Pointer to user data. Unused.
+ * @return Always `EM_TRUE`.
+ * @note Equivalent to AudioWorkletProcessor.process(). Runs in a real-time
+ *  Audio Worklet thread within AudioWorkletGlobalScope.
+ */
+EM_BOOL tsig_awp_process_cb(int n_inputs, const AudioSampleFrame *inputs,
+                            int n_outputs, AudioSampleFrame *outputs,
+                            int n_params, const AudioParamFrame *params,
+                            void *userdata) {
+  uint8_t render_ahead = atomic_load(&tsig_ctx.render_ahead);
+
+  /*
+   * Nothing to output until tsig_start(). JS suspends the AudioContext once
+   * idle, but until then, spend as little time here as possible.
+   */
+  if (!render_ahead && atomic_load(&tsig_ctx.state) == TSIG_STATE_IDLE) {
+    tsig_waveform_generate_silence(n_outputs, outputs);
+    return EM_TRUE;
+  }
+
+  /* Either copy what a Wasm Worker rendered ahead, or render right here. */
+  int next_state = render_ahead ? pipeline_read(n_outputs, outputs)
+                                : render_quantum(n_outputs, outputs,
+                                                 tsig_current_frame());
+
+  /* Everything after the transition to idle is silence. */
+  if (next_state == TSIG_STATE_IDLE)
+    atomic_store(&tsig_ctx.render_ahead, 0);
+
+  if (atomic_load(&tsig_ctx.marking))
+    mark_first_sample(outputs[0].data);
+
+  /* Inform JS about state transitions we initiated, as they are output. */
+  if (next_state != TSIG_RING_NO_STATE) {
     /* Audio Worklet thread must not block. Inform JS via the main thread. */
     emscripten_audio_worklet_post_function_vi(EMSCRIPTEN_AUDIO_MAIN_THREAD,
                                               tsig_js_cb, next_state);
   }
 
-  if (silent)
-    tsig_waveform_generate_silence(n_outputs, outputs);
-
   return EM_TRUE;
 }
 
@@ -319,6 +689,7 @@ EMSCRIPTEN_KEEPALIVE void tsig_init(EMSCRIPTEN_WEBAUDIO_T audio_ctx,
 
   atomic_store(&tsig_ctx.state, TSIG_STATE_IDLE);
   tsig_ctx.waveform_ctx.sample_rate = sample_rate;
+  tsig_ctx.clockrate_ctx.sample_rate = sample_rate;
   rearm_state_transition_delay();
   tsig_js_cb = js_cb;
 
@@ -327,20 +698,81 @@ EMSCRIPTEN_KEEPALIVE void tsig_init(EMSCRIPTEN_WEBAUDIO_T audio_ctx,
       init_js_cb);
 }
 
-/** Start generating a time station signal. */
-EMSCRIPTEN_KEEPALIVE void tsig_start() {
+/**
+ * Leave `TSIG_STATE_IDLE` to start up, and eventually request params.
+ * @param render_ahead Whether to render ahead in a Wasm Worker.
+ */
+static void start_up(uint8_t render_ahead) {
+  if (render_ahead && !tsig_pipeline.worker) {
+    uint32_t sample_rate = tsig_ctx.waveform_ctx.sample_rate;
+    uint32_t lead = (uint64_t)sample_rate * TSIG_AHEAD_MS /
+                    (1000 * TSIG_RENDER_QUANTUM);
+    uint32_t standby_lead = (uint64_t)sample_rate * TSIG_STANDBY_AHEAD_MS /
+                            (1000 * TSIG_RENDER_QUANTUM);
+
+    tsig_pipeline.lead = tsig_min(lead, TSIG_RING_QUANTUMS - 1);
+    tsig_pipeline.standby_lead = tsig_max(standby_lead, 1);
+    tsig_pipeline.worker = emscripten_create_wasm_worker(
+        tsig_worker_stack, sizeof(tsig_worker_stack));
+    emscripten_wasm_worker_post_function_v(tsig_pipeline.worker,
+                                           pipeline_worker_main);
+  }
+
+  /* Render ahead before leaving idle, so only one thread renders at a time. */
+  tsig_ctx.ahead_ms = 0;
+  atomic_store(&tsig_pipeline.discard, render_ahead);
+  atomic_store(&tsig_ctx.render_ahead, render_ahead);
   atomic_store(&tsig_ctx.state, TSIG_STATE_STARTUP);
+  emscripten_atomic_notify(&tsig_ctx.render_ahead, 1);
   tsig_js_cb(TSIG_STATE_STARTUP);
 }
 
+/**
+ * Start generating a time station signal.
+ * @param render_ahead Whether to render ahead in a Wasm Worker, so that a
+ *  slow render quantum cannot cause a glitch, rather than in the Audio
+ *  Worklet thread.
+ * @param standby Whether to go on warm standby, rather than suspend, once
+ *  stopped.
+ * @note Should be called by JS after AudioContext.resume() resolves, or
+ *  once in `TSIG_STATE_STANDBY`, in which case the module fades in at once
+ *  and both parameters are ignored.
+ */
+EMSCRIPTEN_KEEPALIVE void tsig_start(uint8_t render_ahead, uint8_t standby) {
+  tsig_ctx.first_sample_ms = 0;
+  atomic_store(&tsig_ctx.marking, 1);
+  atomic_store(&tsig_ctx.on_air, 1);
+
+  if (atomic_load(&tsig_ctx.state) == TSIG_STATE_STANDBY) {
+    atomic_store(&tsig_ctx.state, TSIG_STATE_FADE_IN);
+    tsig_js_cb(TSIG_STATE_FADE_IN);
+    return;
+  }
+
+  atomic_store(&tsig_ctx.warm, standby);
+  start_up(render_ahead);
+}
+
+/**
+ * Set the output latency of the AudioContext.
+ * @param latency_ms Output latency in milliseconds.
+ * @note Should be called by JS before tsig_load_params() and whenever the
+ *  output latency changes afterwards. Changes are applied gradually.
+ */
+EMSCRIPTEN_KEEPALIVE void tsig_set_latency(double latency_ms) {
+  atomic_store(&tsig_ctx.latency_us, latency_ms * 1000.0);
+}
+
 /**
  * Load user params.
- * @param offset User offset in milliseconds.
+ * @param offset User offset in milliseconds, excluding output latency.
  * @param station Time station.
  * @param jjy_khz JJY frequency.
  * @param dut1 DUT1 value in milliseconds.
  * @note Should be called by JS in response to being notified of a state
- *  transition to `TSIG_STATE_REQ_PARAMS`.
+ *  transition to `TSIG_STATE_REQ_PARAMS`. The tables rendering reads are
+ *  filled and the synthesis for the params is chosen here, in the main
+ *  thread, so that whatever renders only ever reads them.
  */
 EMSCRIPTEN_KEEPALIVE void tsig_load_params(double offset, uint8_t station,
                                            uint8_t jjy_khz, int16_t dut1,
@@ -357,19 +789,84 @@ EMSCRIPTEN_KEEPALIVE void tsig_load_params(double offset, uint8_t station,
   tsig_params.jjy_khz = jjy_khz;
   tsig_params.dut1 = dut1;
   tsig_params.noclip = noclip;
+  tsig_waveform_init_tables(tsig_ctx.waveform_ctx.sample_rate);
+  tsig_synth = *tsig_waveform_choose_synth(&tsig_params,
+                                           tsig_ctx.waveform_ctx.sample_rate);
 
   atomic_store(&tsig_ctx.state, TSIG_STATE_LOAD_PARAMS);
   tsig_js_cb(TSIG_STATE_LOAD_PARAMS);
 }
 
-/** Stop generating a time station signal. */
+/**
+ * Get the sample clock correction in use.
+ * @return Estimated sample clock error in parts per billion, or 0 if there is
+ *  no estimate yet. Positive if the audio output device runs fast.
+ */
+EMSCRIPTEN_KEEPALIVE int32_t tsig_get_ppb() {
+  return atomic_load(&tsig_ctx.ppb);
+}
+
+/**
+ * Get the count of resynchronizations after dropped render quantums.
+ * @return Count since module initialization.
+ */
+EMSCRIPTEN_KEEPALIVE int32_t tsig_get_resyncs() {
+  return atomic_load(&tsig_ctx.resyncs);
+}
+
+/**
+ * Get how full the ring rendered ahead into is.
+ * @return Milliseconds of audio rendered but not yet output.
+ */
+EMSCRIPTEN_KEEPALIVE double tsig_get_ahead_ms() {
+  return 1000.0 * ahead_samples() / tsig_ctx.waveform_ctx.sample_rate;
+}
+
+/**
+ * Get the count of quantums output as silence because they were due before
+ * being rendered ahead.
+ * @return Count since module initialization.
+ */
+EMSCRIPTEN_KEEPALIVE int32_t tsig_get_underflows() {
+  return atomic_load(&tsig_pipeline.ring.underflows);
+}
+
+/**
+ * Get when the first sample since tsig_start() was heard.
+ * @return Local timestamp in milliseconds, including output latency, or 0
+ *  if no sample has been output yet.
+ */
+EMSCRIPTEN_KEEPALIVE double tsig_get_first_sample_ms() {
+  return atomic_load(&tsig_ctx.marking) ? 0 : tsig_ctx.first_sample_ms;
+}
+
+/**
+ * Get how the target frequency is generated.
+ * @return Number of the subharmonic generated in its place, or 1 if the
+ *  sample rate is high enough to generate it directly. 0 if no params have
+ *  been loaded yet.
+ */
+EMSCRIPTEN_KEEPALIVE int32_t tsig_get_subharmonic() {
+  return atomic_load(&tsig_ctx.subharmonic);
+}
+
+/**
+ * Stop generating a time station signal.
+ * @note Fades out, then suspends or goes on warm standby as asked by
+ *  tsig_start(). Leaves warm standby, or startup, for `TSIG_STATE_IDLE` at
+ *  once.
+ */
 EMSCRIPTEN_KEEPALIVE void tsig_stop() {
   int state = atomic_load(&tsig_ctx.state);
   int next_state = TSIG_STATE_FADE_OUT;
 
+  atomic_store(&tsig_ctx.on_air, 0);
+
   /* No need to fade out if playback never started. */
-  if (state < TSIG_STATE_FADE_IN) {
+  if (state < TSIG_STATE_FADE_IN || state == TSIG_STATE_STANDBY) {
     rearm_state_transition_delay();
+    atomic_store(&tsig_ctx.warm, 0);
+    atomic_store(&tsig_ctx.render_ahead, 0);
     next_state = TSIG_STATE_IDLE;
   }
 
@@ -377,6 +874,118 @@ EMSCRIPTEN_KEEPALIVE void tsig_stop() {
   tsig_js_cb(next_state);
 }
 
+/**
+ * Load user params for the Web Audio automation engine.
+ *
+ * The automation engine renders the carrier with an OscillatorNode and keys
+ * its gain with automation scheduled ahead, so Wasm computes only the edges
+ * of each minute, in the main thread. The Audio Worklet stays idle.
+ *
+ * @param offset User offset in milliseconds, excluding output latency.
+ * @param station Time station.
+ * @param jjy_khz JJY frequency.
+ * @param dut1 DUT1 value in milliseconds.
+ * @param sample_rate Sample rate of the AudioContext.
+ */
+EMSCRIPTEN_KEEPALIVE void tsig_sched_load_params(double offset, uint8_t station,
+                                                 uint8_t jjy_khz, int16_t dut1,
+                                                 uint32_t sample_rate) {
+  tsig_params_t *params = &tsig_sched_ctx.params;
+
+  params->offset = offset;
+  params->station = station;
+  params->jjy_khz = jjy_khz;
+  params->dut1 = dut1;
+  params->noclip = 0;
+
+  tsig_sched_ctx.synth = *tsig_waveform_choose_synth(params, sample_rate);
+  tsig_sched_ctx.frame.len = 0;
+  tsig_sched_ctx.min_ms = 0;
+}
+
+/**
+ * Get the carrier frequency for the automation engine to render.
+ * @return Frequency of the subharmonic chosen, in Hz.
+ */
+EMSCRIPTEN_KEEPALIVE double tsig_sched_get_hz() {
+  tsig_waveform_synth_t *synth = &tsig_sched_ctx.synth;
+  return (double)synth->target_hz / synth->subharmonic;
+}
+
+/**
+ * Get how the automation engine renders the target frequency.
+ * @return Number of the subharmonic rendered in its place, or 1 if the
+ *  sample rate is high enough to render it directly. 0 if no params have
+ *  been loaded yet.
+ */
+EMSCRIPTEN_KEEPALIVE int32_t tsig_sched_get_subharmonic() {
+  return tsig_sched_ctx.synth.subharmonic;
+}
+
+/**
+ * Get the quantization scale for the automation engine to emulate.
+ * @return Scale factor for emulated quantization.
+ */
+EMSCRIPTEN_KEEPALIVE int32_t tsig_sched_get_scale() {
+  return tsig_sched_ctx.synth.scale;
+}
+
+/**
+ * Schedule the station minute in progress at a local timestamp.
+ * @param timestamp Local timestamp in milliseconds.
+ * @return Count of edges in the minute.
+ */
+EMSCRIPTEN_KEEPALIVE int32_t tsig_sched_minute(double timestamp) {
+  tsig_params_t *params = &tsig_sched_ctx.params;
+  uint32_t utc_offset = TSIG_WAVEFORM_STATION_DATA[params->station].utc_offset;
+  double ms = timestamp + utc_offset + params->offset;
+
+  tsig_sched_ctx.min_ms =
+      tsig_waveform_sched_minute(&tsig_sched_ctx.frame, params, ms);
+  return tsig_sched_ctx.frame.len;
+}
+
+/**
+ * Schedule the station minute after the one last scheduled.
+ * @return Count of edges in the minute.
+ * @note Minutes follow each other exactly, which local timestamps converted
+ *  back and forth may not.
+ */
+EMSCRIPTEN_KEEPALIVE int32_t tsig_sched_next_minute() {
+  double ms = tsig_sched_ctx.min_ms + TSIG_DATETIME_MSECS_MIN;
+
+  tsig_sched_ctx.min_ms =
+      tsig_waveform_sched_minute(&tsig_sched_ctx.frame, &tsig_sched_ctx.params,
+                                 ms);
+  return tsig_sched_ctx.frame.len;
+}
+
+/**
+ * Get when an edge of the minute last scheduled occurs.
+ * @param i Index of the edge.
+ * @return Local timestamp in milliseconds, or the start of the next minute if
+ *  `i` is the count of edges.
+ */
+EMSCRIPTEN_KEEPALIVE double tsig_sched_edge_ms(int32_t i) {
+  tsig_params_t *params = &tsig_sched_ctx.params;
+  tsig_waveform_frame_t *frame = &tsig_sched_ctx.frame;
+  uint32_t utc_offset = TSIG_WAVEFORM_STATION_DATA[params->station].utc_offset;
+  double ms = i < frame->len ? frame->edges[i].us / 1000.0
+                             : TSIG_DATETIME_MSECS_MIN;
+
+  return tsig_sched_ctx.min_ms + ms - utc_offset - params->offset;
+}
+
+/**
+ * Get the gain from an edge of the minute last scheduled onward.
+ * @param i Index of the edge.
+ * @return Gain in [-1.0F-1.0F], negative if the carrier's phase is inverted.
+ */
+EMSCRIPTEN_KEEPALIVE float tsig_sched_edge_gain(int32_t i) {
+  return tsig_waveform_edge_gain(&tsig_sched_ctx.frame.edges[i],
+                                 &tsig_sched_ctx.params);
+}
+
 #ifdef TSIG_DEBUG
 EMSCRIPTEN_KEEPALIVE uint32_t tsig_print_timestamp(double timestamp, int n) {
   uint32_t ret = 0;
@@ -15,9 +15,21 @@
 #define TSIG_AWP_NAME       "time-signal" /** Name of AudioWorkletProcessor. */
 #define TSIG_AWP_STACK_SIZE 4096          /** AWP thread stack size. */
 
+/** Stack and TLS size of the Wasm Worker that renders ahead. */
+#define TSIG_WORKER_STACK_SIZE 8192
+
+/** How far ahead of output the Wasm Worker renders, at most. */
+#define TSIG_AHEAD_MS 250
+
+/** How far ahead it renders on warm standby, so a start is heard soon. */
+#define TSIG_STANDBY_AHEAD_MS 10
+
 #define TSIG_FADE_MS  35
 #define TSIG_DELAY_MS 465
 
+/** Minimum change in sample clock error estimate that retunes the waveform. */
+#define TSIG_RETUNE_PPB 100
+
 #define TSIG_STATION_BPC   0
 #define TSIG_STATION_DCF77 1
 #define TSIG_STATION_JJY   2
@@ -35,6 +47,7 @@
 #define TSIG_STATE_RUNNING     5
 #define TSIG_STATE_FADE_OUT    6
 #define TSIG_STATE_SUSPEND     7
+#define TSIG_STATE_STANDBY     8
 
 typedef void (*tsig_js_cb_func)(int data);
 
@@ -52,5 +65,5 @@ static inline int64_t tsig_min(int64_t a, int64_t b) {
 }
 
 static inline int64_t tsig_max(int64_t a, int64_t b) {
-  return a < b ? a : b;
+  return a > b ? a : b;
 }
@@ -2,21 +2,92 @@
 
 #include <stdint.h>
 #include <math.h>
+#include <string.h>
 #include <emscripten/webaudio.h>
+#include "analyzer.h"
 #include "datetime.h"
 #include "timesignal.h"
 
 #define TSIG_WAVEFORM_2PI                   6.28318530717958647692
+#define TSIG_WAVEFORM_CYCLE                 18446744073709551616.0 /* 2^64 */
+#define TSIG_WAVEFORM_HALF_CYCLE            (UINT64_C(1) << 63)
 #define TSIG_WAVEFORM_LERP_RATE             0.015F
 #define TSIG_WAVEFORM_LERP_MIN_DELTA        0.005F
 #define TSIG_WAVEFORM_SYNC_MARKER           0xff
 #define TSIG_WAVEFORM_SUBHARMONIC_THRESHOLD 20000
+#define TSIG_WAVEFORM_SUBHARMONIC_DIRECT    1
 #define TSIG_WAVEFORM_SUBHARMONIC_THIRD     3
 #define TSIG_WAVEFORM_SUBHARMONIC_FIFTH     5
 
-/* Our internal time quantum is a "tick". */
-#define TSIG_WAVEFORM_TICK_MS       50
-#define TSIG_WAVEFORM_TICKS_PER_SEC (1000 / TSIG_WAVEFORM_TICK_MS)
+/*
+ * At high sample rates, the target frequency itself may be far enough below
+ * Nyquist to survive the output's anti-imaging filter, so it can be emitted
+ * directly with far more energy than any harmonic.
+ */
+#define TSIG_WAVEFORM_DIRECT_MAX_RATIO 0.4
+
+/*
+ * Sine is looked up by the top bits of phase and linearly interpolated by
+ * the next ones. Its error (about 1.2e-6) is below the step of emulated
+ * quantization even when synthesizing directly at 192 kHz.
+ */
+#define TSIG_WAVEFORM_SINE_BITS      11
+#define TSIG_WAVEFORM_SINE_TABLE_LEN (1 << TSIG_WAVEFORM_SINE_BITS)
+#define TSIG_WAVEFORM_SINE_FRAC_BITS 24
+
+/*
+ * Subharmonic and quantization scale are chosen per sample rate and station
+ * by rendering a short buffer for each candidate and measuring the energy at
+ * the target frequency. Only odd subharmonics are tried (see tsig_gen_sample).
+ * A candidate must keep the station's low level within tolerance of its
+ * nominal ratio, as coarse quantization can crush it to silence.
+ */
+#define TSIG_WAVEFORM_SYNTH_MAX_SUBHARMONIC 9
+#define TSIG_WAVEFORM_SYNTH_ANALYSIS_LEN    1024
+#define TSIG_WAVEFORM_SYNTH_LOW_TOL_DB      3.0
+#define TSIG_WAVEFORM_SYNTH_LOW_TIE_DB      0.5
+#define TSIG_WAVEFORM_SYNTH_FLOOR           1e-4 /* -80 dB, i.e. noise. */
+#define TSIG_WAVEFORM_SYNTH_TIE             0.01 /* Prefer finer within 1%. */
+#define TSIG_WAVEFORM_SYNTH_CACHE_LEN       8
+
+/*
+ * Once running, an interpolated gain change decays exponentially towards its
+ * target, so it is looked up in a table of the decay per sample. A change of
+ * full scale (the largest possible) decays to within the minimum delta in
+ * ceil(log(LERP_MIN_DELTA) / log(1 - LERP_RATE)) samples.
+ */
+#define TSIG_WAVEFORM_LERP_STEPS 351
+
+/*
+ * Fades follow a quadratic curve over TSIG_FADE_MS, looked up per sample in a
+ * table long enough for the highest sample rate an AudioContext may have
+ * (105 KiB at 768 kHz). The table is filled for the sample rate in use.
+ */
+#define TSIG_WAVEFORM_MAX_SAMPLE_RATE 768000
+#define TSIG_WAVEFORM_FADE_STEPS \
+  (TSIG_WAVEFORM_MAX_SAMPLE_RATE * TSIG_FADE_MS / 1000)
+
+/*
+ * Each station minute is a frame: a sorted list of edges, each at which the
+ * transmit level and/or phase modulation changes. Edges fall on whole
+ * milliseconds today but are kept in microseconds. No frame has more than
+ * 179 edges: DCF77 has at most three a second (the start of the second, the
+ * end of its amplitude pulse and the start of its chips) and two in the 59th
+ * second. JJY's Morse callsign turns 18 level edges into 49, for at most 151,
+ * and other stations have at most two a second. A frame that would have more
+ * is truncated and marked as overflowed, which the native harnesses check
+ * never happens.
+ */
+#define TSIG_WAVEFORM_MAX_EDGES 192
+
+/* Transmit levels. Off is for on-off keying, e.g. JJY's Morse code. */
+#define TSIG_WAVEFORM_LEVEL_OFF  0
+#define TSIG_WAVEFORM_LEVEL_LOW  1
+#define TSIG_WAVEFORM_LEVEL_HIGH 2
+
+/* Phase modulation flags. Spread is for DCF77's phase chips. */
+#define TSIG_WAVEFORM_PHASE_INVERTED 1
+#define TSIG_WAVEFORM_PHASE_SPREAD   2
 
 /*
  * JJY makes announcements during minutes 15 and 45. From about
@@ -27,38 +98,114 @@
 #define TSIG_WAVEFORM_JJY_MORSE_SEC     40
 #define TSIG_WAVEFORM_JJY_MORSE_MS      550
 #define TSIG_WAVEFORM_JJY_MORSE_END_SEC 49
-#define TSIG_WAVEFORM_JJY_MORSE_TICK                             \
-  ((TSIG_WAVEFORM_JJY_MORSE_SEC * TSIG_WAVEFORM_TICKS_PER_SEC) + \
-   (TSIG_WAVEFORM_JJY_MORSE_MS / TSIG_WAVEFORM_TICK_MS))
-#define TSIG_WAVEFORM_JJY_MORSE_END_TICK \
-  (TSIG_WAVEFORM_JJY_MORSE_END_SEC * TSIG_WAVEFORM_TICKS_PER_SEC)
-
-/* Duration of Morse code symbols as ticks. */
-#define TSIG_WAVEFORM_TICKS_PER_DIT 2
-#define TSIG_WAVEFORM_TICKS_PER_DAH 5
-#define TSIG_WAVEFORM_TICKS_PER_IEG 1  /* Inter-element gap. */
-#define TSIG_WAVEFORM_TICKS_PER_ICG 6  /* Inter-character gap. */
-#define TSIG_WAVEFORM_TICKS_PER_IWG 10 /* Inter-word gap. */
-
-static void tsig_xmit_bpc(tsig_datetime_t, tsig_params_t *, uint8_t[]);
-static void tsig_xmit_dcf77(tsig_datetime_t, tsig_params_t *, uint8_t[]);
-static void tsig_xmit_jjy(tsig_datetime_t, tsig_params_t *, uint8_t[]);
-static void tsig_xmit_msf(tsig_datetime_t, tsig_params_t *, uint8_t[]);
-static void tsig_xmit_wwvb(tsig_datetime_t, tsig_params_t *, uint8_t[]);
+
+/*
+ * Since 2012, WWVB also keys the phase of its carrier with a separate time
+ * code, inverting it for whole seconds. The time word is the minute of the
+ * century, protected by Hamming parity and preceded by a sync word.
+ */
+#define TSIG_WAVEFORM_WWVB_SYNC_T   0x768 /* 13 bits, sent from second 0. */
+#define TSIG_WAVEFORM_WWVB_EPOCH    946684800000.0 /* 2000-01-01T00:00Z */
+#define TSIG_WAVEFORM_WWVB_DST_NEXT 0x07  /* Not forecast; see below. */
+
+/*
+ * From 200 ms into each second, DCF77 also spreads its carrier with 512
+ * pseudorandom phase chips of 120 cycles each, carrying the same time code
+ * bits (the whole sequence is inverted for a 1). Each chip deviates phase by
+ * +/-15.6 degrees. The chips are the maximal sequence of a 9-stage shift
+ * register with feedback from stages 9 and 5, followed by a 0.
+ */
+#define TSIG_WAVEFORM_DCF77_CHIP_MS     200
+#define TSIG_WAVEFORM_DCF77_CHIPS       512
+#define TSIG_WAVEFORM_DCF77_CHIP_CYCLES 120
+#define TSIG_WAVEFORM_DCF77_CHIP_DEG    15.6
+#define TSIG_WAVEFORM_DCF77_LFSR_STAGES 9
+#define TSIG_WAVEFORM_DCF77_LFSR_TAP    5
+
+/*
+ * Chips are looked up by the top bits of a chip phase accumulator. The table
+ * is twice as long as the sequence and zero after it, so the rest of the
+ * second is left unspread without any check per sample.
+ */
+#define TSIG_WAVEFORM_CHIP_TABLE_BITS 10
+#define TSIG_WAVEFORM_CHIP_TABLE_LEN  (1 << TSIG_WAVEFORM_CHIP_TABLE_BITS)
+
+/* Duration of Morse code symbols in milliseconds. */
+#define TSIG_WAVEFORM_MORSE_DIT_MS 100
+#define TSIG_WAVEFORM_MORSE_DAH_MS 250
+#define TSIG_WAVEFORM_MORSE_IEG_MS 50  /* Inter-element gap. */
+#define TSIG_WAVEFORM_MORSE_ICG_MS 300 /* Inter-character gap. */
+#define TSIG_WAVEFORM_MORSE_IWG_MS 500 /* Inter-word gap. */
+
+/** A change of transmit level and/or phase modulation. */
+typedef struct tsig_waveform_edge_t {
+  uint32_t us;   /** Microseconds since the start of the station minute. */
+  uint8_t level; /** Transmit level from this edge on. */
+  uint8_t phase; /** Phase modulation flags from this edge on. */
+} tsig_waveform_edge_t;
+
+/** Edges of a station minute. The first is always at its start. */
+typedef struct tsig_waveform_frame_t {
+  tsig_waveform_edge_t edges[TSIG_WAVEFORM_MAX_EDGES];
+  uint16_t len;       /** Count of edges. */
+  uint8_t overflowed; /** Whether edges were dropped for want of room. */
+} tsig_waveform_frame_t;
+
+static void tsig_xmit_bpc(tsig_datetime_t, tsig_params_t *,
+                          tsig_waveform_frame_t *);
+static void tsig_xmit_dcf77(tsig_datetime_t, tsig_params_t *,
+                            tsig_waveform_frame_t *);
+static void tsig_xmit_jjy(tsig_datetime_t, tsig_params_t *,
+                          tsig_waveform_frame_t *);
+static void tsig_xmit_msf(tsig_datetime_t, tsig_params_t *,
+                          tsig_waveform_frame_t *);
+static void tsig_xmit_wwvb(tsig_datetime_t, tsig_params_t *,
+                           tsig_waveform_frame_t *);
+static void tsig_xmit_phase_dcf77(tsig_datetime_t, tsig_params_t *, uint8_t[]);
+static void tsig_xmit_phase_wwvb(tsig_datetime_t, tsig_params_t *, uint8_t[]);
 
 typedef void (*waveform_xmit_func)(tsig_datetime_t datetime,
-                                   tsig_params_t *params, uint8_t xmit_level[]);
+                                   tsig_params_t *params,
+                                   tsig_waveform_frame_t *frame);
+
+typedef void (*waveform_phase_func)(tsig_datetime_t datetime,
+                                    tsig_params_t *params,
+                                    uint8_t xmit_phase[]);
 
 /** Characteristics of a real time station's signal. */
 typedef struct waveform_station_data {
-  /** Pointer to a function that generates transmit level flags. */
+  /** Pointer to a function that generates transmit level edges. */
   waveform_xmit_func gen_xmit;
 
-  uint32_t utc_offset; /** Usual (not summer time) UTC offset. */
-  uint32_t target_hz;  /** Actual broadcast frequency. */
-  float xmit_low;      /** Low gain in [0.0F-1.0F]. */
+  /** Pointer to a function that generates phase inversion flags, if any. */
+  waveform_phase_func gen_phase;
+
+  uint32_t utc_offset;  /** Usual (not summer time) UTC offset. */
+  uint32_t target_hz;   /** Actual broadcast frequency. */
+  float xmit_low;       /** Low gain in [0.0F-1.0F]. */
+  uint32_t chip_cycles; /** Cycles per phase chip, or 0 to invert instead. */
 } waveform_station_data_t;
 
+/** One cycle of sine, plus its first sample again for interpolation. */
+static float TSIG_WAVEFORM_SINE_TABLE[TSIG_WAVEFORM_SINE_TABLE_LEN + 1];
+
+/** Remaining share of an interpolated gain change after each sample. */
+static float TSIG_WAVEFORM_LERP_TABLE[TSIG_WAVEFORM_LERP_STEPS + 1];
+
+/** Fade gain after each sample of a fade in, from silence to full. */
+static float TSIG_WAVEFORM_FADE_TABLE[TSIG_WAVEFORM_FADE_STEPS + 1];
+
+/** Phase chips of the DCF77 spreading sequence as +1/-1, then zeros. */
+static int8_t TSIG_WAVEFORM_DCF77_CHIP_TABLE[TSIG_WAVEFORM_CHIP_TABLE_LEN];
+
+/** Quantization scales to try, besides the sample rate over subharmonic. */
+static const int TSIG_WAVEFORM_SYNTH_SCALES[] = {
+    2,  3,  4,  5,  6,  7,  8,  9,  10, 11,  12,  13,  14,  15,  16,  17,
+    18, 19, 20, 21, 22, 23, 24, 32, 48, 64, 96, 128, 192, 256, 512, 1024};
+
+/** Scratch buffer for measuring candidate syntheses. */
+static float TSIG_WAVEFORM_SYNTH_BUF[TSIG_WAVEFORM_SYNTH_ANALYSIS_LEN];
+
 static waveform_station_data_t TSIG_WAVEFORM_STATION_DATA[] = {
     [TSIG_STATION_BPC] =
         {
@@ -70,9 +217,11 @@ static waveform_station_data_t TSIG_WAVEFORM_STATION_DATA[] = {
     [TSIG_STATION_DCF77] =
         {
             .gen_xmit = tsig_xmit_dcf77,
+            .gen_phase = tsig_xmit_phase_dcf77,
             .utc_offset = 3600000, /* CET is UTC+0100 */
             .target_hz = 77500,
-            .xmit_low = 0.14962357F /* -16.5 dB */
+            .xmit_low = 0.14962357F, /* -16.5 dB */
+            .chip_cycles = TSIG_WAVEFORM_DCF77_CHIP_CYCLES
         },
     [TSIG_STATION_JJY] =
         {
@@ -91,6 +240,7 @@ static waveform_station_data_t TSIG_WAVEFORM_STATION_DATA[] = {
     [TSIG_STATION_WWVB] =
         {
             .gen_xmit = tsig_xmit_wwvb,
+            .gen_phase = tsig_xmit_phase_wwvb,
             .utc_offset = 0, /* UTC */
             .target_hz = 60000,
             .xmit_low = 0.14125375F /* -17 dB */
@@ -106,26 +256,72 @@ typedef struct tsig_waveform_ctx_t {
   /** Sample rate of AudioContext. */
   uint32_t sample_rate;
 
-  /** Bitfield of per-tick transmit level flags for current station minute. */
-  uint8_t xmit_level[60 * TSIG_WAVEFORM_TICKS_PER_SEC / CHAR_BIT];
+  /** Edges of current station minute. */
+  tsig_waveform_frame_t frame;
+
+  double timestamp;      /** Base timestamp of this waveform context. */
+  double min_ms;         /** Station timestamp at which that minute begins. */
+  uint64_t samples;      /** Sample count since base timestamp. */
+  uint64_t next_edge;    /** Sample count at next edge. */
+  uint16_t edge;         /** Index of next edge within current minute. */
+  uint8_t level;         /** Current transmit level. */
+  uint8_t xmit_stale;    /** Whether the frame needs regenerating. */
 
-  double timestamp;   /** Base timestamp of this waveform context. */
-  uint32_t samples;   /** Sample count since that timestamp. */
-  uint32_t next_tick; /** Sample count at next tick. */
-  uint32_t morse_end; /** Sample count when on-off keying should stop. */
-  uint16_t tick;      /** Tick index within current station minute. */
+  /*
+   * Sample counts and timestamps are converted piecewise-linearly, as the
+   * sample clock correction may change at any sample.
+   */
+  uint64_t base_samples; /** Sample count when correction last changed. */
+  double base_ms;        /** Milliseconds since base timestamp at that time. */
+  double rate;           /** Samples output per second since that time. */
 
-  uint32_t phase_delta; /** Phase numerator delta per generated sample. */
-  uint32_t phase_base;  /** Phase denominator. */
-  uint32_t phase;       /** Phase numerator. */
+  uint8_t subharmonic;   /** Subharmonic number, or 1 if direct. */
+  double subharmonic_hz; /** Frequency of generated subharmonic. */
+  int32_t ppb;           /** Sample clock correction in parts per billion. */
 
-  uint32_t max_fade_gain; /** Maximum fade gain. */
-  uint32_t fade_gain;     /** Fade gain. Relative to max. */
-  float gain;             /** Actual current gain in [0.0F-1.0F]. */
+  /*
+   * Phase is a 64-bit binary fraction of a cycle, so it wraps for free and
+   * can represent any frequency to within about 1e-14 Hz.
+   */
+  uint64_t phase_delta; /** Phase delta per generated sample. */
+  uint64_t phase;       /** Phase. */
+  uint64_t phase_shift; /** Phase modulation for current edge. */
+
+  /* Chip phase is likewise a binary fraction, of the chip table. */
+  double chip_hz;       /** Chip rate, or 0 if not spread. */
+  uint64_t chip_delta;  /** Chip phase delta per generated sample. */
+  uint64_t chip_phase;  /** Chip phase. */
+  uint64_t chip_dev;    /** Phase deviation of each chip at the subharmonic. */
+  int64_t chip_step;    /** Signed chip deviation for current edge, if any. */
+
+  uint32_t max_fade_gain; /** Samples in a fade, i.e. maximum fade gain. */
+  uint32_t fade_gain;     /** Index into the fade table. */
+  float gain;             /** Current gain in [0.0F-1.0F], before any fade. */
+
+  /* Gain changes are interpolated from the lerp table. */
+  float ramp_target;  /** Gain being interpolated towards. */
+  float ramp_delta;   /** Initial difference from that gain. */
+  uint16_t ramp_pos;  /** Samples of the change so far. */
+  uint16_t ramp_len;  /** Samples until the change snaps to its target. */
 
   int scale; /** Scale factor for emulated integer-quantized LPCM. */
 } tsig_waveform_ctx_t;
 
+/** Synthesis chosen for a sample rate and station. */
+typedef struct tsig_waveform_synth_t {
+  uint32_t sample_rate; /** Sample rate of AudioContext. */
+  uint32_t target_hz;   /** Frequency to be picked up. */
+  uint8_t station;      /** Station, for its low level. */
+  uint8_t subharmonic;  /** Subharmonic number, or 1 if direct. */
+  int scale;            /** Scale factor for emulated quantization. */
+  double level;         /** Measured amplitude at target (full scale = 1). */
+} tsig_waveform_synth_t;
+
+/** Syntheses chosen so far, most recent last. Main thread only. */
+static tsig_waveform_synth_t
+    TSIG_WAVEFORM_SYNTH_CACHE[TSIG_WAVEFORM_SYNTH_CACHE_LEN];
+static int tsig_waveform_synth_cached = 0;
+
 static inline uint32_t tsig_calculate_target_hz(tsig_params_t *params) {
   return params->station != TSIG_STATION_JJY ||
                  params->jjy_khz != TSIG_JJYKHZ_60
@@ -133,19 +329,17 @@ static inline uint32_t tsig_calculate_target_hz(tsig_params_t *params) {
              : 60000;
 }
 
-static inline uint8_t tsig_calculate_subharmonic(uint32_t target_hz) {
+static inline uint8_t tsig_calculate_subharmonic(uint32_t target_hz,
+                                                 uint32_t sample_rate) {
+  if (target_hz <= TSIG_WAVEFORM_DIRECT_MAX_RATIO * sample_rate)
+    return TSIG_WAVEFORM_SUBHARMONIC_DIRECT;
+
   target_hz /= TSIG_WAVEFORM_SUBHARMONIC_THIRD;
   return target_hz <= TSIG_WAVEFORM_SUBHARMONIC_THRESHOLD
              ? TSIG_WAVEFORM_SUBHARMONIC_THIRD
              : TSIG_WAVEFORM_SUBHARMONIC_FIFTH;
 }
 
-static inline uint32_t tsig_gcd(uint32_t a, uint32_t b) {
-  for (uint32_t c; b; a = b, b = c)
-    c = a % b;
-  return a;
-}
-
 static inline uint8_t tsig_even_parity(uint8_t data[], int lo, int hi) {
   uint8_t parity = 0;
   for (int i = lo; i < hi; i++)
@@ -158,8 +352,56 @@ static inline uint8_t tsig_odd_parity(uint8_t data[], int lo, int hi) {
   return !tsig_even_parity(data, lo, hi);
 }
 
+/**
+ * Append an edge to a frame.
+ *
+ * An edge at the same instant as the last one replaces it, and an edge that
+ * changes nothing is dropped, so that every edge in a frame is a change. An
+ * edge that does not fit marks the frame as overflowed.
+ *
+ * @param frame Pointer to a frame.
+ * @param us Microseconds since the start of the station minute. Must not
+ *  precede that of the last edge.
+ * @param level Transmit level from this edge on.
+ * @param phase Phase modulation flags from this edge on.
+ */
+static void tsig_frame_push(tsig_waveform_frame_t *frame, uint32_t us,
+                            uint8_t level, uint8_t phase) {
+  tsig_waveform_edge_t *edges = frame->edges;
+
+  if (frame->len && edges[frame->len - 1].us == us)
+    frame->len--;
+
+  if (frame->len) {
+    tsig_waveform_edge_t *last = &edges[frame->len - 1];
+    if (last->level == level && last->phase == phase)
+      return;
+  }
+
+  if (frame->len < TSIG_WAVEFORM_MAX_EDGES)
+    edges[frame->len++] = (tsig_waveform_edge_t){us, level, phase};
+  else
+    frame->overflowed = 1;
+}
+
+/**
+ * Append the level edges of a second that begins at one transmit level for
+ * some milliseconds, then changes to another for the rest of it.
+ * @param frame Pointer to a frame.
+ * @param sec Second of the station minute.
+ * @param level Transmit level at the start of the second.
+ * @param ms Milliseconds until the change. May be 0.
+ * @param then_level Transmit level for the rest of the second.
+ */
+static void tsig_frame_second(tsig_waveform_frame_t *frame, int sec,
+                              uint8_t level, int ms, uint8_t then_level) {
+  uint32_t us = 1000000 * sec;
+  tsig_frame_push(frame, us, level, 0);
+  tsig_frame_push(frame, us + 1000 * ms, then_level, 0);
+}
+
 static void tsig_xmit_bpc(tsig_datetime_t datetime, tsig_params_t *params,
-                          uint8_t xmit_level[]) {
+                          tsig_waveform_frame_t *frame) {
   uint8_t bits[20] = {[0] = TSIG_WAVEFORM_SYNC_MARKER};
 
   uint8_t hour_12h = datetime.hour % 12;
@@ -200,21 +442,16 @@ static void tsig_xmit_bpc(tsig_datetime_t datetime, tsig_params_t *params,
       bits[10] ^= 1;
 
     /* Marker: Low for 0 ms, 00: 100 ms, 01: 200 ms, 10: 300 ms, 11: 400 ms. */
-    for (int i = 0; i < sizeof(bits); i++) {
+    for (int i = 0; i < (int)sizeof(bits); i++, j++) {
       int lo_dsec = bits[i] == TSIG_WAVEFORM_SYNC_MARKER ? 0 : bits[i] + 1;
-      int lo = 100 * lo_dsec / TSIG_WAVEFORM_TICK_MS;
-      int hi = TSIG_WAVEFORM_TICKS_PER_SEC - lo;
-      for (; lo; j++, lo--)
-        xmit_level[j / CHAR_BIT] &= ~((1 << (j % CHAR_BIT)));
-      for (; hi; j++, hi--)
-        xmit_level[j / CHAR_BIT] |= 1 << (j % CHAR_BIT);
+      tsig_frame_second(frame, j, TSIG_WAVEFORM_LEVEL_LOW, 100 * lo_dsec,
+                        TSIG_WAVEFORM_LEVEL_HIGH);
     }
   }
 }
 
-static void tsig_xmit_dcf77(tsig_datetime_t datetime, tsig_params_t *params,
-                            uint8_t xmit_level[]) {
-  uint8_t bits[60] = {[20] = 1, [59] = TSIG_WAVEFORM_SYNC_MARKER};
+static void tsig_gen_bits_dcf77(tsig_datetime_t datetime, uint8_t bits[60]) {
+  bits[59] = TSIG_WAVEFORM_SYNC_MARKER;
 
   /* tsig_datetime_is_eu_dst() expects UTC datetime. We have CET (UTC+0100). */
   uint32_t utc_offset = TSIG_DATETIME_MSECS_HOUR;
@@ -298,58 +535,80 @@ static void tsig_xmit_dcf77(tsig_datetime_t datetime, tsig_params_t *params,
   bits[57] = year_10 & 8;
 
   bits[58] = tsig_even_parity(bits, 36, 58);
+}
+
+static void tsig_xmit_dcf77(tsig_datetime_t datetime, tsig_params_t *params,
+                            tsig_waveform_frame_t *frame) {
+  uint8_t bits[60] = {0};
+  tsig_gen_bits_dcf77(datetime, bits);
 
   /* Marker: Low for 0 ms, 0: 100 ms, 1: 200 ms. */
-  for (int i = 0, j = 0; i < sizeof(bits); i++) {
+  for (int i = 0; i < (int)sizeof(bits); i++) {
     int lo_dsec = bits[i] == TSIG_WAVEFORM_SYNC_MARKER ? 0 : !!bits[i] + 1;
-    int lo = 100 * lo_dsec / TSIG_WAVEFORM_TICK_MS;
-    int hi = TSIG_WAVEFORM_TICKS_PER_SEC - lo;
-    for (; lo; j++, lo--)
-      xmit_level[j / CHAR_BIT] &= ~((1 << (j % CHAR_BIT)));
-    for (; hi; j++, hi--)
-      xmit_level[j / CHAR_BIT] |= 1 << (j % CHAR_BIT);
+    tsig_frame_second(frame, i, TSIG_WAVEFORM_LEVEL_LOW, 100 * lo_dsec,
+                      TSIG_WAVEFORM_LEVEL_HIGH);
   }
 }
 
-static void tsig_xmit_jjy_morse_pulse(uint8_t xmit_level[], int *k, int ticks) {
-  for (int i = 0, j = *k; i < ticks; i++, j++)
-    xmit_level[j / CHAR_BIT] |= 1 << (j % CHAR_BIT);
-  *k += ticks;
+static void tsig_xmit_phase_dcf77(tsig_datetime_t datetime,
+                                  tsig_params_t *params, uint8_t xmit_phase[]) {
+  uint8_t bits[60] = {0};
+  tsig_gen_bits_dcf77(datetime, bits);
+
+  /* 1: Inverted chip sequence. The minute marker is sent as a 0. */
+  for (int i = 0; i < (int)sizeof(bits); i++) {
+    if (bits[i] && bits[i] != TSIG_WAVEFORM_SYNC_MARKER)
+      xmit_phase[i / CHAR_BIT] |= 1 << (i % CHAR_BIT);
+    else
+      xmit_phase[i / CHAR_BIT] &= ~((1 << (i % CHAR_BIT)));
+  }
 }
 
-static void tsig_xmit_jjy_morse(uint8_t xmit_level[]) {
-  int lo = TSIG_WAVEFORM_JJY_MORSE_SEC * TSIG_WAVEFORM_TICKS_PER_SEC;
-  int hi = TSIG_WAVEFORM_JJY_MORSE_END_SEC * TSIG_WAVEFORM_TICKS_PER_SEC;
-  for (int i = lo; i < hi; i++)
-    xmit_level[i / CHAR_BIT] &= ~((1 << (i % CHAR_BIT)));
+static void tsig_xmit_jjy_morse_pulse(tsig_waveform_frame_t *frame,
+                                      uint32_t *ms, int pulse_ms) {
+  tsig_frame_push(frame, 1000 * *ms, TSIG_WAVEFORM_LEVEL_HIGH, 0);
+  *ms += pulse_ms;
+  tsig_frame_push(frame, 1000 * *ms, TSIG_WAVEFORM_LEVEL_OFF, 0);
+}
+
+/*
+ * Using a public WebSDR, it was determined that if JJY is doing an
+ * announcement, it transmits its callsign in Morse code from about 40.550 to
+ * 48.250 seconds after the minute. During this time, keying is on-off and
+ * low gain is 0 instead of the usual -10 dB. Afterwards, low gain delays
+ * returning to -10 dB until the marker bit at 49 seconds.
+ */
+static void tsig_xmit_jjy_morse(tsig_waveform_frame_t *frame) {
+  uint32_t ms = 1000 * TSIG_WAVEFORM_JJY_MORSE_SEC;
+  tsig_frame_push(frame, 1000 * ms, TSIG_WAVEFORM_LEVEL_LOW, 0);
 
-  int k = TSIG_WAVEFORM_JJY_MORSE_TICK;
+  ms += TSIG_WAVEFORM_JJY_MORSE_MS;
   for (int i = 0; i < 2; i++) {
     /* JJ, i.e. .--- .--- */
     for (int j = 0; j < 2; j++) {
-      tsig_xmit_jjy_morse_pulse(xmit_level, &k, TSIG_WAVEFORM_TICKS_PER_DIT);
-      k += TSIG_WAVEFORM_TICKS_PER_IEG;
-      tsig_xmit_jjy_morse_pulse(xmit_level, &k, TSIG_WAVEFORM_TICKS_PER_DAH);
-      k += TSIG_WAVEFORM_TICKS_PER_IEG;
-      tsig_xmit_jjy_morse_pulse(xmit_level, &k, TSIG_WAVEFORM_TICKS_PER_DAH);
-      k += TSIG_WAVEFORM_TICKS_PER_IEG;
-      tsig_xmit_jjy_morse_pulse(xmit_level, &k, TSIG_WAVEFORM_TICKS_PER_DAH);
-      k += TSIG_WAVEFORM_TICKS_PER_ICG;
+      tsig_xmit_jjy_morse_pulse(frame, &ms, TSIG_WAVEFORM_MORSE_DIT_MS);
+      ms += TSIG_WAVEFORM_MORSE_IEG_MS;
+      tsig_xmit_jjy_morse_pulse(frame, &ms, TSIG_WAVEFORM_MORSE_DAH_MS);
+      ms += TSIG_WAVEFORM_MORSE_IEG_MS;
+      tsig_xmit_jjy_morse_pulse(frame, &ms, TSIG_WAVEFORM_MORSE_DAH_MS);
+      ms += TSIG_WAVEFORM_MORSE_IEG_MS;
+      tsig_xmit_jjy_morse_pulse(frame, &ms, TSIG_WAVEFORM_MORSE_DAH_MS);
+      ms += TSIG_WAVEFORM_MORSE_ICG_MS;
     }
     /* Y, i.e. -.-- */
-    tsig_xmit_jjy_morse_pulse(xmit_level, &k, TSIG_WAVEFORM_TICKS_PER_DAH);
-    k += TSIG_WAVEFORM_TICKS_PER_IEG;
-    tsig_xmit_jjy_morse_pulse(xmit_level, &k, TSIG_WAVEFORM_TICKS_PER_DIT);
-    k += TSIG_WAVEFORM_TICKS_PER_IEG;
-    tsig_xmit_jjy_morse_pulse(xmit_level, &k, TSIG_WAVEFORM_TICKS_PER_DAH);
-    k += TSIG_WAVEFORM_TICKS_PER_IEG;
-    tsig_xmit_jjy_morse_pulse(xmit_level, &k, TSIG_WAVEFORM_TICKS_PER_DAH);
-    k += TSIG_WAVEFORM_TICKS_PER_IWG;
+    tsig_xmit_jjy_morse_pulse(frame, &ms, TSIG_WAVEFORM_MORSE_DAH_MS);
+    ms += TSIG_WAVEFORM_MORSE_IEG_MS;
+    tsig_xmit_jjy_morse_pulse(frame, &ms, TSIG_WAVEFORM_MORSE_DIT_MS);
+    ms += TSIG_WAVEFORM_MORSE_IEG_MS;
+    tsig_xmit_jjy_morse_pulse(frame, &ms, TSIG_WAVEFORM_MORSE_DAH_MS);
+    ms += TSIG_WAVEFORM_MORSE_IEG_MS;
+    tsig_xmit_jjy_morse_pulse(frame, &ms, TSIG_WAVEFORM_MORSE_DAH_MS);
+    ms += TSIG_WAVEFORM_MORSE_IWG_MS;
   }
 }
 
 static void tsig_xmit_jjy(tsig_datetime_t datetime, tsig_params_t *params,
-                          uint8_t xmit_level[]) {
+                          tsig_waveform_frame_t *frame) {
   uint8_t bits[60] = {
       [0] = TSIG_WAVEFORM_SYNC_MARKER,  [9] = TSIG_WAVEFORM_SYNC_MARKER,
       [19] = TSIG_WAVEFORM_SYNC_MARKER, [29] = TSIG_WAVEFORM_SYNC_MARKER,
@@ -418,26 +677,21 @@ static void tsig_xmit_jjy(tsig_datetime_t datetime, tsig_params_t *params,
     bits[52] = dow & 1;
   }
 
-  /* Marker: Low for 200 ms, 0: 800 ms, 1: 500 ms. */
-  for (int i = 0, j = 0; i < sizeof(bits); i++) {
+  /* Marker: High for 200 ms, 0: 800 ms, 1: 500 ms. */
+  for (int i = 0; i < (int)sizeof(bits); i++) {
     if (is_announce && i == TSIG_WAVEFORM_JJY_MORSE_SEC) {
-      tsig_xmit_jjy_morse(xmit_level);
+      tsig_xmit_jjy_morse(frame);
       i = TSIG_WAVEFORM_JJY_MORSE_END_SEC;
-      j = TSIG_WAVEFORM_JJY_MORSE_END_TICK;
     }
 
     int hi_dsec = bits[i] == TSIG_WAVEFORM_SYNC_MARKER ? 2 : bits[i] ? 5 : 8;
-    int hi = 100 * hi_dsec / TSIG_WAVEFORM_TICK_MS;
-    int lo = TSIG_WAVEFORM_TICKS_PER_SEC - hi;
-    for (; hi; j++, hi--)
-      xmit_level[j / CHAR_BIT] |= 1 << (j % CHAR_BIT);
-    for (; lo; j++, lo--)
-      xmit_level[j / CHAR_BIT] &= ~((1 << (j % CHAR_BIT)));
+    tsig_frame_second(frame, i, TSIG_WAVEFORM_LEVEL_HIGH, 100 * hi_dsec,
+                      TSIG_WAVEFORM_LEVEL_LOW);
   }
 }
 
 static void tsig_xmit_msf(tsig_datetime_t datetime, tsig_params_t *params,
-                          uint8_t xmit_level[]) {
+                          tsig_waveform_frame_t *frame) {
   uint8_t bits[60] = {[0] = TSIG_WAVEFORM_SYNC_MARKER};
 
   int8_t dut1 = params->dut1 / 100;
@@ -531,20 +785,16 @@ static void tsig_xmit_msf(tsig_datetime_t datetime, tsig_params_t *params,
    * Marker: Low for 500 ms, 00: 100 ms, 01: 200 ms, 11: 300 ms.
    * Note that 11 can only occur during the secondary minute marker.
    */
-  for (int i = 0, j = 0; i < sizeof(bits); i++) {
+  for (int i = 0; i < (int)sizeof(bits); i++) {
     int dsec_lo = bits[i] == TSIG_WAVEFORM_SYNC_MARKER ? 5 : !!bits[i] + 1;
     dsec_lo += 53 <= i && i <= 58; /* Secondary 01111110 minute marker. */
-    int lo = 100 * dsec_lo / TSIG_WAVEFORM_TICK_MS;
-    int hi = TSIG_WAVEFORM_TICKS_PER_SEC - lo;
-    for (; lo; j++, lo--)
-      xmit_level[j / CHAR_BIT] &= ~((1 << (j % CHAR_BIT)));
-    for (; hi; j++, hi--)
-      xmit_level[j / CHAR_BIT] |= 1 << (j % CHAR_BIT);
+    tsig_frame_second(frame, i, TSIG_WAVEFORM_LEVEL_LOW, 100 * dsec_lo,
+                      TSIG_WAVEFORM_LEVEL_HIGH);
   }
 }
 
 static void tsig_xmit_wwvb(tsig_datetime_t datetime, tsig_params_t *params,
-                           uint8_t xmit_level[]) {
+                           tsig_waveform_frame_t *frame) {
   uint8_t bits[60] = {
       [0] = TSIG_WAVEFORM_SYNC_MARKER,  [9] = TSIG_WAVEFORM_SYNC_MARKER,
       [19] = TSIG_WAVEFORM_SYNC_MARKER, [29] = TSIG_WAVEFORM_SYNC_MARKER,
@@ -617,171 +867,972 @@ static void tsig_xmit_wwvb(tsig_datetime_t datetime, tsig_params_t *params,
   bits[58] = tsig_datetime_is_us_dst(datetime, &bits[57]);
 
   /* Marker: Low for 800 ms, 0: 200 ms, 1: 500 ms. */
-  for (int i = 0, j = 0; i < sizeof(bits); i++) {
+  for (int i = 0; i < (int)sizeof(bits); i++) {
     int dsec_lo = bits[i] == TSIG_WAVEFORM_SYNC_MARKER ? 8 : bits[i] ? 5 : 2;
-    int lo = 100 * dsec_lo / TSIG_WAVEFORM_TICK_MS;
-    int hi = TSIG_WAVEFORM_TICKS_PER_SEC - lo;
-    for (; lo; j++, lo--)
-      xmit_level[j / CHAR_BIT] &= ~((1 << (j % CHAR_BIT)));
-    for (; hi; j++, hi--)
-      xmit_level[j / CHAR_BIT] |= 1 << (j % CHAR_BIT);
+    tsig_frame_second(frame, i, TSIG_WAVEFORM_LEVEL_LOW, 100 * dsec_lo,
+                      TSIG_WAVEFORM_LEVEL_HIGH);
   }
 }
 
-static inline float tsig_gen_next_sample(tsig_waveform_ctx_t *ctx) {
+/* Rows of the Hamming parity check over the 26-bit WWVB time word. */
+static const uint32_t TSIG_WAVEFORM_WWVB_PARITY[] = {
+    0x0b3e375, 0x167c6ea, 0x2cf8dd4, 0x12cf8dd, 0x259f1ba,
+};
+
+/* DST and leap second warning codes, indexed by AM code bits 57 and 58. */
+static const uint8_t TSIG_WAVEFORM_WWVB_DST_LS[] = {0x08, 0x15, 0x16, 0x03};
+
+static void tsig_xmit_phase_wwvb(tsig_datetime_t datetime,
+                                 tsig_params_t *params, uint8_t xmit_phase[]) {
+  uint8_t bits[60] = {[39] = 1, [49] = 1};
+
+  for (int i = 0; i < 13; i++)
+    bits[i] = (TSIG_WAVEFORM_WWVB_SYNC_T >> (12 - i)) & 1;
+
+  double since_epoch = datetime.timestamp - TSIG_WAVEFORM_WWVB_EPOCH;
+  uint32_t moc = floor(since_epoch / TSIG_DATETIME_MSECS_MIN);
+
+  for (int i = 0; i < 5; i++)
+    bits[17 - i] = __builtin_parity(moc & TSIG_WAVEFORM_WWVB_PARITY[i]);
+
+  bits[18] = (moc >> 25) & 1;
+  bits[19] = moc & 1;
+  for (int i = 0; i < 9; i++)
+    bits[20 + i] = (moc >> (24 - i)) & 1;
+  for (int i = 0; i < 9; i++)
+    bits[30 + i] = (moc >> (15 - i)) & 1;
+  for (int i = 0; i < 7; i++)
+    bits[40 + i] = (moc >> (6 - i)) & 1;
+
+  /* Leap second warnings aren't sent by the amplitude code either. */
+  uint8_t is_dst_end;
+  uint8_t is_dst = tsig_datetime_is_us_dst(datetime, &is_dst_end);
+  uint8_t dst_ls = TSIG_WAVEFORM_WWVB_DST_LS[(is_dst_end << 1) | is_dst];
+  bits[47] = (dst_ls >> 4) & 1;
+  bits[48] = (dst_ls >> 3) & 1;
+  bits[50] = (dst_ls >> 2) & 1;
+  bits[51] = (dst_ls >> 1) & 1;
+  bits[52] = dst_ls & 1;
+
+  /*
+   * The next DST change is only a hint for receivers that keep local time
+   * through it. We don't forecast it and always send the same code.
+   */
+  for (int i = 0; i < 6; i++)
+    bits[53 + i] = (TSIG_WAVEFORM_WWVB_DST_NEXT >> (5 - i)) & 1;
+
+  /* 1: Inverted for the whole second. */
+  for (int i = 0; i < (int)sizeof(bits); i++) {
+    if (bits[i])
+      xmit_phase[i / CHAR_BIT] |= 1 << (i % CHAR_BIT);
+    else
+      xmit_phase[i / CHAR_BIT] &= ~((1 << (i % CHAR_BIT)));
+  }
+}
+
+/**
+ * Find a phase modulation event of a station minute.
+ *
+ * Phase modulation changes at the start of every second, and for spreading
+ * stations also when the chips begin, i.e. two events per second.
+ *
+ * @param xmit_phase Bitfield of per-second phase inversion flags.
+ * @param is_spread Whether the station spreads its carrier with phase chips.
+ * @param i Index of the event.
+ * @param[out] out_phase Out pointer to phase modulation flags from then on.
+ * @return Microseconds since the start of the station minute.
+ */
+static uint32_t tsig_frame_phase_event(uint8_t xmit_phase[], uint8_t is_spread,
+                                       int i, uint8_t *out_phase) {
+  int sec = is_spread ? i / 2 : i;
+  uint8_t is_chips = is_spread && i % 2;
+
+  *out_phase = (xmit_phase[sec / CHAR_BIT] >> (sec % CHAR_BIT)) & 1;
+  if (is_chips)
+    *out_phase |= TSIG_WAVEFORM_PHASE_SPREAD;
+
+  return 1000000 * sec + is_chips * 1000 * TSIG_WAVEFORM_DCF77_CHIP_MS;
+}
+
+/**
+ * Generate the frame of a station minute.
+ *
+ * Level edges are generated first. Phase modulation events, if any, are then
+ * merged into them in place from the back, where there is always room, and
+ * edges that change nothing are finally dropped. Should the merged frame not
+ * fit, it keeps its first TSIG_WAVEFORM_MAX_EDGES instants and is marked as
+ * overflowed.
+ *
+ * @param frame Pointer to the frame to be generated.
+ * @param datetime Start of the station minute.
+ * @param params Pointer to a struct containing user parameters.
+ */
+static void tsig_waveform_gen_frame(tsig_waveform_frame_t *frame,
+                                    tsig_datetime_t datetime,
+                                    tsig_params_t *params) {
+  waveform_station_data_t *data = &TSIG_WAVEFORM_STATION_DATA[params->station];
+  tsig_waveform_edge_t *edges = frame->edges;
+
+  frame->len = 0;
+  frame->overflowed = 0;
+  data->gen_xmit(datetime, params, frame);
+  if (!data->gen_phase)
+    return;
+
+  uint8_t xmit_phase[(60 + CHAR_BIT - 1) / CHAR_BIT];
+  uint8_t is_spread = !!data->chip_cycles, phase;
+  int n_events = is_spread ? 120 : 60;
+  data->gen_phase(datetime, params, xmit_phase);
+
+  /*
+   * Count distinct instants, which is the length of the merged frame, and
+   * how many level edges and events those that fit take.
+   */
+  int len = 0, n_edges = 0, n_taken = 0;
+  for (int i = 0, j = 0; i < frame->len || j < n_events; len++) {
+    if (len == TSIG_WAVEFORM_MAX_EDGES) {
+      frame->overflowed = 1;
+      break;
+    }
+
+    uint32_t event_us = j < n_events
+                            ? tsig_frame_phase_event(xmit_phase, is_spread, j,
+                                                     &phase)
+                            : UINT32_MAX;
+    uint32_t us = i < frame->len ? edges[i].us : UINT32_MAX;
+    i += us <= event_us;
+    j += event_us <= us;
+    n_edges = i;
+    n_taken = j;
+  }
+
+  /* Each instant takes the latest level and phase at or before it. */
+  for (int i = n_edges - 1, j = n_taken - 1, k = len - 1; k >= 0; k--) {
+    uint32_t event_us =
+        tsig_frame_phase_event(xmit_phase, is_spread, j, &phase);
+    uint32_t us = edges[i].us;
+    uint8_t level = edges[i].level;
+
+    /* Never overwrites an unread level edge, as k >= i. */
+    edges[k] = (tsig_waveform_edge_t){tsig_max(us, event_us), level, phase};
+    if (us >= event_us)
+      i--;
+    if (event_us >= us)
+      j--;
+  }
+
+  /* Drop edges that change nothing. */
+  frame->len = 0;
+  for (int k = 0; k < len; k++)
+    tsig_frame_push(frame, edges[k].us, edges[k].level, edges[k].phase);
+}
+
+/**
+ * Find the edge in effect at an instant of a station minute.
+ * @param frame Pointer to the frame of the station minute.
+ * @param us Microseconds since the start of the station minute.
+ * @return Index of the last edge at or before `us`.
+ */
+static int tsig_waveform_find_edge(tsig_waveform_frame_t *frame, uint32_t us) {
+  int lo = 0, hi = frame->len;
+
+  while (hi - lo > 1) {
+    int mid = (lo + hi) / 2;
+    if (frame->edges[mid].us <= us)
+      lo = mid;
+    else
+      hi = mid;
+  }
+
+  return lo;
+}
+
+/** Fill the sine table. */
+static void tsig_init_sine() {
+  for (int i = 0; i <= TSIG_WAVEFORM_SINE_TABLE_LEN; i++)
+    TSIG_WAVEFORM_SINE_TABLE[i] =
+        sin(TSIG_WAVEFORM_2PI * i / TSIG_WAVEFORM_SINE_TABLE_LEN);
+}
+
+/** Fill the lerp table. */
+static void tsig_init_lerp() {
+  for (int i = 0; i <= TSIG_WAVEFORM_LERP_STEPS; i++)
+    TSIG_WAVEFORM_LERP_TABLE[i] = pow(1.0 - TSIG_WAVEFORM_LERP_RATE, i);
+}
+
+/**
+ * Find the length of a fade.
+ * @param sample_rate Sample rate.
+ * @return Count of samples in a fade, no longer than the fade table.
+ */
+static inline uint32_t tsig_fade_steps(uint32_t sample_rate) {
+  return tsig_min((uint64_t)sample_rate * TSIG_FADE_MS / 1000,
+                  TSIG_WAVEFORM_FADE_STEPS);
+}
+
+/**
+ * Fill the fade table for a sample rate.
+ * @param sample_rate Sample rate.
+ */
+static void tsig_init_fade(uint32_t sample_rate) {
+  uint32_t steps = tsig_fade_steps(sample_rate);
+
+  for (uint32_t i = 0; i <= steps; i++)
+    TSIG_WAVEFORM_FADE_TABLE[i] = (double)i * i / ((double)steps * steps);
+}
+
+/**
+ * Fill the DCF77 chip table.
+ * @note The shift register starts with all stages set.
+ */
+static void tsig_init_chips_dcf77() {
+  int8_t *table = TSIG_WAVEFORM_DCF77_CHIP_TABLE;
+  uint16_t mask = (1 << TSIG_WAVEFORM_DCF77_LFSR_STAGES) - 1;
+  uint16_t lfsr = mask;
+
+  for (int i = 0; i < TSIG_WAVEFORM_DCF77_CHIPS - 1; i++) {
+    uint8_t chip = (lfsr >> (TSIG_WAVEFORM_DCF77_LFSR_STAGES - 1)) & 1;
+    uint8_t tap = (lfsr >> (TSIG_WAVEFORM_DCF77_LFSR_TAP - 1)) & 1;
+    lfsr = ((lfsr << 1) | (chip ^ tap)) & mask;
+    table[i] = chip ? -1 : 1;
+  }
+  table[TSIG_WAVEFORM_DCF77_CHIPS - 1] = 1;
+
+  for (int i = TSIG_WAVEFORM_DCF77_CHIPS; i < TSIG_WAVEFORM_CHIP_TABLE_LEN; i++)
+    table[i] = 0;
+}
+
+/**
+ * Fill the tables that rendering reads, unless already filled.
+ * @param sample_rate Sample rate.
+ * @note Main thread only, before anything renders. The tables are shared with
+ *  whatever renders and are not synchronized, so they are never rewritten,
+ *  but for the fade table if the sample rate changes, which an AudioContext's
+ *  never does.
+ */
+static void tsig_waveform_init_tables(uint32_t sample_rate) {
+  static uint8_t is_filled = 0;
+  static uint32_t fade_rate = 0;
+
+  if (!is_filled) {
+    tsig_init_sine();
+    tsig_init_lerp();
+    tsig_init_chips_dcf77();
+    is_filled = 1;
+  }
+
+  if (fade_rate != sample_rate) {
+    tsig_init_fade(sample_rate);
+    fade_rate = sample_rate;
+  }
+}
+
+static inline float tsig_gen_sample(tsig_waveform_ctx_t *ctx, uint64_t phase,
+                                    uint64_t chip_phase, float gain) {
   /*
    * JS wants 32-bit floats, but pure floats may not work. Simulate integer
    * quantization by scaling by some integer factor, flooring, and dividing
    * back to float. Apparently, some devices won't pick up the fundamental we
    * hope we're creating when we play back a subharmonic otherwise. The "best"
-   * scale factor varies, but the AudioContext's sample rate divided by the
-   * number of the subharmonic we're using should work.
+   * scale factor varies, so it is measured (see tsig_waveform_choose_synth).
    * cf. https://jjy.luxferre.top/
+   *
+   * Phase modulation is added at the subharmonic. Half a cycle of it is an
+   * odd number of half cycles of the odd harmonic we hope gets picked up, so
+   * that is inverted too. Chip deviations are likewise scaled down by the
+   * subharmonic number, so they come out right at the harmonic. All of this
+   * trivially holds when the target is synthesized directly, too.
    */
-  double angle = TSIG_WAVEFORM_2PI * ctx->phase / ctx->phase_base;
-  int lpcm_sample = sin(angle) * ctx->gain * ctx->scale;
+  int chip = chip_phase >> (64 - TSIG_WAVEFORM_CHIP_TABLE_BITS);
+  uint64_t chip_shift = TSIG_WAVEFORM_DCF77_CHIP_TABLE[chip] * ctx->chip_step;
+  phase += ctx->phase_shift + chip_shift;
+
+  uint32_t i = phase >> (64 - TSIG_WAVEFORM_SINE_BITS);
+  uint32_t frac = (phase << TSIG_WAVEFORM_SINE_BITS) >>
+                  (64 - TSIG_WAVEFORM_SINE_FRAC_BITS);
+  float lo = TSIG_WAVEFORM_SINE_TABLE[i];
+  float hi = TSIG_WAVEFORM_SINE_TABLE[i + 1];
+  float sine = lo + (hi - lo) * frac / (1 << TSIG_WAVEFORM_SINE_FRAC_BITS);
+
+  int lpcm_sample = sine * gain * ctx->scale;
   return (float)lpcm_sample / ctx->scale;
 }
 
-static inline float tsig_lerp(float target_gain, float gain) {
-  return fabsf(target_gain - gain) > TSIG_WAVEFORM_LERP_MIN_DELTA
-             ? (1.0F - TSIG_WAVEFORM_LERP_RATE) * gain +
-                   TSIG_WAVEFORM_LERP_RATE * target_gain
-             : target_gain;
+static inline float tsig_gen_next_sample(tsig_waveform_ctx_t *ctx) {
+  return tsig_gen_sample(ctx, ctx->phase, ctx->chip_phase, ctx->gain);
 }
 
 /**
- * Generate audio samples for an emulated time station waveform.
+ * Generate a span of samples during which nothing but phase changes.
  *
- * `TSIG_RENDER_QUANTUM` samples are generated of an emulated waveform similar
- * to that transmitted by a real time station and written to the provided
- * audio output buffers.
+ * The accumulators are kept in locals, so that the loop does nothing more
+ * per sample than the sine lookup itself.
  *
  * @param ctx Pointer to a waveform context.
- * @param params Pointer to a struct containing user parameters.
- * @param state Current time signal generator module state.
- * @param[out] out_next_state Out pointer to the time signal generator module
- *  state at the end of this render quantum.
- * @param n_outputs Count of audio output buffers.
- * @param outputs Array of audio output buffers provided to an audio worklet
- *  processor callback function by the Emscripten Audio Worklets API.
+ * @param[out] out Buffer to receive the samples.
+ * @param n Count of samples to generate. Must not pass the next edge.
  */
-void tsig_waveform_generate(tsig_waveform_ctx_t *ctx, tsig_params_t *params,
-                            int state, int *out_next_state, int n_outputs,
-                            AudioSampleFrame *outputs) {
-  waveform_station_data_t *data = &TSIG_WAVEFORM_STATION_DATA[params->station];
-  float xmit_low = data->xmit_low;
+static void tsig_gen_span(tsig_waveform_ctx_t *ctx, float *out, int n) {
+  uint64_t phase = ctx->phase;
+  uint64_t chip_phase = ctx->chip_phase;
+  uint64_t phase_delta = ctx->phase_delta;
+  uint64_t chip_delta = ctx->chip_delta;
+  float gain = ctx->gain;
+
+  for (int i = 0; i < n; i++) {
+    out[i] = tsig_gen_sample(ctx, phase, chip_phase, gain);
+    phase += phase_delta;
+    chip_phase += chip_delta;
+  }
 
-  for (int i = 0; i < TSIG_RENDER_QUANTUM; i++) {
-    /* Update state for the current tick. */
-    if (ctx->samples == ctx->next_tick) {
-      double adj_timestamp = 1000.0 * ctx->samples / ctx->sample_rate +
-                             ctx->timestamp + params->offset;
-      tsig_datetime_t adj_datetime =
-          tsig_datetime_parse_timestamp(adj_timestamp);
+  ctx->phase = phase;
+  ctx->chip_phase = chip_phase;
+  ctx->samples += n;
+}
 
-      uint32_t msec_since_min = 1000 * adj_datetime.sec + adj_datetime.msec;
-      ctx->tick = msec_since_min / TSIG_WAVEFORM_TICK_MS;
-      ;
+/**
+ * Advance an interpolated gain change.
+ * @param ctx Pointer to a waveform context.
+ * @param n Count of samples generated. Must not pass the end of the change.
+ */
+static inline void tsig_ramp_advance(tsig_waveform_ctx_t *ctx, int n) {
+  ctx->ramp_pos += n;
+  ctx->gain = ctx->ramp_pos < ctx->ramp_len
+                  ? ctx->ramp_target +
+                        ctx->ramp_delta *
+                            TSIG_WAVEFORM_LERP_TABLE[ctx->ramp_pos]
+                  : ctx->ramp_target;
+}
 
-      if (!ctx->samples || !ctx->tick)
-        data->gen_xmit(adj_datetime, params, ctx->xmit_level);
+/**
+ * Generate a span of samples during an interpolated gain change.
+ * @param ctx Pointer to a waveform context.
+ * @param[out] out Buffer to receive the samples.
+ * @param n Count of samples to generate. Must not pass the next edge or the
+ *  end of the change.
+ */
+static void tsig_gen_ramp(tsig_waveform_ctx_t *ctx, float *out, int n) {
+  const float *decay = &TSIG_WAVEFORM_LERP_TABLE[ctx->ramp_pos + 1];
+  uint64_t phase = ctx->phase;
+  uint64_t chip_phase = ctx->chip_phase;
+  uint64_t phase_delta = ctx->phase_delta;
+  uint64_t chip_delta = ctx->chip_delta;
+  float target = ctx->ramp_target;
+  float delta = ctx->ramp_delta;
+
+  for (int i = 0; i < n; i++) {
+    out[i] = tsig_gen_sample(ctx, phase, chip_phase, target + delta * decay[i]);
+    phase += phase_delta;
+    chip_phase += chip_delta;
+  }
 
-      uint32_t msec_since_tick = adj_datetime.msec % TSIG_WAVEFORM_TICK_MS;
-      uint32_t msec_to_tick = TSIG_WAVEFORM_TICK_MS - msec_since_tick;
-      ctx->next_tick += msec_to_tick * ctx->sample_rate / 1000;
+  ctx->phase = phase;
+  ctx->chip_phase = chip_phase;
+  ctx->samples += n;
+  tsig_ramp_advance(ctx, n);
+}
 
-      /*
-       * Per DCF77's signal format specification, each minute and each transmit
-       * power change occurs at a rising zero crossing. We don't have enough
-       * control over what actually gets transmitted to reliably emulate this,
-       * and it's almost certainly not necessary for our purposes. Still,
-       * there's no particular reason not to try, so adjust the initial phase
-       * of the waveform such that the beginning of the next minute occurs at
-       * such a crossing. The phase change shouldn't matter for other stations.
-       */
-      if (!ctx->samples) {
-        uint32_t msec_to_min = TSIG_DATETIME_MSECS_MIN - msec_since_min;
-        uint32_t to_min = msec_to_min * ctx->sample_rate / 1000;
-        uint32_t phase_to_min = (to_min * ctx->phase_delta) % ctx->phase_base;
-        if (phase_to_min)
-          ctx->phase = ctx->phase_base - phase_to_min;
+/**
+ * Generate a span of samples during a fade, and any interpolated gain change.
+ * @param ctx Pointer to a waveform context.
+ * @param[out] out Buffer to receive the samples.
+ * @param n Count of samples to generate. Must not pass the next edge, the
+ *  end of the change, or the end of the fade.
+ * @param step 1 to fade in, -1 to fade out, or 0 to hold the fade gain.
+ */
+static void tsig_gen_fade(tsig_waveform_ctx_t *ctx, float *out, int n,
+                          int step) {
+  uint8_t is_ramp = ctx->ramp_pos < ctx->ramp_len;
+  const float *decay =
+      &TSIG_WAVEFORM_LERP_TABLE[is_ramp ? ctx->ramp_pos + 1 : 0];
+  const float *fade = &TSIG_WAVEFORM_FADE_TABLE[ctx->fade_gain];
+  uint64_t phase = ctx->phase;
+  uint64_t chip_phase = ctx->chip_phase;
+  uint64_t phase_delta = ctx->phase_delta;
+  uint64_t chip_delta = ctx->chip_delta;
+  float target = ctx->ramp_target;
+  float delta = is_ramp ? ctx->ramp_delta : 0.0F;
+
+  for (int i = 0; i < n; i++) {
+    float gain = (target + delta * decay[i]) * fade[step * i];
+    out[i] = tsig_gen_sample(ctx, phase, chip_phase, gain);
+    phase += phase_delta;
+    chip_phase += chip_delta;
+  }
+
+  ctx->phase = phase;
+  ctx->chip_phase = chip_phase;
+  ctx->samples += n;
+  ctx->fade_gain += step * n;
+  if (is_ramp)
+    tsig_ramp_advance(ctx, n);
+}
+
+/**
+ * Begin an interpolated gain change.
+ *
+ * Each sample, the gain moves `TSIG_WAVEFORM_LERP_RATE` of the way to its
+ * target, until within `TSIG_WAVEFORM_LERP_MIN_DELTA` of it, when it snaps.
+ * That curve is the lerp table, so no sample computes it.
+ *
+ * @param ctx Pointer to a waveform context.
+ * @param params Pointer to user parameters.
+ * @param target_gain Gain to change to.
+ */
+static void tsig_waveform_ramp(tsig_waveform_ctx_t *ctx, tsig_params_t *params,
+                               float target_gain) {
+  float delta = fabsf(ctx->gain - target_gain);
+  int lo = 0, hi = TSIG_WAVEFORM_LERP_STEPS;
+
+  /* Find the first sample at which the change is within the minimum delta. */
+  if (!params->noclip)
+    hi = 0;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (delta * TSIG_WAVEFORM_LERP_TABLE[mid] > TSIG_WAVEFORM_LERP_MIN_DELTA)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  ctx->ramp_target = target_gain;
+  ctx->ramp_delta = ctx->gain - target_gain;
+  ctx->ramp_pos = 0;
+  ctx->ramp_len = lo;
+  if (!lo)
+    ctx->gain = target_gain;
+}
+
+/**
+ * Measure the amplitude at the target frequency of a candidate synthesis.
+ * @param sample_rate Sample rate.
+ * @param target_hz Frequency to be picked up.
+ * @param subharmonic Subharmonic number, or 1 if direct.
+ * @param scale Scale factor for emulated quantization.
+ * @param gain Gain in [0.0F-1.0F].
+ * @return Amplitude at the target's alias, where a full-scale sine is 1.
+ * @note The sine table must already be filled.
+ */
+static double tsig_waveform_measure(uint32_t sample_rate, uint32_t target_hz,
+                                    uint8_t subharmonic, int scale,
+                                    float gain) {
+  tsig_waveform_ctx_t ctx = {.scale = scale};
+  double cycles = (double)target_hz / subharmonic / sample_rate;
+  uint64_t phase_delta = cycles * TSIG_WAVEFORM_CYCLE;
+  uint64_t phase = 0;
+
+  for (int i = 0; i < TSIG_WAVEFORM_SYNTH_ANALYSIS_LEN; i++) {
+    TSIG_WAVEFORM_SYNTH_BUF[i] = tsig_gen_sample(&ctx, phase, 0, gain);
+    phase += phase_delta;
+  }
+
+  return tsig_analyzer_goertzel(TSIG_WAVEFORM_SYNTH_BUF,
+                                TSIG_WAVEFORM_SYNTH_ANALYSIS_LEN, target_hz,
+                                sample_rate);
+}
+
+/**
+ * Choose the subharmonic and quantization scale for a sample rate and station
+ * that put the most energy on the target frequency.
+ *
+ * Measuring a choice can take longer than a render quantum, so it is only
+ * ever done in the main thread, which hands a copy of the choice to whatever
+ * renders, and it is cached, so it only happens the first time a station is
+ * loaded at a sample rate. The tables that rendering reads are filled first,
+ * if need be, as measuring reads the sine table too.
+ *
+ * @param params Pointer to user parameters.
+ * @param sample_rate Sample rate.
+ * @return Pointer to the chosen synthesis, valid until the next call.
+ * @note Neither the cache nor the buffer it measures in is synchronized.
+ */
+static inline tsig_waveform_synth_t *
+tsig_waveform_choose_synth(tsig_params_t *params, uint32_t sample_rate) {
+  float xmit_low = TSIG_WAVEFORM_STATION_DATA[params->station].xmit_low;
+  uint32_t target_hz = tsig_calculate_target_hz(params);
+  double target_alias = tsig_analyzer_alias(target_hz, sample_rate);
+  double margin = (double)sample_rate / TSIG_WAVEFORM_SYNTH_ANALYSIS_LEN * 4;
+  int n_scales = sizeof(TSIG_WAVEFORM_SYNTH_SCALES) / sizeof(int);
+  int n_cached = tsig_waveform_synth_cached;
+  double best_err_db = INFINITY;
+  tsig_waveform_synth_t *synth;
+
+  if (n_cached > TSIG_WAVEFORM_SYNTH_CACHE_LEN)
+    n_cached = TSIG_WAVEFORM_SYNTH_CACHE_LEN;
+  for (int i = 0; i < n_cached; i++) {
+    synth = &TSIG_WAVEFORM_SYNTH_CACHE[i];
+    if (synth->sample_rate == sample_rate && synth->target_hz == target_hz &&
+        synth->station == params->station)
+      return synth;
+  }
+
+  synth = &TSIG_WAVEFORM_SYNTH_CACHE[tsig_waveform_synth_cached++ %
+                                     TSIG_WAVEFORM_SYNTH_CACHE_LEN];
+  synth->sample_rate = sample_rate;
+  synth->target_hz = target_hz;
+  synth->station = params->station;
+  synth->subharmonic = tsig_calculate_subharmonic(target_hz, sample_rate);
+  synth->scale = sample_rate / synth->subharmonic;
+
+  tsig_waveform_init_tables(sample_rate);
+  synth->level = tsig_waveform_measure(sample_rate, target_hz,
+                                       synth->subharmonic, synth->scale, 1.0F);
+
+  for (int sub = TSIG_WAVEFORM_SUBHARMONIC_DIRECT;
+       sub <= TSIG_WAVEFORM_SYNTH_MAX_SUBHARMONIC; sub += 2) {
+    double sub_hz = (double)target_hz / sub;
+    int aliased = 0;
+
+    if (sub == TSIG_WAVEFORM_SUBHARMONIC_DIRECT
+            ? target_hz > TSIG_WAVEFORM_DIRECT_MAX_RATIO * sample_rate
+            : sub_hz > TSIG_WAVEFORM_SUBHARMONIC_THRESHOLD ||
+                  2 * sub_hz >= sample_rate)
+      continue;
+
+    /* Each minute must still begin at a rising zero crossing. */
+    if ((uint64_t)target_hz * 60 % sub)
+      continue;
+
+    /*
+     * If a lower harmonic (or the subharmonic itself) aliases onto the
+     * target, its image swamps the harmonic we want. Neither the sample clock
+     * correction nor the phase modulation would come out right at the target.
+     */
+    for (int k = 1; k < sub; k += 2)
+      if (fabs(tsig_analyzer_alias(k * sub_hz, sample_rate) - target_alias) <
+          margin)
+        aliased = 1;
+    if (aliased)
+      continue;
+
+    for (int i = 0; i <= n_scales; i++) {
+      int scale = i < n_scales ? TSIG_WAVEFORM_SYNTH_SCALES[i]
+                               : (int)(sample_rate / sub);
+      double level =
+          tsig_waveform_measure(sample_rate, target_hz, sub, scale, 1.0F);
+      double err_db = 0.0;
+
+      if (!(level > TSIG_WAVEFORM_SYNTH_FLOOR))
+        continue;
+
+      if (xmit_low > 0.0F) {
+        double low = tsig_waveform_measure(sample_rate, target_hz, sub, scale,
+                                           xmit_low);
+        err_db = low > 0.0 ? fabs(20.0 * log10(low / level / xmit_low))
+                           : INFINITY;
       }
 
       /*
-       * Using a public WebSDR, it was determined that if JJY is doing an
-       * announcement, it transmits its callsign in Morse code from about
-       * 40.550 to 48.250 seconds after the minute. During this time, keying is
-       * on-off and low gain is 0 instead of the usual -10 dB. Afterwards, low
-       * gain delays returning to -10 dB until the marker bit at 49 seconds.
+       * Within tolerance of the low level, the most energy wins, or the finer
+       * scale if nearly tied. Otherwise, the least distortion of it wins, or
+       * the most energy if nearly tied.
        */
-      if (params->station == TSIG_STATION_JJY && !ctx->morse_end) {
-        uint8_t min = adj_datetime.min;
-        uint8_t is_announce = min == TSIG_WAVEFORM_JJY_ANNOUNCE_MIN ||
-                              min == TSIG_WAVEFORM_JJY_ANNOUNCE_MIN2;
-        if (is_announce) {
-          uint8_t sec = adj_datetime.sec;
-          uint16_t msec = adj_datetime.msec;
-          uint8_t is_morse = ((sec == TSIG_WAVEFORM_JJY_MORSE_SEC &&
-                               msec >= TSIG_WAVEFORM_JJY_MORSE_MS) ||
-                              TSIG_WAVEFORM_JJY_MORSE_SEC < sec) &&
-                             sec < TSIG_WAVEFORM_JJY_MORSE_END_SEC;
-          if (is_morse) {
-            uint32_t msec_to_morse_end =
-                1000 * TSIG_WAVEFORM_JJY_MORSE_END_SEC - msec_since_min;
-            ctx->morse_end =
-                ctx->samples + msec_to_morse_end * ctx->sample_rate / 1000;
-          }
-        }
+      if (err_db > TSIG_WAVEFORM_SYNTH_LOW_TOL_DB) {
+        if (best_err_db <= TSIG_WAVEFORM_SYNTH_LOW_TOL_DB ||
+            err_db > best_err_db + TSIG_WAVEFORM_SYNTH_LOW_TIE_DB ||
+            (err_db > best_err_db - TSIG_WAVEFORM_SYNTH_LOW_TIE_DB &&
+             !(level > synth->level)))
+          continue;
+      } else if (best_err_db <= TSIG_WAVEFORM_SYNTH_LOW_TOL_DB &&
+                 !(level > synth->level * (1.0 + TSIG_WAVEFORM_SYNTH_TIE) ||
+                   (level > synth->level * (1.0 - TSIG_WAVEFORM_SYNTH_TIE) &&
+                    scale > synth->scale))) {
+        continue;
       }
-    }
 
-    if (ctx->morse_end) {
-      if (ctx->samples < ctx->morse_end)
-        xmit_low = 0;
-      else
-        ctx->morse_end = 0;
+      best_err_db = err_db;
+      synth->subharmonic = sub;
+      synth->scale = scale;
+      synth->level = level;
     }
+  }
 
-    /* Find and set instantaneous gain, interpolating changes if needed. */
-    uint8_t bit = 1 << (ctx->tick % CHAR_BIT);
-    uint8_t is_xmit_high = ctx->xmit_level[ctx->tick / CHAR_BIT] & bit;
-    float target_gain = is_xmit_high ? 1.0F : xmit_low;
-    float gain = ctx->gain;
+  return synth;
+}
 
-    if (ctx->fade_gain != ctx->max_fade_gain)
-      target_gain *= (float)ctx->fade_gain * ctx->fade_gain /
-                     (ctx->max_fade_gain * ctx->max_fade_gain);
+/**
+ * Convert a sample count to a station timestamp.
+ * @param ctx Pointer to a waveform context.
+ * @param params Pointer to a struct containing user parameters.
+ * @param samples Sample count since the base timestamp of `ctx`.
+ * @return Station timestamp in milliseconds at which `samples` is output.
+ */
+static inline double tsig_waveform_samples_to_ms(tsig_waveform_ctx_t *ctx,
+                                                 tsig_params_t *params,
+                                                 uint64_t samples) {
+  double ms = 1000.0 * (int64_t)(samples - ctx->base_samples) / ctx->rate;
+  return ctx->base_ms + ms + ctx->timestamp + params->offset;
+}
 
-    ctx->gain = params->noclip ? tsig_lerp(target_gain, gain) : target_gain;
+/**
+ * Convert a station timestamp to a sample count.
+ * @param ctx Pointer to a waveform context.
+ * @param params Pointer to a struct containing user parameters.
+ * @param ms Station timestamp in milliseconds. Must not precede the base
+ *  timestamp of `ctx`.
+ * @return Count of the first sample output at or after `ms`.
+ * @note Computed from the base timestamp every time, so that rounding to
+ *  whole samples never accumulates over a long transmission.
+ */
+static inline uint64_t tsig_waveform_ms_to_samples(tsig_waveform_ctx_t *ctx,
+                                                   tsig_params_t *params,
+                                                   double ms) {
+  ms -= ctx->timestamp + params->offset + ctx->base_ms;
+  return ctx->base_samples + ceil(ms * ctx->rate / 1000.0);
+}
 
-    /* We are now ready to generate and output a sample. */
-    float sample = tsig_gen_next_sample(ctx);
+/**
+ * Advance a waveform context without generating audio samples.
+ * @param ctx Pointer to a waveform context.
+ * @param samples Count of samples to skip. Must not pass the next edge.
+ */
+static inline void tsig_waveform_skip(tsig_waveform_ctx_t *ctx,
+                                      uint64_t samples) {
+  ctx->phase += samples * ctx->phase_delta;
+  ctx->chip_phase += samples * ctx->chip_delta;
+  ctx->samples += samples;
+}
 
-    for (int o = 0; o < n_outputs; o++)
-      for (int c = 0; c < outputs[o].numberOfChannels; c++)
-        outputs[o].data[c * TSIG_RENDER_QUANTUM + i] = sample;
+/**
+ * Resynchronize a waveform context to a later sample count.
+ *
+ * Used when samples were never output, e.g. when render quantums were
+ * dropped. Carrier phase advances as if they were output. The frame and the
+ * edge in effect are re-derived for the new position, then generation
+ * continues from there.
+ *
+ * @param ctx Pointer to a waveform context.
+ * @param samples Sample count to resynchronize to. Must not precede the
+ *  current sample count.
+ */
+static inline void tsig_waveform_resync(tsig_waveform_ctx_t *ctx,
+                                        uint64_t samples) {
+  ctx->phase += (samples - ctx->samples) * ctx->phase_delta;
+  ctx->chip_phase += (samples - ctx->samples) * ctx->chip_delta;
+  ctx->samples = samples;
+
+  ctx->next_edge = samples;
+  ctx->xmit_stale = 1;
+}
 
-    ctx->phase += ctx->phase_delta;
-    if (ctx->phase >= ctx->phase_base)
-      ctx->phase -= ctx->phase_base;
+/**
+ * Find the station timestamp of the next edge of a waveform context.
+ * @param ctx Pointer to a waveform context.
+ * @return Station timestamp, which is the start of the next minute if the
+ *  current minute has no more edges.
+ */
+static inline double tsig_waveform_edge_ms(tsig_waveform_ctx_t *ctx) {
+  tsig_waveform_frame_t *frame = &ctx->frame;
+  double ms = ctx->edge < frame->len ? frame->edges[ctx->edge].us / 1000.0
+                                     : TSIG_DATETIME_MSECS_MIN;
+  return ctx->min_ms + ms;
+}
 
-    ctx->samples++;
+/**
+ * Update a waveform context for the edge at the current sample.
+ *
+ * Edges are tracked as exact station timestamps. Each one is converted to the
+ * first sample output at or after it only once it is next, so every change
+ * lags its intended instant by less than one sample however the conversion
+ * changes in the meantime.
+ *
+ * At the start or after a resync, the current sample may fall anywhere within
+ * a minute, and the edge in effect there is found instead.
+ *
+ * @param ctx Pointer to a waveform context.
+ * @param params Pointer to a struct containing user parameters.
+ */
+static void tsig_waveform_update_edge(tsig_waveform_ctx_t *ctx,
+                                      tsig_params_t *params) {
+  tsig_waveform_frame_t *frame = &ctx->frame;
+  double ms = tsig_waveform_samples_to_ms(ctx, params, ctx->samples);
+
+  if (ctx->xmit_stale) {
+    double min_ms = floor(ms / TSIG_DATETIME_MSECS_MIN);
+    ctx->min_ms = min_ms * TSIG_DATETIME_MSECS_MIN;
+
+    tsig_datetime_t datetime = tsig_datetime_parse_timestamp(ctx->min_ms);
+    tsig_waveform_gen_frame(frame, datetime, params);
+    ctx->edge = tsig_waveform_find_edge(frame, 1000.0 * (ms - ctx->min_ms));
+    ctx->xmit_stale = 0;
+  } else if (ctx->edge == frame->len) {
+    ctx->min_ms += TSIG_DATETIME_MSECS_MIN;
+
+    tsig_datetime_t datetime = tsig_datetime_parse_timestamp(ctx->min_ms);
+    tsig_waveform_gen_frame(frame, datetime, params);
+    ctx->edge = 0;
+  }
+
+  tsig_waveform_edge_t *edge = &frame->edges[ctx->edge++];
+  uint64_t is_inverted = edge->phase & TSIG_WAVEFORM_PHASE_INVERTED;
+  ctx->level = edge->level;
+
+  /*
+   * Chip phase is realigned to the current sample every edge, so that the
+   * chips follow any resync or latency shift. It only ever runs past the
+   * sequence, into the zeros that follow it, until the next second.
+   */
+  if (ctx->chip_hz) {
+    double sec_ms = ctx->min_ms + 1000 * (edge->us / 1000000);
+    double chip_ms = ms - sec_ms - TSIG_WAVEFORM_DCF77_CHIP_MS;
+    double chips = fmax(chip_ms, 0.0) * ctx->chip_hz / 1000.0;
+    uint8_t is_spread = !!(edge->phase & TSIG_WAVEFORM_PHASE_SPREAD);
+
+    ctx->phase_shift = 0;
+    ctx->chip_phase =
+        chips / TSIG_WAVEFORM_CHIP_TABLE_LEN * TSIG_WAVEFORM_CYCLE;
+    ctx->chip_step = is_spread * (1 - 2 * (int64_t)is_inverted) *
+                     (int64_t)ctx->chip_dev;
+  } else {
+    ctx->phase_shift = is_inverted * TSIG_WAVEFORM_HALF_CYCLE;
+  }
+
+  /*
+   * Per DCF77's signal format specification, each minute and each transmit
+   * power change occurs at a rising zero crossing. We don't have enough
+   * control over what actually gets transmitted to reliably emulate this,
+   * and it's almost certainly not necessary for our purposes. Still,
+   * there's no particular reason not to try, so adjust the initial phase
+   * of the waveform such that the beginning of the next minute occurs at
+   * such a crossing. The phase change shouldn't matter for other stations.
+   */
+  if (!ctx->samples) {
+    double next_min_ms = ctx->min_ms + TSIG_DATETIME_MSECS_MIN;
+    uint64_t to_min = tsig_waveform_ms_to_samples(ctx, params, next_min_ms);
+    ctx->phase = -(to_min * ctx->phase_delta);
+  }
+
+  double edge_ms = tsig_waveform_edge_ms(ctx);
+  ctx->next_edge = tsig_waveform_ms_to_samples(ctx, params, edge_ms);
+}
+
+/**
+ * Find the gain of a transmit level.
+ * @param level Transmit level.
+ * @param params Pointer to a struct containing user parameters.
+ * @return Gain in [0.0F-1.0F].
+ */
+static inline float tsig_waveform_level_gain(uint8_t level,
+                                             tsig_params_t *params) {
+  if (level == TSIG_WAVEFORM_LEVEL_HIGH)
+    return 1.0F;
+
+  return level == TSIG_WAVEFORM_LEVEL_LOW
+             ? TSIG_WAVEFORM_STATION_DATA[params->station].xmit_low
+             : 0.0F;
+}
 
-    /* Fade in/out. Initiate a phase transition once fade is complete. */
+/**
+ * Find the target gain for the current sample, before any fade.
+ * @param ctx Pointer to a waveform context.
+ * @param params Pointer to a struct containing user parameters.
+ * @return Target gain in [0.0F-1.0F].
+ */
+static inline float tsig_waveform_level(tsig_waveform_ctx_t *ctx,
+                                        tsig_params_t *params) {
+  return tsig_waveform_level_gain(ctx->level, params);
+}
+
+/**
+ * Find the gain of an edge for a renderer that only keys the gain of a
+ * steady carrier, as the Web Audio automation engine does.
+ *
+ * Phase inversion is a negative gain, which is exact, as quantization is
+ * odd-symmetric. DCF77's chip spreading cannot be keyed, and is left out.
+ *
+ * @param edge Pointer to an edge.
+ * @param params Pointer to a struct containing user parameters.
+ * @return Gain in [-1.0F-1.0F].
+ */
+static inline float tsig_waveform_edge_gain(tsig_waveform_edge_t *edge,
+                                            tsig_params_t *params) {
+  waveform_station_data_t *data = &TSIG_WAVEFORM_STATION_DATA[params->station];
+  float gain = tsig_waveform_level_gain(edge->level, params);
+  uint8_t is_inverted =
+      !data->chip_cycles && (edge->phase & TSIG_WAVEFORM_PHASE_INVERTED);
+
+  return is_inverted ? -gain : gain;
+}
+
+/**
+ * Generate the frame of a station minute for scheduling ahead.
+ * @param frame Pointer to the frame to be generated.
+ * @param params Pointer to a struct containing user parameters.
+ * @param ms Station timestamp anywhere within the minute.
+ * @return Station timestamp of the start of the minute.
+ */
+static inline double tsig_waveform_sched_minute(tsig_waveform_frame_t *frame,
+                                                tsig_params_t *params,
+                                                double ms) {
+  double min_ms = floor(ms / TSIG_DATETIME_MSECS_MIN) * TSIG_DATETIME_MSECS_MIN;
+
+  tsig_datetime_t datetime = tsig_datetime_parse_timestamp(min_ms);
+  tsig_waveform_gen_frame(frame, datetime, params);
+  return min_ms;
+}
+
+/**
+ * Reschedule the next edge after a timestamp conversion change at the
+ * current sample.
+ * @param ctx Pointer to a waveform context.
+ * @param params Pointer to a struct containing user parameters.
+ */
+static void tsig_waveform_reschedule(tsig_waveform_ctx_t *ctx,
+                                     tsig_params_t *params) {
+  /* The edge in effect is found at the current sample anyway. */
+  if (ctx->xmit_stale)
+    return;
+
+  double edge_ms = tsig_waveform_edge_ms(ctx);
+  uint64_t next_edge = tsig_waveform_ms_to_samples(ctx, params, edge_ms);
+  ctx->next_edge = tsig_max(next_edge, ctx->samples);
+}
+
+/**
+ * Shift the station timestamps of a waveform context from the current
+ * sample onwards.
+ *
+ * Used to track changes in output latency. Pending transmit level changes
+ * that shift into the past happen at the current sample instead.
+ *
+ * @param ctx Pointer to a waveform context.
+ * @param params Pointer to a struct containing user parameters.
+ * @param ms Milliseconds to add to station timestamps.
+ */
+void tsig_waveform_shift(tsig_waveform_ctx_t *ctx, tsig_params_t *params,
+                         double ms) {
+  ctx->base_ms += ms;
+  tsig_waveform_reschedule(ctx, params);
+}
+
+/**
+ * Correct a waveform context for the error of the sample clock.
+ *
+ * The generated frequency and the timing of transmit level changes are both
+ * retuned, from the current sample onwards, for an audio output device whose
+ * true sample rate differs from the nominal one by `ppb`. The waveform
+ * remains phase-continuous.
+ *
+ * @param ctx Pointer to a waveform context.
+ * @param params Pointer to a struct containing user parameters.
+ * @param ppb Sample clock error in parts per billion. Positive if fast.
+ */
+void tsig_waveform_set_ppb(tsig_waveform_ctx_t *ctx, tsig_params_t *params,
+                           int32_t ppb) {
+  double rate = ctx->sample_rate * (1.0 + ppb * 1e-9);
+
+  /* Rebase sample-to-timestamp conversion at the current sample. */
+  if (ctx->samples) {
+    ctx->base_ms += 1000.0 * (ctx->samples - ctx->base_samples) / ctx->rate;
+    ctx->base_samples = ctx->samples;
+    ctx->rate = rate;
+
+    tsig_waveform_reschedule(ctx, params);
+  }
+
+  ctx->rate = rate;
+  ctx->ppb = ppb;
+  ctx->phase_delta = ctx->subharmonic_hz / rate * TSIG_WAVEFORM_CYCLE;
+  ctx->chip_delta =
+      ctx->chip_hz / rate / TSIG_WAVEFORM_CHIP_TABLE_LEN * TSIG_WAVEFORM_CYCLE;
+}
+
+/**
+ * Generate audio samples for an emulated time station waveform.
+ *
+ * `TSIG_RENDER_QUANTUM` samples are generated of an emulated waveform similar
+ * to that transmitted by a real time station and written to the provided
+ * audio output buffers.
+ *
+ * @param ctx Pointer to a waveform context.
+ * @param params Pointer to a struct containing user parameters.
+ * @param state Current time signal generator module state.
+ * @param[out] out_next_state Out pointer to the time signal generator module
+ *  state at the end of this render quantum.
+ * @param n_outputs Count of audio output buffers.
+ * @param outputs Array of audio output buffers provided to an audio worklet
+ *  processor callback function by the Emscripten Audio Worklets API.
+ */
+void tsig_waveform_generate(tsig_waveform_ctx_t *ctx, tsig_params_t *params,
+                            int state, int *out_next_state, int n_outputs,
+                            AudioSampleFrame *outputs) {
+  float samples[TSIG_RENDER_QUANTUM];
+
+  for (int i = 0; i < TSIG_RENDER_QUANTUM;) {
+    /* Update state for the edge at the current sample. */
+    if (ctx->samples == ctx->next_edge)
+      tsig_waveform_update_edge(ctx, params);
+
+    /* Interpolate a change of gain, if needed. */
+    float target_gain = tsig_waveform_level(ctx, params);
+    if (target_gain != ctx->ramp_target)
+      tsig_waveform_ramp(ctx, params, target_gain);
+
+    /*
+     * Gain is steady between edges but for interpolated changes and fades,
+     * which are looked up in tables, so generate up to the next edge, or the
+     * end of a change or fade, in one go.
+     */
+    uint64_t end = ctx->samples + TSIG_RENDER_QUANTUM - i;
+    int n = tsig_min(end, ctx->next_edge) - ctx->samples;
+    if (ctx->ramp_pos < ctx->ramp_len)
+      n = tsig_min(n, ctx->ramp_len - ctx->ramp_pos);
+
+    /* Fade in/out. Initiate a state transition once the fade is complete. */
+    uint8_t is_faded = state != TSIG_STATE_RUNNING;
+    int step = 0;
     if (state == TSIG_STATE_FADE_IN) {
-      if (ctx->fade_gain < ctx->max_fade_gain)
-        ctx->fade_gain++;
-      else if (target_gain == ctx->gain)
+      if (ctx->fade_gain < ctx->max_fade_gain) {
+        step = 1;
+        n = tsig_min(n, ctx->max_fade_gain - ctx->fade_gain);
+      } else {
+        is_faded = 0;
         *out_next_state = TSIG_STATE_RUNNING;
-    }
-
-    else if (state == TSIG_STATE_FADE_OUT) {
-      if (ctx->fade_gain)
-        ctx->fade_gain--;
-      else if (target_gain == ctx->gain)
+      }
+    } else if (state == TSIG_STATE_FADE_OUT) {
+      if (ctx->fade_gain) {
+        step = -1;
+        n = tsig_min(n, ctx->fade_gain);
+      } else {
         *out_next_state = TSIG_STATE_SUSPEND;
+      }
     }
+
+    if (is_faded)
+      tsig_gen_fade(ctx, &samples[i], n, step);
+    else if (ctx->ramp_pos < ctx->ramp_len)
+      tsig_gen_ramp(ctx, &samples[i], n);
+    else
+      tsig_gen_span(ctx, &samples[i], n);
+    i += n;
+  }
+
+  for (int o = 0; o < n_outputs; o++)
+    for (int c = 0; c < outputs[o].numberOfChannels; c++)
+      memcpy(&outputs[o].data[c * TSIG_RENDER_QUANTUM], samples,
+             sizeof(samples));
+}
+
+/**
+ * Advance a waveform context by a render quantum without generating audio
+ * samples.
+ *
+ * Used on warm standby. The frame of the current minute and the edge in
+ * effect are kept up to date, so fading in can begin at any render quantum
+ * without first encoding a frame.
+ *
+ * @param ctx Pointer to a waveform context.
+ * @param params Pointer to a struct containing user parameters.
+ */
+void tsig_waveform_advance(tsig_waveform_ctx_t *ctx, tsig_params_t *params) {
+  for (int i = 0; i < TSIG_RENDER_QUANTUM;) {
+    if (ctx->samples == ctx->next_edge)
+      tsig_waveform_update_edge(ctx, params);
+
+    uint64_t end = ctx->samples + TSIG_RENDER_QUANTUM - i;
+    int n = tsig_min(end, ctx->next_edge) - ctx->samples;
+    tsig_waveform_skip(ctx, n);
+    i += n;
   }
 }
 
@@ -792,42 +1843,63 @@ void tsig_waveform_generate(tsig_waveform_ctx_t *ctx, tsig_params_t *params,
  *  processor callback function by the Emscripten Audio Worklets API.
  */
 void tsig_waveform_generate_silence(int n_outputs, AudioSampleFrame *outputs) {
+  /* Channels of an output are contiguous, so clear each output at once. */
   for (int i = 0; i < n_outputs; i++)
-    for (int j = 0; j < TSIG_RENDER_QUANTUM; j++)
-      for (int k = 0; k < outputs[i].numberOfChannels; k++)
-        outputs[i].data[j + k * TSIG_RENDER_QUANTUM] = 0.0F;
+    memset(outputs[i].data, 0,
+           outputs[i].numberOfChannels * TSIG_RENDER_QUANTUM * sizeof(float));
 }
 
 /**
  * Initialize a waveform context from a timestamp.
  * @param ctx Pointer to the waveform context to be initialized.
  * @param params Pointer to user parameters.
+ * @param synth Pointer to the synthesis chosen for `params` at the sample
+ *  rate of `ctx` by tsig_waveform_choose_synth().
+ * @note Reads but never fills the shared tables, so it may run in any thread
+ *  once tsig_waveform_init_tables() has run in the main thread.
  */
-void tsig_waveform_init(tsig_waveform_ctx_t *ctx, tsig_params_t *params) {
-  uint32_t utc_offset = TSIG_WAVEFORM_STATION_DATA[params->station].utc_offset;
+void tsig_waveform_init(tsig_waveform_ctx_t *ctx, tsig_params_t *params,
+                        const tsig_waveform_synth_t *synth) {
+  waveform_station_data_t *data = &TSIG_WAVEFORM_STATION_DATA[params->station];
+  uint32_t utc_offset = data->utc_offset;
   double render_quantum_ms = 1000.0 * TSIG_RENDER_QUANTUM / ctx->sample_rate;
   double timestamp = emscripten_get_now();
   uint32_t sample_rate = ctx->sample_rate;
-  uint8_t subharmonic;
-  uint32_t target_hz;
-  uint32_t gcd;
-
-  target_hz = tsig_calculate_target_hz(params);
-  subharmonic = tsig_calculate_subharmonic(target_hz);
-  gcd = tsig_gcd(target_hz, sample_rate * subharmonic);
+  uint8_t subharmonic = synth->subharmonic;
+  uint32_t target_hz = synth->target_hz;
 
   ctx->timestamp = timestamp + utc_offset + render_quantum_ms;
+  ctx->min_ms = 0;
+  ctx->base_samples = 0;
+  ctx->base_ms = 0;
   ctx->samples = 0;
-  ctx->next_tick = 0;
-  ctx->morse_end = 0;
+  ctx->next_edge = 0;
+  ctx->edge = 0;
+  ctx->level = TSIG_WAVEFORM_LEVEL_OFF;
+  ctx->xmit_stale = 1;
 
-  ctx->phase_delta = target_hz / gcd;
-  ctx->phase_base = sample_rate * subharmonic / gcd;
+  ctx->subharmonic = subharmonic;
+  ctx->subharmonic_hz = (double)target_hz / subharmonic;
   ctx->phase = 0;
+  ctx->phase_shift = 0;
+
+  ctx->chip_hz = 0;
+  ctx->chip_phase = 0;
+  ctx->chip_dev = 0;
+  ctx->chip_step = 0;
+  if (data->chip_cycles) {
+    double dev = TSIG_WAVEFORM_DCF77_CHIP_DEG / 360.0 / subharmonic;
+    ctx->chip_hz = (double)target_hz / data->chip_cycles;
+    ctx->chip_dev = dev * TSIG_WAVEFORM_CYCLE;
+  }
+  tsig_waveform_set_ppb(ctx, params, 0);
 
-  ctx->max_fade_gain = sample_rate * TSIG_FADE_MS / 1000;
+  ctx->max_fade_gain = tsig_fade_steps(sample_rate);
   ctx->fade_gain = 0;
   ctx->gain = 0.0;
+  ctx->ramp_target = 0.0F;
+  ctx->ramp_len = 0;
+  ctx->ramp_pos = 0;
 
-  ctx->scale = sample_rate / subharmonic;
+  ctx->scale = synth->scale;
 }
@@ -6,10 +6,25 @@ import { ArrowDropdown } from "@components/arrowdropdown";
 import { CollapseSetting } from "@components/collapsesetting";
 
 import EventBus from "@shared/eventbus";
-import { ReadyBusyEvent, SettingsEvent } from "@shared/events";
+import {
+  ReadyBusyEvent,
+  ServerOffsetEvent,
+  SettingsEvent,
+} from "@shared/events";
+import RadioTimeSignal from "@shared/radiotimesignal";
 import "@shared/styles.css";
 
-import { FakeAppSettings, delay } from "@test/utils";
+import { FakeAppSettings, TestSettings, delay } from "@test/utils";
+
+const updateStandby = vi
+  .spyOn(RadioTimeSignal, "updateStandby")
+  .mockImplementation(() => {});
+const schedule = vi
+  .spyOn(RadioTimeSignal, "schedule")
+  .mockImplementation(() => {});
+const unschedule = vi
+  .spyOn(RadioTimeSignal, "unschedule")
+  .mockImplementation(() => {});
 
 describe("Advanced settings", () => {
   let advancedSettings: AdvancedSettings;
@@ -17,13 +32,26 @@ describe("Advanced settings", () => {
   let summary: HTMLButtonElement; /* Not really a button, but keep TS happy. */
   let collapseSetting: CollapseSetting;
   let noclip: HTMLInputElement;
+  let standby: HTMLInputElement;
   let sync: HTMLInputElement;
+  let scheduled: HTMLInputElement;
+  let scheduleStart: HTMLInputElement;
+  let scheduleEnd: HTMLInputElement;
+  let worklet: HTMLInputElement;
+  let pipeline: HTMLInputElement;
+  let automation: HTMLInputElement;
 
   beforeEach(async () => {
     advancedSettings = document.createElement("advanced-settings");
     document.body.appendChild(advancedSettings);
     await delay();
-    [noclip, sync] = advancedSettings.querySelectorAll("input");
+    [noclip, standby, sync, scheduled] =
+      advancedSettings.querySelectorAll("input.checkbox");
+    [scheduleStart, scheduleEnd] =
+      advancedSettings.querySelectorAll("input[type=time]");
+    [worklet, pipeline, automation] = advancedSettings.querySelectorAll(
+      "input[name=engine]",
+    );
     arrowDropdown = advancedSettings.querySelector("arrow-dropdown")!;
     summary = advancedSettings.querySelector("summary.dropdown-arrow")!;
     collapseSetting = advancedSettings.querySelector("collapse-setting")!;
@@ -36,11 +64,21 @@ describe("Advanced settings", () => {
 
   it("renders closed with defaults", () => {
     expect(advancedSettings.noclip).toBe(true);
+    expect(advancedSettings.engine).toBe("worklet");
+    expect(advancedSettings.standby).toBe(false);
     expect(advancedSettings.sync).toBe(true);
     expect(arrowDropdown.open).toBe(false);
     expect(collapseSetting.open).toBe(false);
     expect(noclip.checked).toBe(true);
+    expect(worklet.checked).toBe(true);
+    expect(pipeline.checked).toBe(false);
+    expect(automation.checked).toBe(false);
+    expect(standby.checked).toBe(false);
     expect(sync.checked).toBe(true);
+    expect(advancedSettings.schedule).toBe(false);
+    expect(scheduled.checked).toBe(false);
+    expect(scheduleStart.value).toBe("02:00");
+    expect(scheduleEnd.value).toBe("03:00");
   });
 
   describe("handles ReadyBusyEvent", () => {
@@ -48,32 +86,105 @@ describe("Advanced settings", () => {
       advancedSettings.noclip = true;
       advancedSettings.sync = false;
       FakeAppSettings.get.mockReturnValueOnce(false);
+      FakeAppSettings.get.mockReturnValueOnce("automation");
+      FakeAppSettings.get.mockReturnValueOnce(true);
       FakeAppSettings.get.mockReturnValueOnce(true);
       EventBus.publish(ReadyBusyEvent, true);
       expect(advancedSettings.noclip).toBe(false);
+      expect(advancedSettings.engine).toBe("automation");
+      expect(advancedSettings.standby).toBe(true);
       expect(advancedSettings.sync).toBe(true);
+      expect(advancedSettings.schedule).toBe(false);
+      expect(advancedSettings.scheduleStart).toBe(90);
+      expect(advancedSettings.scheduleEnd).toBe(150);
+      expect(unschedule).toHaveBeenCalled();
+    });
+
+    it("follows the schedule saved upon true", () => {
+      ["noclip", "engine", "standby", "sync"].forEach((setting) =>
+        FakeAppSettings.get.mockReturnValueOnce(
+          TestSettings[setting as keyof typeof TestSettings],
+        ),
+      );
+      FakeAppSettings.get.mockReturnValueOnce(true);
+      EventBus.publish(ReadyBusyEvent, true);
+      expect(advancedSettings.schedule).toBe(true);
+      expect(schedule).toHaveBeenCalledWith(
+        [{ startMin: 90, endMin: 150 }],
+        expect.any(Function),
+      );
     });
 
     it("does not get settings upon false", () => {
       EventBus.publish(ReadyBusyEvent, false);
       expect(FakeAppSettings.get).not.toHaveBeenCalled();
+      expect(schedule).not.toHaveBeenCalled();
     });
   });
 
   describe("handles SettingsEvent", () => {
     it("sets settings upon save", () => {
       advancedSettings.noclip = false;
+      advancedSettings.engine = "automation";
+      advancedSettings.standby = true;
       advancedSettings.sync = true;
       EventBus.publish(SettingsEvent, "save");
       expect(FakeAppSettings.set).toHaveBeenCalledWith("noclip", false);
+      expect(FakeAppSettings.set).toHaveBeenCalledWith("engine", "automation");
+      expect(FakeAppSettings.set).toHaveBeenCalledWith("standby", true);
       expect(FakeAppSettings.set).toHaveBeenCalledWith("sync", true);
     });
 
+    it("sets and follows schedule upon save", () => {
+      advancedSettings.schedule = true;
+      advancedSettings.scheduleStart = 1380;
+      advancedSettings.scheduleEnd = 60;
+      EventBus.publish(SettingsEvent, "save");
+      expect(FakeAppSettings.set).toHaveBeenCalledWith("schedule", true);
+      expect(FakeAppSettings.set).toHaveBeenCalledWith("scheduleStart", 1380);
+      expect(FakeAppSettings.set).toHaveBeenCalledWith("scheduleEnd", 60);
+      expect(schedule).toHaveBeenCalledWith(
+        [{ startMin: 1380, endMin: 60 }],
+        expect.any(Function),
+      );
+      expect(unschedule).not.toHaveBeenCalled();
+    });
+
+    it("starts on schedule with settings and server offset", () => {
+      advancedSettings.schedule = true;
+      EventBus.publish(ServerOffsetEvent, 500);
+      EventBus.publish(SettingsEvent, "save");
+      const getParams = schedule.mock.lastCall![1];
+      expect(getParams()).toMatchObject({
+        offset: TestSettings.offset + 500,
+        dut1: TestSettings.dut1,
+        engine: TestSettings.engine,
+        standby: TestSettings.standby,
+      });
+    });
+
+    it("stops following schedule upon save", () => {
+      advancedSettings.schedule = false;
+      EventBus.publish(SettingsEvent, "save");
+      expect(unschedule).toHaveBeenCalled();
+      expect(schedule).not.toHaveBeenCalled();
+    });
+
+    it("leaves standby as needed upon save", () => {
+      advancedSettings.engine = "pipeline";
+      advancedSettings.standby = false;
+      EventBus.publish(SettingsEvent, "save");
+      expect(updateStandby).toHaveBeenCalledWith(false, "pipeline");
+    });
+
     it("does not set settings unless save", () => {
       advancedSettings.noclip = false;
       advancedSettings.sync = true;
       EventBus.publish(SettingsEvent, "baz");
       expect(FakeAppSettings.set).not.toHaveBeenCalled();
+      expect(updateStandby).not.toHaveBeenCalled();
+      expect(schedule).not.toHaveBeenCalled();
+      expect(unschedule).not.toHaveBeenCalled();
     });
 
     it("closes contents", () => {
@@ -118,5 +229,92 @@ describe("Advanced settings", () => {
         expect((advancedSettings as any)[name]).toBe(false);
       });
     });
+
+    describe("standby", () => {
+      it("reflects property", async () => {
+        advancedSettings.standby = true;
+        await delay();
+        expect(advancedSettings.hasAttribute("standby")).toBe(true);
+        expect(standby.checked).toBe(true);
+      });
+
+      it("reflects attribute", async () => {
+        advancedSettings.setAttribute("standby", "");
+        await delay();
+        expect(advancedSettings.standby).toBe(true);
+        expect(standby.checked).toBe(true);
+      });
+
+      it("reflects checkbox state", async () => {
+        standby.click();
+        await delay();
+        expect(advancedSettings.hasAttribute("standby")).toBe(true);
+        expect(advancedSettings.standby).toBe(true);
+      });
+    });
+
+    describe("schedule", () => {
+      it("reflects checkbox state", async () => {
+        scheduled.click();
+        await delay();
+        expect(advancedSettings.hasAttribute("schedule")).toBe(true);
+        expect(advancedSettings.schedule).toBe(true);
+      });
+
+      it("reflects window property", async () => {
+        advancedSettings.scheduleStart = 1410;
+        advancedSettings.scheduleEnd = 5;
+        await delay();
+        expect(advancedSettings.getAttribute("schedule-start")).toBe("1410");
+        expect(scheduleStart.value).toBe("23:30");
+        expect(scheduleEnd.value).toBe("00:05");
+      });
+
+      it("reflects time input state", async () => {
+        scheduleStart.value = "04:30";
+        scheduleStart.dispatchEvent(new Event("change"));
+        scheduleEnd.value = "05:15";
+        scheduleEnd.dispatchEvent(new Event("change"));
+        await delay();
+        expect(advancedSettings.scheduleStart).toBe(270);
+        expect(advancedSettings.scheduleEnd).toBe(315);
+      });
+
+      it("ignores cleared time input", async () => {
+        scheduleStart.value = "";
+        scheduleStart.dispatchEvent(new Event("change"));
+        await delay();
+        expect(advancedSettings.scheduleStart).toBe(120);
+      });
+    });
+
+    describe("engine", () => {
+      it("reflects property", async () => {
+        advancedSettings.engine = "automation";
+        await delay();
+        expect(advancedSettings.getAttribute("engine")).toBe("automation");
+        expect(worklet.checked).toBe(false);
+        expect(automation.checked).toBe(true);
+      });
+
+      it("reflects attribute", async () => {
+        advancedSettings.setAttribute("engine", "automation");
+        await delay();
+        expect(advancedSettings.engine).toBe("automation");
+        expect(automation.checked).toBe(true);
+      });
+
+      it("reflects radio button state", async () => {
+        pipeline.click();
+        await delay();
+        expect(advancedSettings.engine).toBe("pipeline");
+        automation.click();
+        await delay();
+        expect(advancedSettings.engine).toBe("automation");
+        worklet.click();
+        await delay();
+        expect(advancedSettings.engine).toBe("worklet");
+      });
+    });
   });
 });
@@ -145,13 +145,29 @@ describe("Start-stop button", () => {
     });
 
     it("passes params to waveform generator", () => {
-      const { stationIndex, jjyKhzIndex, offset, dut1, noclip } =
-        FakeRadioTimeSignal.start.mock.lastCall![0];
+      const {
+        stationIndex,
+        jjyKhzIndex,
+        offset,
+        dut1,
+        noclip,
+        engine,
+        standby,
+      } = FakeRadioTimeSignal.start.mock.lastCall![0];
       expect(stationIndex).toBe(2);
       expect(jjyKhzIndex).toBe(1);
       expect(offset).toBe(-1234);
       expect(dut1).toBe(123);
       expect(noclip).toBe(false);
+      expect(engine).toBe("automation");
+      expect(standby).toBe(true);
+    });
+
+    it("starts playback if on standby", () => {
+      FakeRadioTimeSignal.state.mockReturnValueOnce("standby");
+      innerButton.click();
+      expect(FakeRadioTimeSignal.start).toHaveBeenCalledTimes(2);
+      expect(FakeRadioTimeSignal.stop).not.toHaveBeenCalled();
     });
 
     it("stops playback if currently started", () => {
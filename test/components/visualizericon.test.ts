@@ -8,6 +8,7 @@ import {
   ReadyBusyEvent,
   TimeSignalReadyEvent,
   TimeSignalStateChangeEvent,
+  TimeSignalStatsEvent,
   VisualizerIconEvent,
 } from "@shared/events";
 import "@shared/styles.css";
@@ -111,6 +112,82 @@ describe("Visualizer icon", () => {
     });
   });
 
+  describe("handles TimeSignalStatsEvent", () => {
+    it("shows stats as canvas title", async () => {
+      EventBus.publish(TimeSignalStatsEvent, {
+        ppm: 48.25,
+        latencyMs: 42.04,
+        resyncs: 0,
+        subharmonic: 3,
+      });
+      await delay();
+
+      const canvas = visualizerIcon.querySelector("canvas");
+      expect(canvas?.title).toBe(
+        "Synthesis: 3rd subharmonic\n" +
+          "Sample clock correction: +48.3 ppm\n" +
+          "Output latency: 42.0 ms\n" +
+          "Resyncs after dropouts: 0",
+      );
+
+      EventBus.publish(TimeSignalStatsEvent, {
+        ppm: -3.21,
+        latencyMs: 180,
+        resyncs: 2,
+        subharmonic: 1,
+      });
+      await delay();
+      expect(canvas?.title).toBe(
+        "Synthesis: direct\n" +
+          "Sample clock correction: -3.2 ppm\n" +
+          "Output latency: 180.0 ms\n" +
+          "Resyncs after dropouts: 2",
+      );
+    });
+
+    it("shows render-ahead stats if any", async () => {
+      EventBus.publish(TimeSignalStatsEvent, {
+        ppm: 0,
+        latencyMs: 20,
+        resyncs: 1,
+        subharmonic: 5,
+        aheadMs: 248.96,
+        underflows: 3,
+      });
+      await delay();
+
+      const canvas = visualizerIcon.querySelector("canvas");
+      expect(canvas?.title).toBe(
+        "Synthesis: 5th subharmonic\n" +
+          "Sample clock correction: +0.0 ppm\n" +
+          "Output latency: 20.0 ms\n" +
+          "Resyncs after dropouts: 1\n" +
+          "Rendered ahead: 249.0 ms\n" +
+          "Underflows: 3",
+      );
+    });
+
+    it("shows time to first sample if known", async () => {
+      EventBus.publish(TimeSignalStatsEvent, {
+        ppm: -1.5,
+        latencyMs: 40,
+        resyncs: 0,
+        subharmonic: 1,
+        startMs: 61.27,
+      });
+      await delay();
+
+      const canvas = visualizerIcon.querySelector("canvas");
+      expect(canvas?.title).toBe(
+        "Synthesis: direct\n" +
+          "Sample clock correction: -1.5 ppm\n" +
+          "Output latency: 40.0 ms\n" +
+          "Resyncs after dropouts: 0\n" +
+          "Time to first sample: 61.3 ms",
+      );
+    });
+  });
+
   describe("handles TimeSignalReadyEvent", () => {
     const subscriber = {};
     const spy = vi.fn();
@@ -3,6 +3,7 @@ import { afterEach, describe, expect, it, vi } from "vitest";
 import AppSettings, {
   AppSetting,
   defaultAppSettings,
+  knownEngines,
   knownJjyKhz,
   knownStations,
 } from "@shared/appsettings";
@@ -25,6 +26,11 @@ const testSettingValues: TestSettingValues[] = [
   ],
   ["dut1", [-999, -99, 0, 99, 999], [-1000, 1000, "abc", -Infinity]],
   ["noclip", [true, false], ["zzzz", 0, null]],
+  ["engine", knownEngines, ["audioworklet", 1, true]],
+  ["standby", [true, false], ["yes", 1, null]],
+  ["schedule", [true, false], ["no", 0, undefined]],
+  ["scheduleStart", [0, 120, 1439], [-1, 1440, 1.5, "abc"]],
+  ["scheduleEnd", [0, 180, 1439], [-60, 2880, NaN, "def"]],
   ["sync", [true, false], ["aaaaa", 1, undefined]],
   ["dark", [true, false], ["", -1, "undefined"]],
   ["nanny", [true, false], ["fff", Infinity, BigInt(0)]],
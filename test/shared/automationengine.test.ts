@@ -0,0 +1,132 @@
+import { afterEach, beforeEach, describe, expect, it, vi } from "vitest";
+
+import AutomationEngine, {
+  AutomationModule,
+  AutomationParams,
+  makeQuantizerCurve,
+} from "@shared/automationengine";
+
+/* A minute with edges at :00.000, :01.000, and :01.200. */
+const kEdgeMs = [0, 1000, 1200] as const;
+const kEdgeGains = [0, 1, -0.5] as const;
+
+function makeFakeModule() {
+  let minMs = 0;
+  const module: AutomationModule = {
+    _tsig_sched_load_params: vi.fn(),
+    _tsig_sched_get_hz: () => 20000,
+    _tsig_sched_get_subharmonic: () => 3,
+    _tsig_sched_get_scale: () => 16,
+    _tsig_sched_minute: (timestamp: number) => {
+      minMs = Math.floor(timestamp / 60000) * 60000;
+      return kEdgeMs.length;
+    },
+    _tsig_sched_next_minute: () => {
+      minMs += 60000;
+      return kEdgeMs.length;
+    },
+    _tsig_sched_edge_ms: (i: number) => minMs + (kEdgeMs[i] ?? 60000),
+    _tsig_sched_edge_gain: (i: number) => kEdgeGains[i],
+  };
+  return module;
+}
+
+const kParams: AutomationParams = {
+  stationIndex: 4,
+  jjyKhzIndex: 0,
+  offset: 0,
+  dut1: 0,
+  noclip: false,
+};
+
+describe("makeQuantizerCurve", () => {
+  it.each([[1], [5], [4096], [65536]])("quantizes at scale %i", (scale) => {
+    const curve = makeQuantizerCurve(scale);
+    const n = curve.length;
+    const levels = new Set(curve);
+
+    expect(n % 2).toBe(1);
+    expect(levels.size).toBe(2 * scale + 1);
+    expect(curve[0]).toBe(-1);
+    expect(curve[(n - 1) / 2]).toBe(0);
+    expect(curve[n - 1]).toBe(1);
+
+    for (let i = 0; i < n; i++) {
+      expect(curve[n - 1 - i]).toBeCloseTo(-curve[i], 9);
+      if (i) expect(curve[i]).toBeGreaterThanOrEqual(curve[i - 1]);
+    }
+  });
+
+  it("truncates toward zero", () => {
+    const curve = makeQuantizerCurve(5);
+    const n = curve.length;
+
+    /* x = +/-0.5, where x * scale = +/-2.5. */
+    expect(curve[Math.round((3 * (n - 1)) / 4)]).toBeCloseTo(0.4);
+    expect(curve[Math.round((n - 1) / 4)]).toBeCloseTo(-0.4);
+  });
+});
+
+describe("AutomationEngine", () => {
+  let audioContext: OfflineAudioContext;
+  let engine: AutomationEngine;
+  let module: AutomationModule;
+  const setValueAtTime = vi.spyOn(AudioParam.prototype, "setValueAtTime");
+  const setTargetAtTime = vi.spyOn(AudioParam.prototype, "setTargetAtTime");
+
+  beforeEach(() => {
+    audioContext = new OfflineAudioContext(1, 48000, 48000);
+    module = makeFakeModule();
+    engine = new AutomationEngine(
+      module,
+      audioContext,
+      audioContext.destination,
+      () => 0,
+    );
+  });
+
+  afterEach(() => {
+    engine.stop();
+    vi.clearAllMocks();
+  });
+
+  it("schedules a minute ahead", () => {
+    engine.start(kParams);
+    expect(engine.isRunning).toBe(true);
+    expect(module._tsig_sched_load_params).toHaveBeenCalledWith(
+      0,
+      4,
+      0,
+      0,
+      48000,
+    );
+
+    /* Only the edge in effect, and those after, from the first minute. */
+    const calls = setValueAtTime.mock.calls;
+    expect(calls.length).toBeGreaterThanOrEqual(1 + kEdgeMs.length);
+    expect(calls.length).toBeLessThanOrEqual(3 * kEdgeMs.length);
+    expect(calls[0][1]).toBe(audioContext.currentTime);
+    calls.forEach(([value], i) => {
+      if (i) expect(calls[i][1]).toBeGreaterThanOrEqual(calls[i - 1][1]);
+      expect(kEdgeGains).toContain(value);
+    });
+    expect(setTargetAtTime).not.toHaveBeenCalled();
+  });
+
+  it("interpolates gain changes if noclip", () => {
+    engine.start({ ...kParams, noclip: true });
+    expect(setTargetAtTime).toHaveBeenCalled();
+    expect(setValueAtTime).not.toHaveBeenCalled();
+  });
+
+  it("starts and stops once", () => {
+    engine.start(kParams);
+    const calls = setValueAtTime.mock.calls.length;
+    engine.start(kParams);
+    expect(setValueAtTime.mock.calls.length).toBe(calls);
+
+    engine.stop();
+    expect(engine.isRunning).toBe(false);
+    expect(() => engine.stop()).not.toThrow();
+  });
+});
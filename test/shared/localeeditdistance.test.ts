@@ -2,8 +2,16 @@ import { describe, expect, it, vi } from "vitest";
 
 import EventBus from "@shared/eventbus";
 import { EditDistanceReadyEvent } from "@shared/events";
-import LocaleEditDistance from "@shared/localeeditdistance";
-import { defaultLocale, supportedLocales } from "@shared/locales";
+import LocaleEditDistance, {
+  kLocaleSearchMeasure,
+} from "@shared/localeeditdistance";
+import localeTable from "@shared/localetable";
+import {
+  defaultLocale,
+  knownLocales,
+  sortLocales,
+  supportedLocales,
+} from "@shared/locales";
 
 import { delay } from "@test/utils";
 
@@ -28,31 +36,102 @@ describe("LocaleEditDistance", () => {
   });
 
   describe("runQuery", () => {
-    it("returns undefined for empty query", () => {
-      expect(LocaleEditDistance.runQuery("")).toBe(undefined);
+    it("returns undefined for empty query", async () => {
+      expect(await LocaleEditDistance.runQuery("")).toBe(undefined);
     });
 
-    it("returns undefined for whitespace", () => {
-      expect(LocaleEditDistance.runQuery(" ")).toBe(undefined);
-      expect(LocaleEditDistance.runQuery("\t")).toBe(undefined);
-      expect(LocaleEditDistance.runQuery("\n\v\r")).toBe(undefined);
+    it("returns undefined for whitespace", async () => {
+      expect(await LocaleEditDistance.runQuery(" ")).toBe(undefined);
+      expect(await LocaleEditDistance.runQuery("\t")).toBe(undefined);
+      expect(await LocaleEditDistance.runQuery("\n\v\r")).toBe(undefined);
     });
 
-    it("returns undefined for ASCII garbage", () => {
-      expect(LocaleEditDistance.runQuery("\x01")).toBe(undefined);
-      expect(LocaleEditDistance.runQuery("\x7b")).toBe(undefined);
+    it("returns undefined for ASCII garbage", async () => {
+      expect(await LocaleEditDistance.runQuery("\x01")).toBe(undefined);
+      expect(await LocaleEditDistance.runQuery("\x7b")).toBe(undefined);
     });
 
-    it("returns a single perfect match", () => {
-      expect(LocaleEditDistance.runQuery(defaultLocale)).toEqual([
+    it("returns a single perfect match", async () => {
+      expect(await LocaleEditDistance.runQuery(defaultLocale)).toEqual([
         defaultLocale,
       ]);
     });
 
-    it("excludes locales based on writing script", () => {
-      expect(LocaleEditDistance.runQuery("a")!.length).toBeLessThan(
+    it("excludes locales based on writing script", async () => {
+      expect((await LocaleEditDistance.runQuery("a"))!.length).toBeLessThan(
         supportedLocales.length,
       );
     });
+
+    it("returns only the best locales up to a limit", async () => {
+      const all = (await LocaleEditDistance.runQuery("a"))!;
+      expect(all.length).toBeGreaterThan(3);
+      expect(await LocaleEditDistance.runQuery("a", 3)).toEqual(
+        all.slice(0, 3),
+      );
+      expect(await LocaleEditDistance.runQuery("a", all.length + 1)).toEqual(
+        all,
+      );
+    });
+
+    it("finds every locale first by its own display name", async () => {
+      /* eslint-disable no-await-in-loop */
+      for (let i = 0; i < supportedLocales.length; i++) {
+        const tag = supportedLocales[i];
+        const name = knownLocales[tag][0];
+        expect(await LocaleEditDistance.runQuery(name, 1)).toEqual([tag]);
+      }
+    });
+
+    it("ranks deterministically", async () => {
+      const ranked = await LocaleEditDistance.runQuery("a");
+      await LocaleEditDistance.runQuery("zz");
+      expect(await LocaleEditDistance.runQuery("a")).toEqual(ranked);
+    });
+
+    it("leaves out a surrogate pair split by the query limit", async () => {
+      const head = "a".repeat(127);
+      expect(await LocaleEditDistance.runQuery(`${head}\u{1f600}`)).toEqual(
+        await LocaleEditDistance.runQuery(head),
+      );
+    });
+
+    it("delivers only the latest of overlapping queries", async () => {
+      const inFlight = LocaleEditDistance.runQuery("a");
+      const coalesced = LocaleEditDistance.runQuery("zz");
+      const latest = LocaleEditDistance.runQuery("a", 3);
+      expect(await coalesced).toBe(null);
+      expect(await inFlight).toBe(null);
+      expect(await latest).toEqual(
+        (await LocaleEditDistance.runQuery("a"))!.slice(0, 3),
+      );
+    });
+
+    it("cancels queries not yet delivered", async () => {
+      const inFlight = LocaleEditDistance.runQuery("a");
+      const pending = LocaleEditDistance.runQuery("zz");
+      LocaleEditDistance.cancelQueries();
+      expect(await pending).toBe(null);
+      expect(await inFlight).toBe(null);
+    });
+
+    it("measures latency and main thread blocking", async () => {
+      performance.clearMeasures(kLocaleSearchMeasure);
+      await LocaleEditDistance.runQuery("a");
+      const [measure] = performance.getEntriesByName(
+        kLocaleSearchMeasure,
+      ) as PerformanceMeasure[];
+      expect(measure.duration).toBeGreaterThanOrEqual(
+        measure.detail.blockingMs,
+      );
+      expect(measure.detail.searchMs).toBeGreaterThanOrEqual(0);
+    });
+  });
+
+  describe("locale table", () => {
+    it("lists known locales in order", () => {
+      localeTable.forEach((tag) => expect(knownLocales).toHaveProperty([tag]));
+      expect([...localeTable].sort(sortLocales)).toEqual(localeTable);
+    });
   });
 });
@@ -1,4 +1,4 @@
-import { describe, expect, it } from "vitest";
+import { describe, expect, it, vi } from "vitest";
 
 import EventBus from "@shared/eventbus";
 import { VisualizerIconEvent } from "@shared/events";
@@ -19,6 +19,30 @@ describe("RadioTimeSignal", () => {
     expect(RadioTimeSignal.state).toBe("idle");
   });
 
+  it("only leaves warm standby upon updateStandby", () => {
+    const stop = vi.spyOn(RadioTimeSignal, "stop").mockImplementation(() => {});
+    const signal = RadioTimeSignal as any;
+
+    RadioTimeSignal.updateStandby(false, "automation");
+    expect(stop).not.toHaveBeenCalled();
+
+    /* Set as the Audio Worklet would upon TSIG_STATE_STANDBY. */
+    signal.state = 8;
+    expect(RadioTimeSignal.state).toBe("standby");
+
+    RadioTimeSignal.updateStandby(true, "worklet");
+    expect(stop).not.toHaveBeenCalled();
+
+    RadioTimeSignal.updateStandby(true, "automation");
+    expect(stop).toHaveBeenCalledTimes(1);
+
+    RadioTimeSignal.updateStandby(false, "worklet");
+    expect(stop).toHaveBeenCalledTimes(2);
+
+    signal.state = 0;
+    stop.mockRestore();
+  });
+
   describe("handles VisualizerIconEvent", () => {
     it("takes canvas element from event data", () => {
       const canvas = document.createElement("canvas");
@@ -4,6 +4,7 @@ import monotonicTime, {
   isEuropeanSummerTime,
   formatTimeZoneOffset,
   decomposeOffset,
+  findTransmitWindow,
 } from "@shared/time";
 
 import { delay } from "@test/utils";
@@ -84,3 +85,62 @@ describe("decomposeOffset", () => {
     });
   });
 });
+
+describe("findTransmitWindow", () => {
+  /* Local time, as windows are in local time. */
+  function ltime(hh: number, mm: number, day = 15) {
+    return new Date(2024, 0, day, hh, mm).getTime();
+  }
+
+  const kMinute = 60 * 1000;
+  const kNightly = [{ startMin: 2 * 60, endMin: 3 * 60 }] as const;
+  const kOvernight = [{ startMin: 23 * 60, endMin: 60 }] as const;
+
+  it("finds when a window begins", () => {
+    expect(findTransmitWindow(kNightly, ltime(1, 30))).toEqual({
+      active: false,
+      ms: 30 * kMinute,
+    });
+    expect(findTransmitWindow(kNightly, ltime(3, 0))).toEqual({
+      active: false,
+      ms: 23 * 60 * kMinute,
+    });
+  });
+
+  it("finds when a window ends", () => {
+    expect(findTransmitWindow(kNightly, ltime(2, 0))).toEqual({
+      active: true,
+      ms: 60 * kMinute,
+    });
+  });
+
+  it("finds windows past midnight", () => {
+    expect(findTransmitWindow(kOvernight, ltime(0, 15))).toEqual({
+      active: true,
+      ms: 45 * kMinute,
+    });
+    expect(findTransmitWindow(kOvernight, ltime(23, 30))).toEqual({
+      active: true,
+      ms: 90 * kMinute,
+    });
+    expect(findTransmitWindow(kOvernight, ltime(12, 0))).toEqual({
+      active: false,
+      ms: 11 * 60 * kMinute,
+    });
+  });
+
+  it("finds the nearest of several windows", () => {
+    const windows = [...kOvernight, ...kNightly];
+    expect(findTransmitWindow(windows, ltime(1, 0))).toEqual({
+      active: false,
+      ms: 60 * kMinute,
+    });
+  });
+
+  it("finds nothing without windows", () => {
+    expect(findTransmitWindow([], ltime(12, 0))).toEqual({
+      active: false,
+      ms: Infinity,
+    });
+  });
+});
@@ -13,6 +13,11 @@ export const TestSettings = {
   offset: -1234,
   dut1: 123,
   noclip: false,
+  engine: "automation",
+  standby: true,
+  schedule: false,
+  scheduleStart: 90,
+  scheduleEnd: 150,
   sync: false,
   dark: false,
   nanny: false,
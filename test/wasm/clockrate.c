@@ -0,0 +1,121 @@
+/**
+ * Native test of the sample clock rate estimator.
+ *
+ * Emulates an audio output device whose sample clock is off by some ppm and
+ * an Audio Worklet thread that processes render quantums with heavy-tailed
+ * scheduling jitter, in bursts, against a clock that may be coarsened (as
+ * with some browsers' timer precision reduction) or stepped (as with NTP).
+ * Checks how quickly and closely the estimate converges to the true error.
+ *
+ * Usage: clockrate
+ *
+ * Exits with a nonzero status if any estimate is outside tolerance.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include "clockrate.h"
+#include "timesignal.h"
+
+#define CLOCKRATE_SECS          1800
+#define CLOCKRATE_SETTLE_SECS   600 /* Estimate must be in tolerance after. */
+#define CLOCKRATE_TOLERANCE_PPB 2000 /* 0.155 Hz at 77.5 kHz. */
+#define CLOCKRATE_BURST         8 /* Max quantums processed back to back. */
+
+static const uint32_t kSampleRates[] = {44100, 48000, 96000, 192000};
+
+static const struct {
+  const char *name;
+  int32_t ppb;
+  double jitter_ms; /** Mean of exponentially distributed jitter. */
+  double grain_ms;  /** Clock precision. */
+  double step_ms;   /** Clock step halfway through, if any. */
+} kScenarios[] = {
+    {"exact", 0, 1.0, 0.0, 0.0},
+    {"fast", 50000, 1.0, 0.0, 0.0},
+    {"slow", -120000, 3.0, 0.0, 0.0},
+    {"coarse", 20000, 1.0, 1.0, 0.0},
+    {"stepped", 35000, 1.0, 0.0, 1000.0},
+    {"jittery", -75000, 8.0, 0.0, -250.0},
+};
+
+/* Deterministic PRNG (xorshift64*), so results are reproducible. */
+static uint64_t rng_state = 0x9e3779b97f4a7c15ULL;
+
+static double rng_uniform() {
+  rng_state ^= rng_state >> 12;
+  rng_state ^= rng_state << 25;
+  rng_state ^= rng_state >> 27;
+  return ((rng_state * 0x2545f4914f6cdd1dULL) >> 11) * 0x1.0p-53;
+}
+
+static int test_scenario(int i, uint32_t sample_rate) {
+  tsig_clockrate_ctx_t ctx = {.sample_rate = sample_rate};
+  double true_rate = sample_rate * (1.0 + kScenarios[i].ppb * 1e-9);
+  double now_base = 1711837061062.5;
+  uint64_t end = (uint64_t)CLOCKRATE_SECS * sample_rate;
+  uint64_t settle = (uint64_t)CLOCKRATE_SETTLE_SECS * sample_rate;
+  uint64_t step = end / 2;
+  int32_t worst = 0;
+  int first_secs = -1;
+  uint64_t burst_end = 0;
+  double burst_now = 0;
+
+  tsig_clockrate_restart(&ctx, 0, now_base);
+
+  for (uint64_t samples = 0; samples < end; samples += TSIG_RENDER_QUANTUM) {
+    /*
+     * Each quantum is processed a fixed output latency (here, 0) before it
+     * is due, plus jitter. Sometimes a few are processed back to back.
+     */
+    double now = now_base + 1000.0 * samples / true_rate;
+    now += -log(1.0 - rng_uniform()) * kScenarios[i].jitter_ms;
+    if (samples < burst_end) {
+      now = burst_now;
+    } else if (rng_uniform() < 0.05) {
+      burst_end = samples + TSIG_RENDER_QUANTUM * (uint64_t)(
+                                rng_uniform() * CLOCKRATE_BURST);
+      burst_now = now;
+    }
+
+    if (samples >= step)
+      now += kScenarios[i].step_ms;
+    if (kScenarios[i].grain_ms)
+      now = floor(now / kScenarios[i].grain_ms) * kScenarios[i].grain_ms;
+
+    if (!tsig_clockrate_update(&ctx, samples, now))
+      continue;
+
+    int32_t err = ctx.ppb - kScenarios[i].ppb;
+    if (first_secs < 0)
+      first_secs = samples / sample_rate;
+    if (samples >= settle && abs(err) > abs(worst))
+      worst = err;
+  }
+
+  uint8_t failed = first_secs < 0 || abs(worst) > CLOCKRATE_TOLERANCE_PPB;
+  printf("%-8s %6u %10.3f %10.3f %11d %14.3f%s\n", kScenarios[i].name,
+         sample_rate, kScenarios[i].ppb / 1e3, ctx.ppb / 1e3, first_secs,
+         worst / 1e3, failed ? "  FAIL" : "");
+
+  return failed;
+}
+
+int main() {
+  int n_scenarios = sizeof(kScenarios) / sizeof(*kScenarios);
+  int n_rates = sizeof(kSampleRates) / sizeof(*kSampleRates);
+  int failures = 0;
+
+  printf("%-8s %6s %10s %10s %11s %14s\n", "", "rate", "true_ppm", "final_ppm",
+         "first_secs", "worst_err_ppm");
+
+  for (int i = 0; i < n_scenarios; i++)
+    for (int j = 0; j < n_rates; j++)
+      failures += test_scenario(i, kSampleRates[j]);
+
+  printf("%s\n", failures ? "FAILED" : "PASSED");
+
+  return failures ? 1 : 0;
+}
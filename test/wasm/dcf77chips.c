@@ -0,0 +1,104 @@
+/**
+ * Native check of the DCF77 phase chip sequence and its data bits.
+ *
+ * Checks that the chip table holds a maximal-length sequence followed by a 0
+ * chip and then zeros, and that for minutes spread across a few years, the
+ * phase chips of each frame carry the same bits as its amplitude code and
+ * that no frame, DCF77's being the longest of any station, comes near to
+ * filling its edges.
+ *
+ * Usage: dcf77chips
+ *
+ * Exits with a nonzero status if the table or any frame is wrong.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include "waveform.h"
+
+#define CHECK_STEP_MINS 7919 /* Prime, so every minute of the hour is hit. */
+
+double tsig_native_now;
+
+static int check_table() {
+  int8_t *table = TSIG_WAVEFORM_DCF77_CHIP_TABLE;
+  int period = TSIG_WAVEFORM_DCF77_CHIPS - 1;
+  int stages = TSIG_WAVEFORM_DCF77_LFSR_STAGES;
+  uint8_t seen[1 << TSIG_WAVEFORM_DCF77_LFSR_STAGES] = {0};
+  int failures = 0, ones = 0;
+
+  /* Every nonzero state of the register occurs exactly once per period. */
+  for (int i = 0; i < period; i++) {
+    int window = 0;
+    for (int j = 0; j < stages; j++)
+      window = (window << 1) | (table[(i + j) % period] < 0);
+    failures += !window || seen[window]++;
+    ones += table[i] < 0;
+  }
+
+  failures += ones != (period + 1) / 2;
+  failures += table[period] != 1;
+  for (int i = TSIG_WAVEFORM_DCF77_CHIPS; i < TSIG_WAVEFORM_CHIP_TABLE_LEN; i++)
+    failures += table[i] != 0;
+
+  if (failures)
+    printf("Chip table: %d error(s)\n", failures);
+
+  return !!failures;
+}
+
+static int max_len;
+
+static int check_minute(double timestamp) {
+  static tsig_waveform_frame_t frame;
+  tsig_datetime_t datetime = tsig_datetime_parse_timestamp(timestamp);
+  tsig_params_t params = {.station = TSIG_STATION_DCF77};
+  int failures = 0;
+
+  tsig_waveform_gen_frame(&frame, datetime, &params);
+  failures += frame.len >= TSIG_WAVEFORM_MAX_EDGES || frame.overflowed;
+  max_len = tsig_max(max_len, frame.len);
+
+  /*
+   * A 1 is low from 100 to 200 ms, and the minute marker is never low. The
+   * chips from 200 ms are inverted for a 1, and only they are.
+   */
+  for (int sec = 0; sec < 60; sec++) {
+    uint32_t us = 1000000 * sec;
+    tsig_waveform_edge_t *am = &frame.edges[tsig_waveform_find_edge(
+        &frame, us + 150000)];
+    tsig_waveform_edge_t *pm = &frame.edges[tsig_waveform_find_edge(
+        &frame, us + 250000)];
+    uint8_t am_bit = am->level == TSIG_WAVEFORM_LEVEL_LOW;
+    uint8_t pm_bit = pm->phase & TSIG_WAVEFORM_PHASE_INVERTED;
+    failures += am_bit != pm_bit;
+    failures += !!(am->phase & TSIG_WAVEFORM_PHASE_SPREAD);
+    failures += !(pm->phase & TSIG_WAVEFORM_PHASE_SPREAD);
+  }
+
+  if (failures)
+    printf("%04u-%03u %02u:%02u: %d error(s)\n", datetime.year, datetime.doy,
+           datetime.hour, datetime.min, failures);
+
+  return !!failures;
+}
+
+int main() {
+  double start = 1704067200000.0; /* 2024-01-01T00:00Z */
+  double end = 1830297600000.0;   /* 2028-01-01T00:00Z */
+  int frames = 0, failures = 0;
+
+  tsig_init_chips_dcf77();
+  failures += check_table();
+
+  for (double ms = start; ms < end; ms += CHECK_STEP_MINS * 60000.0) {
+    failures += check_minute(ms);
+    frames++;
+  }
+
+  printf("Checked %d frames, the longest with %d of %d edges\n", frames,
+         max_len, TSIG_WAVEFORM_MAX_EDGES);
+  printf("%s\n", failures ? "FAILED" : "PASSED");
+
+  return failures ? 1 : 0;
+}
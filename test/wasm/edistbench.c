@@ -0,0 +1,401 @@
+/**
+ * Native benchmark of batch edit distance queries.
+ *
+ * Adds every locale in the locale table to the edit distance module, a few
+ * user locales with surrogate pairs or long names, and then aliases of known
+ * locales by random names until the module is full, checking that each is
+ * numbered in turn and that a locale too long or too many is refused without
+ * a number. Then runs random queries of every length from 1 to 40 code
+ * units. Each is run by scoring every locale
+ * EDIST_LANES strings at once, by calling edist_osa() on one string at a time
+ * as a reference, and by edist_run() for the best few. The module's
+ * state is forgotten before each query, so that every one is evaluated from
+ * scratch (see typingbench for queries typed a code point at a time). Runs are
+ * repeated and the fastest of each is kept, to filter out scheduling and
+ * frequency scaling noise.
+ *
+ * Built natively, lanes use whatever vector instructions the host compiler
+ * picks for its baseline target, so the speedup only roughly predicts that
+ * of the Wasm SIMD build.
+ *
+ * Usage: edistbench [QUERIES]
+ *
+ * QUERIES is the count of random queries of each length (default: 20).
+ * Exits with a nonzero status if the two ever disagree about a score, or if
+ * the best few are not those scores' best among locales that contain the
+ * query outright, if any, ties going to the lower index.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+#include <uchar.h>
+#include "editdistance.c"
+
+#define BENCH_REPS     5
+#define BENCH_TOP_K    10
+#define BENCH_NAME_LEN 24 /* Longest random alias name, in code units. */
+
+/* Letters and punctuation as in folded locale tags and display names. */
+static const uint16_t kAlphabet[] = {
+    'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',
+    'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z', ' ', '(',
+    ')', ',', 0x00e6, 0x00f8, 0x0430, 0x043a, 0x4e2d, 0x6587, 0xd83d,
+};
+
+/*
+ * Loaded after the locale table, already folded so that they are kept as
+ * is. 0xd83d starts each pair, and no name in the table is as long as the
+ * last.
+ */
+static const struct {
+  const char16_t *tag;
+  const char16_t *name;
+} kUserLocales[] = {
+    {u"qv-\U0001f596", u"\U0001f596 (vulcan)"},
+    {u"qg-\U0001f600-qq", u"grinning \U0001f600\U0001f596"},
+    {u"ql-latn-qq", u"longer than any display name in the locale table"},
+};
+
+/* The user locales, as code points with any fake script subtag inserted. */
+static struct {
+  uint32_t tag[EDIST_MAX_STRING_LEN];
+  uint32_t name[EDIST_MAX_STRING_LEN];
+  uint8_t tag_len, fake_at, name_len;
+} bench_users[EDIST_MAX_LOCALES - EDIST_TABLE_LOCALES];
+
+static double bench_now_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* Fills `s` with code points, some of them surrogate pairs. */
+static void bench_random_string(uint16_t s[], uint8_t len, unsigned *seed) {
+  for (uint8_t i = 0; i < len; i++) {
+    s[i] = kAlphabet[rand_r(seed) % (sizeof(kAlphabet) / sizeof(*kAlphabet))];
+    if (s[i] != 0xd83d)
+      continue;
+    if (i + 1 == len)
+      s[i] = 'a';
+    else
+      s[++i] = rand_r(seed) % 2 ? 0xdd96 : 0xde00;
+  }
+}
+
+/* Decodes UTF-16 into code points, returning the count of code points. */
+static uint8_t bench_decode(const uint16_t s[], uint8_t len, uint32_t out[]) {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < len; i++) {
+    out[n] = s[i];
+    if (s[i] >= 0xd800 && s[i] < 0xdc00 && i + 1 < len && s[i + 1] >= 0xdc00 &&
+        s[i + 1] < 0xe000)
+      out[n] = 0x10000 + ((out[n] - 0xd800) << 10) + (s[++i] - 0xdc00);
+    n++;
+  }
+  return n;
+}
+
+/* Encodes code points as UTF-16, returning the count of code units. */
+static uint8_t bench_encode(const uint32_t p[], uint8_t len, uint16_t out[]) {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < len; i++) {
+    if (p[i] < 0x10000) {
+      out[n++] = p[i];
+      continue;
+    }
+    out[n++] = 0xd800 + ((p[i] - 0x10000) >> 10);
+    out[n++] = 0xdc00 + ((p[i] - 0x10000) & 0x3ff);
+  }
+  return n;
+}
+
+/*
+ * Loads a user locale, keeping its code points for the reference. Returns 1 if
+ * it is not numbered next, or if it was refused and should not have been.
+ */
+static int bench_load_user(const uint16_t *tag, uint8_t tag_len,
+                           const uint16_t *name, uint8_t name_len) {
+  uint8_t *buf = edist_get_buf_ptr();
+  int u = edist_ctx.count - EDIST_TABLE_LOCALES;
+  uint8_t hyphens = 0;
+
+  for (uint8_t i = 0; i < tag_len; i++)
+    hyphens += tag[i] == '-';
+  memcpy(buf, tag, tag_len * sizeof(*tag));
+  memcpy(&buf[tag_len * sizeof(*tag)], name, name_len * sizeof(*name));
+  if (edist_load_locale(tag_len, name_len) != edist_ctx.count - 1 ||
+      edist_ctx.count != EDIST_TABLE_LOCALES + u + 1)
+    return 1;
+
+  uint32_t points[EDIST_MAX_STRING_LEN];
+  uint8_t len = bench_decode(tag, tag_len, points);
+  for (uint8_t i = 0; i < len; i++) {
+    bench_users[u].tag[bench_users[u].tag_len++] = points[i];
+    if (points[i] == '-' && hyphens < 2 && !bench_users[u].fake_at) {
+      bench_users[u].fake_at = i + 1;
+      memcpy(&bench_users[u].tag[i + 1], U"\0\0\0\0-",
+             EDIST_FAKE_SUBTAG_LEN * sizeof(*points));
+      bench_users[u].tag_len += EDIST_FAKE_SUBTAG_LEN;
+    }
+  }
+  bench_users[u].name_len = bench_decode(name, name_len, bench_users[u].name);
+  return 0;
+}
+
+/* Whether loading a locale is refused, leaving the count as it was. */
+static int bench_refused(const char16_t *tag, const char16_t *name) {
+  uint8_t *buf = edist_get_buf_ptr();
+  uint8_t tag_len = 0, name_len = 0;
+  uint16_t count = edist_ctx.count;
+
+  while (tag[tag_len])
+    tag_len++;
+  while (name[name_len])
+    name_len++;
+  memcpy(buf, tag, tag_len * sizeof(*tag));
+  memcpy(&buf[tag_len * sizeof(*tag)], name, name_len * sizeof(*name));
+  return edist_load_locale(tag_len, name_len) == EDIST_NO_LOCALE &&
+         edist_ctx.count == count;
+}
+
+/*
+ * Loads the user locales, then aliases of known locales by random names
+ * until the module is full. Returns the count of locales misnumbered, or
+ * refused or not as they should be.
+ */
+static int bench_load_users(unsigned *seed) {
+  int failures = 0;
+
+  for (uint8_t u = 0; u < sizeof(kUserLocales) / sizeof(*kUserLocales); u++) {
+    const char16_t *tag = kUserLocales[u].tag, *name = kUserLocales[u].name;
+    uint8_t tag_len = 0, name_len = 0;
+
+    while (tag[tag_len])
+      tag_len++;
+    while (name[name_len])
+      name_len++;
+    failures += bench_load_user((const uint16_t *)tag, tag_len,
+                                (const uint16_t *)name, name_len);
+  }
+
+  /* Forty Hangul syllables fold to more jamo than a string may have. */
+  failures += !bench_refused(u"ko-KR", u"가나다라마바사아자차카타파하가나다라마바"
+                                       u"사아자차카타파하가나다라마바사아자차카타");
+
+  while (edist_ctx.count < EDIST_MAX_LOCALES) {
+    edist_locale_t *known = &edist_ctx.locales[edist_ctx.count %
+                                               EDIST_TABLE_LOCALES];
+    uint32_t plain[EDIST_MAX_STRING_LEN];
+    uint16_t tag[2 * EDIST_MAX_STRING_LEN], name[BENCH_NAME_LEN];
+    uint8_t tag_len = bench_encode(plain, edist_plain_tag(known, plain), tag);
+    uint8_t name_len = 1 + rand_r(seed) % BENCH_NAME_LEN;
+
+    bench_random_string(name, name_len, seed);
+    if (bench_load_user(tag, tag_len, name, name_len)) {
+      printf("Alias %d refused or misnumbered\n", edist_ctx.count);
+      return failures + 1;
+    }
+  }
+
+  failures += !bench_refused(u"qx", u"one too many");
+  failures += edist_add_locale(0) != EDIST_NO_LOCALE;
+  return failures;
+}
+
+/* Gets locale `i` as code points, as it was added or loaded. */
+static void bench_locale(int i, const uint32_t **tag, uint8_t *tag_len,
+                         uint8_t *fake_at, const uint32_t **name,
+                         uint8_t *name_len) {
+  edist_locale_t *locale = &edist_ctx.locales[i];
+  if (i >= EDIST_TABLE_LOCALES) {
+    i -= EDIST_TABLE_LOCALES;
+    *tag = bench_users[i].tag, *tag_len = bench_users[i].tag_len;
+    *fake_at = bench_users[i].fake_at;
+    *name = bench_users[i].name, *name_len = bench_users[i].name_len;
+    return;
+  }
+  *tag = edist_text(locale->tag), *tag_len = locale->tag_len;
+  *fake_at = locale->fake_at;
+  *name = edist_text(locale->name), *name_len = locale->name_len;
+}
+
+/* Scores every locale one string at a time, into `out`. */
+static void bench_run_scalar(uint16_t query[], uint8_t len, uint8_t out[]) {
+  uint32_t points[EDIST_MAX_CODE_UNITS];
+  uint8_t query_len = bench_decode(query, len, points);
+
+  for (int i = 0; i < edist_ctx.count; i++) {
+    const uint32_t *tag, *name;
+    uint8_t tag_len, fake_at, name_len;
+    bench_locale(i, &tag, &tag_len, &fake_at, &name, &name_len);
+
+    uint8_t tag_score = edist_osa(points, query_len, (uint32_t *)tag, tag_len);
+    uint8_t name_score = edist_osa(points, query_len, (uint32_t *)name,
+                                   name_len);
+    out[i] = edist_min(tag_score, name_score);
+  }
+}
+
+/* Whether `s`, less any fake script subtag at `fake_at`, contains `query`. */
+static uint8_t bench_contains(const uint32_t *s, uint8_t s_len, uint8_t fake_at,
+                              uint32_t query[], uint8_t len) {
+  uint32_t t[EDIST_MAX_STRING_LEN];
+  uint8_t t_len = 0;
+
+  for (uint8_t i = 0; i < s_len; i++)
+    if (!fake_at || i < fake_at || i >= fake_at + EDIST_FAKE_SUBTAG_LEN)
+      t[t_len++] = s[i];
+
+  for (int i = 0; i + len <= t_len; i++) {
+    int j = 0;
+    while (j < len && t[i + j] == query[j])
+      j++;
+    if (j == len)
+      return 1;
+  }
+  return 0;
+}
+
+/* Ranks scores as edist_run() must, returning the count ranked. */
+static uint16_t bench_rank(uint16_t query[], uint8_t len, uint8_t scores[],
+                           uint16_t k, uint16_t out[]) {
+  uint8_t cands[EDIST_MAX_LOCALES], any = 0;
+  uint32_t points[EDIST_MAX_CODE_UNITS];
+  uint8_t points_len = bench_decode(query, len, points);
+  uint16_t n = 0;
+
+  for (int i = 0; i < edist_ctx.count; i++) {
+    const uint32_t *tag, *name;
+    uint8_t tag_len, fake_at, name_len;
+    bench_locale(i, &tag, &tag_len, &fake_at, &name, &name_len);
+    cands[i] = bench_contains(name, name_len, 0, points, points_len) ||
+               bench_contains(tag, tag_len, fake_at, points, points_len);
+    any |= cands[i];
+  }
+
+  for (uint16_t score = 0; score <= UINT8_MAX && n < k; score++)
+    for (int i = 0; i < edist_ctx.count && n < k; i++)
+      if (scores[i] == score && (cands[i] || !any))
+        out[n++] = i;
+
+  return n;
+}
+
+int main(int argc, char *argv[]) {
+  int queries = argc > 1 ? atoi(argv[1]) : 20;
+  if (queries < 1) {
+    fprintf(stderr, "usage: %s [QUERIES]\n", argv[0]);
+    return 2;
+  }
+
+  static uint8_t all[EDIST_MASK_SIZE];
+  static uint16_t query_sets[EDIST_MAX_CODE_UNITS + 1][1000]
+                            [EDIST_MAX_CODE_UNITS];
+  double best_scalar_ns[EDIST_MAX_CODE_UNITS + 1];
+  double best_batch_ns[EDIST_MAX_CODE_UNITS + 1];
+  double best_top_k_ns[EDIST_MAX_CODE_UNITS + 1];
+  uint8_t scalar[EDIST_MAX_LOCALES], batch[EDIST_MAX_LOCALES];
+  uint16_t ranked[BENCH_TOP_K];
+  uint64_t mismatches = 0, checksum = 0;
+  unsigned seed = 1;
+
+  if (queries > 1000)
+    queries = 1000;
+
+  edist_reset();
+  for (int i = 0; i < EDIST_TABLE_LOCALES; i++)
+    mismatches += edist_add_locale(i) != i;
+  mismatches += bench_load_users(&seed);
+  for (int i = 0; i < edist_ctx.count; i++)
+    all[i / 8] |= 1 << (i % 8);
+  for (uint8_t len = 1; len <= EDIST_MAX_CODE_UNITS; len++) {
+    best_scalar_ns[len] = best_batch_ns[len] = INFINITY;
+    best_top_k_ns[len] = INFINITY;
+    for (int q = 0; q < queries; q++)
+      bench_random_string(query_sets[len][q], len, &seed);
+  }
+
+  for (int rep = 0; rep < BENCH_REPS; rep++) {
+    for (uint8_t len = 1; len <= EDIST_MAX_CODE_UNITS; len++) {
+      double start_ns = bench_now_ns();
+      for (int q = 0; q < queries; q++) {
+        bench_run_scalar(query_sets[len][q], len, scalar);
+        checksum += scalar[q % EDIST_MAX_LOCALES];
+      }
+      double ns = (bench_now_ns() - start_ns) / queries;
+      best_scalar_ns[len] = fmin(best_scalar_ns[len], ns);
+
+      ns = 0;
+      for (int q = 0; q < queries; q++) {
+        uint16_t *query = query_sets[len][q];
+        uint32_t points[EDIST_MAX_CODE_UNITS];
+        uint64_t scripts;
+
+        start_ns = bench_now_ns();
+        edist_forget();
+        uint8_t query_len = edist_fold(query, len, points,
+                                       EDIST_MAX_CODE_UNITS, &scripts);
+        edist_set_prefix(points, query_len);
+        for (int i = 0; i < edist_ctx.count; i += EDIST_LANES / 2) {
+          const uint8_t *dists = edist_sync(2 * i / EDIST_LANES);
+          for (int lane = 0; lane < EDIST_LANES; lane += 2)
+            batch[i + lane / 2] = edist_min(dists[lane], dists[lane + 1]);
+        }
+        ns += bench_now_ns() - start_ns;
+
+        /* Checked outside the timed region, a query at a time. */
+        if (!rep) {
+          bench_run_scalar(query, len, scalar);
+          mismatches += memcmp(batch, scalar, edist_ctx.count) != 0;
+        }
+        checksum += batch[q % edist_ctx.count];
+      }
+      best_batch_ns[len] = fmin(best_batch_ns[len], ns / queries);
+
+      ns = 0;
+      for (int q = 0; q < queries; q++) {
+        uint8_t *buf = edist_get_buf_ptr();
+        uint32_t points[EDIST_MAX_CODE_UNITS];
+        uint64_t scripts;
+
+        /* Every locale, rather than those in the query's scripts. */
+        start_ns = bench_now_ns();
+        edist_forget();
+        uint8_t query_len = edist_fold(query_sets[len][q], len, points,
+                                       EDIST_MAX_CODE_UNITS, &scripts);
+        uint16_t k = edist_run(points, query_len, all, BENCH_TOP_K);
+        ns += bench_now_ns() - start_ns;
+
+        if (!rep) {
+          uint16_t *query = query_sets[len][q];
+          bench_run_scalar(query, len, scalar);
+          mismatches += k != bench_rank(query, len, scalar, BENCH_TOP_K,
+                                        ranked) ||
+                        memcmp(buf, ranked, k * sizeof(*ranked)) != 0;
+        }
+        checksum += buf[0];
+      }
+      best_top_k_ns[len] = fmin(best_top_k_ns[len], ns / queries);
+    }
+  }
+
+  printf("%d locales, %d queries per length, %d lanes, top %d.\n\n",
+         edist_ctx.count, queries, EDIST_LANES, BENCH_TOP_K);
+  printf("%6s %11s %11s %8s %11s %8s\n", "length", "scalar_us", "batch_us",
+         "speedup", "top_k_us", "speedup");
+  for (uint8_t len = 1; len <= EDIST_MAX_CODE_UNITS; len++)
+    printf("%6u %11.2f %11.2f %7.2fx %11.2f %7.2fx\n", len,
+           best_scalar_ns[len] / 1000.0, best_batch_ns[len] / 1000.0,
+           best_scalar_ns[len] / best_batch_ns[len],
+           best_top_k_ns[len] / 1000.0,
+           best_scalar_ns[len] / best_top_k_ns[len]);
+
+  printf("\nMismatched queries %llu, checksum %llu\n",
+         (unsigned long long)mismatches, (unsigned long long)checksum);
+  printf("%s\n", mismatches ? "FAILED" : "PASSED");
+
+  return mismatches ? 1 : 0;
+}
@@ -0,0 +1,148 @@
+/**
+ * Native check of case folding and script detection in the edit distance
+ * module.
+ *
+ * Folds strings with known results, as foldUnicodeString() and
+ * findScriptsInString() from src/shared/strings.ts were tested before the
+ * module took them over, then checks that every tag and display name in the
+ * locale table folds to itself from UTF-16, as scripts/localetable.py
+ * folded it, that astral code points are kept apart, and that every Hangul
+ * syllable decomposes into jamo.
+ *
+ * Usage: foldcheck
+ *
+ * Exits with a nonzero status if any string folds or is detected wrong.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <uchar.h>
+#include "editdistance.c"
+
+/* Script numbers, in the order of SCRIPT_RANGES in casefoldingmap.py. */
+#define FOLD_CJK         (1ULL << 4)
+#define FOLD_GREEK       (1ULL << 9)
+#define FOLD_HANGUL      (1ULL << 12)
+#define FOLD_LATIN       (1ULL << 19)
+#define FOLD_LATIN_1_SUP (1ULL << 20)
+#define FOLD_LATIN_EXT_A (1ULL << 21)
+#define FOLD_LATIN_EXT_B (1ULL << 22)
+
+static const struct {
+  const char16_t *s;
+  const char32_t *folded;
+  uint64_t scripts;
+} kCases[] = {
+    {u"", U"", 0},
+    {u"English", U"english", FOLD_LATIN},
+    {u"héLlÖ", U"hello", FOLD_LATIN | FOLD_LATIN_1_SUP},
+    {u"ŉŘꞍＣ", U"ʼnrɥｃ", FOLD_LATIN_EXT_A},
+    {u"hi", U"hi", FOLD_LATIN},
+    {u"ㅁ", U"ㅁ", FOLD_HANGUL},
+    {u"ᾕ", U"ηι", FOLD_GREEK},
+    {u"Ɣ", U"ɣ", FOLD_LATIN_EXT_B},
+    {u"中Ω", U"中ω", FOLD_CJK | FOLD_GREEK},
+    {u"한국어", U"\u1112\u1161\u11ab\u1100\u116e\u11a8\u110b\u1165",
+     FOLD_HANGUL},
+    {u"\U00010400", U"\U00010428", 0},
+    {u"\U0001f596\U0001f600", U"\U0001f596\U0001f600", 0},
+    {u"\xdc00\xd800" "a", U"\xdc00\xd800" "a", FOLD_LATIN},
+};
+
+static size_t fold_units(const char16_t *s) {
+  size_t n = 0;
+  while (s[n])
+    n++;
+  return n;
+}
+
+static size_t fold_points(const char32_t *s) {
+  size_t n = 0;
+  while (s[n])
+    n++;
+  return n;
+}
+
+/* Encodes code points as UTF-16, returning the count of code units. */
+static uint8_t fold_encode(const uint32_t *p, uint8_t len, uint16_t out[]) {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < len; i++) {
+    if (p[i] < 0x10000) {
+      out[n++] = p[i];
+      continue;
+    }
+    out[n++] = EDIST_UTF16_MIN_SURROGATE + ((p[i] - 0x10000) >> 10);
+    out[n++] = 0xdc00 + ((p[i] - 0x10000) & 0x3ff);
+  }
+  return n;
+}
+
+/* Checks one case, returning 1 if it fails. */
+static int fold_check(const char16_t *s, const char32_t *expected,
+                      uint64_t expected_scripts) {
+  uint32_t out[EDIST_MAX_STRING_LEN];
+  uint64_t scripts;
+  uint8_t len = edist_fold((const uint16_t *)s, fold_units(s), out,
+                           EDIST_MAX_STRING_LEN, &scripts);
+
+  if (len == fold_points(expected) &&
+      !memcmp(out, expected, len * sizeof(*out)) &&
+      scripts == expected_scripts)
+    return 0;
+
+  printf("Folded wrong:");
+  for (size_t i = 0; s[i]; i++)
+    printf(" %04x", s[i]);
+  printf(" (scripts %llx)\n", (unsigned long long)scripts);
+  return 1;
+}
+
+int main() {
+  int failures = 0;
+
+  for (size_t i = 0; i < sizeof(kCases) / sizeof(*kCases); i++)
+    failures += fold_check(kCases[i].s, kCases[i].folded, kCases[i].scripts);
+
+  /* Every astral code point that folds to itself stays its own. */
+  uint64_t scripts;
+  for (uint32_t c = 0x1f300; c < 0x1f700; c++) {
+    uint16_t pair[2] = {EDIST_UTF16_MIN_SURROGATE + ((c - 0x10000) >> 10),
+                        0xdc00 + ((c - 0x10000) & 0x3ff)};
+    uint32_t out[EDIST_MAX_FOLD_LEN];
+    failures += edist_fold(pair, 2, out, EDIST_MAX_FOLD_LEN, &scripts) != 1 ||
+                out[0] != c;
+  }
+
+  for (int i = 0; i < EDIST_TABLE_LOCALES; i++) {
+    const edist_table_locale_t *entry = &kEdistTable[i];
+    const uint32_t *tag = &kEdistTablePool[entry->tag];
+    const uint32_t *name = &kEdistTablePool[entry->name];
+    uint16_t units[2 * EDIST_MAX_STRING_LEN];
+    uint32_t folded[EDIST_MAX_STRING_LEN];
+    uint8_t n;
+
+    n = fold_encode(tag, entry->tag_len, units);
+    failures += edist_fold(units, n, folded, EDIST_MAX_STRING_LEN,
+                           &scripts) != entry->tag_len ||
+                memcmp(folded, tag, entry->tag_len * sizeof(*tag)) != 0;
+    n = fold_encode(name, entry->name_len, units);
+    failures += edist_fold(units, n, folded, EDIST_MAX_STRING_LEN,
+                           &scripts) != entry->name_len ||
+                memcmp(folded, name, entry->name_len * sizeof(*name)) != 0;
+  }
+
+  for (uint32_t c = EDIST_HANGUL_FIRST;
+       c < EDIST_HANGUL_FIRST + EDIST_HANGUL_COUNT; c++) {
+    uint32_t jamo[EDIST_MAX_FOLD_LEN];
+    uint8_t n = edist_fold_point(c, jamo);
+    uint32_t recomposed = EDIST_HANGUL_FIRST +
+                          ((jamo[0] - 0x1100) * 21 + jamo[1] - 0x1161) * 28 +
+                          (n == 3 ? jamo[2] - 0x11a7 : 0);
+    failures += recomposed != c || (n == 3 && jamo[2] == 0x11a7);
+  }
+
+  printf("Failures %d\n", failures);
+  printf("%s\n", failures ? "FAILED" : "PASSED");
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,169 @@
+/**
+ * Native test of gain ramps and fades against the envelopes they replaced.
+ *
+ * Renders every station through a fade in, some transmission, and a fade out,
+ * with gain interpolation on and off, alongside a reference renderer that
+ * computes the interpolation and the fade sample by sample, as the waveform
+ * generator used to, rather than looking them up. The fade scales the
+ * interpolated gain. Quantization is made negligibly fine in both, so that
+ * samples differ only as much as their gains.
+ *
+ * Usage: gainramps [SECS]
+ *
+ * SECS is the length of transmission between fades (default: 90).
+ * Exits with a nonzero status if any sample differs by more than tolerance,
+ * if the two renderers ever disagree about state, or if the lerp table is not
+ * exactly long enough for a full-scale change.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include "waveform.h"
+
+#define RAMPS_SCALE     (1 << 24)
+#define RAMPS_TOLERANCE 1e-5
+
+double tsig_native_now;
+
+static const uint32_t kSampleRates[] = {44100, 48000, 96000, 192000};
+
+static const struct {
+  const char *name;
+  uint8_t station;
+  uint8_t jjy_khz;
+} kConfigs[] = {
+    {"BPC", TSIG_STATION_BPC, TSIG_JJYKHZ_40},
+    {"DCF77", TSIG_STATION_DCF77, TSIG_JJYKHZ_40},
+    {"JJY40", TSIG_STATION_JJY, TSIG_JJYKHZ_40},
+    {"MSF", TSIG_STATION_MSF, TSIG_JJYKHZ_40},
+    {"WWVB", TSIG_STATION_WWVB, TSIG_JJYKHZ_40},
+};
+
+/* Gain interpolation as it was, frozen here. */
+static inline float ramps_ref_lerp(float target_gain, float gain) {
+  return fabsf(target_gain - gain) > 0.005F
+             ? (1.0F - 0.015F) * gain + 0.015F * target_gain
+             : target_gain;
+}
+
+/* Render a quantum sample by sample, computing each gain and fade. */
+static void ramps_ref_generate(tsig_waveform_ctx_t *ctx, tsig_params_t *params,
+                               int state, int *out_next_state, float *out) {
+  double steps = ctx->max_fade_gain;
+
+  for (int i = 0; i < TSIG_RENDER_QUANTUM; i++) {
+    if (ctx->samples == ctx->next_edge)
+      tsig_waveform_update_edge(ctx, params);
+
+    if (state == TSIG_STATE_FADE_IN && ctx->fade_gain == ctx->max_fade_gain)
+      *out_next_state = TSIG_STATE_RUNNING;
+    else if (state == TSIG_STATE_FADE_OUT && !ctx->fade_gain)
+      *out_next_state = TSIG_STATE_SUSPEND;
+
+    float target_gain = tsig_waveform_level(ctx, params);
+    float fade = (double)ctx->fade_gain * ctx->fade_gain / (steps * steps);
+    ctx->gain =
+        params->noclip ? ramps_ref_lerp(target_gain, ctx->gain) : target_gain;
+
+    out[i] = tsig_gen_sample(ctx, ctx->phase, ctx->chip_phase,
+                             ctx->gain * fade);
+
+    ctx->phase += ctx->phase_delta;
+    ctx->chip_phase += ctx->chip_delta;
+    ctx->samples++;
+
+    if (state == TSIG_STATE_FADE_IN && ctx->fade_gain < ctx->max_fade_gain)
+      ctx->fade_gain++;
+    else if (state == TSIG_STATE_FADE_OUT && ctx->fade_gain)
+      ctx->fade_gain--;
+  }
+}
+
+static int test_config(int i, uint32_t sample_rate, uint8_t noclip, int secs) {
+  static tsig_waveform_ctx_t ctx, ref;
+  static float buf[TSIG_RENDER_QUANTUM], ref_buf[TSIG_RENDER_QUANTUM];
+  tsig_params_t params = {
+      .station = kConfigs[i].station,
+      .jjy_khz = kConfigs[i].jjy_khz,
+      .noclip = noclip,
+  };
+  AudioSampleFrame output = {.numberOfChannels = 1, .data = buf};
+  uint64_t run_quantums = (uint64_t)secs * sample_rate / TSIG_RENDER_QUANTUM;
+  int state = TSIG_STATE_FADE_IN, ref_state = state;
+  uint64_t quantums = 0, diverged = 0;
+  double max_err = 0;
+
+  ctx = (tsig_waveform_ctx_t){.sample_rate = sample_rate};
+  tsig_waveform_init(&ctx, &params,
+                     tsig_waveform_choose_synth(&params, sample_rate));
+  ctx.scale = RAMPS_SCALE;
+  ref = ctx;
+
+  while (state != TSIG_STATE_SUSPEND || ref_state != TSIG_STATE_SUSPEND) {
+    int next_state = state, ref_next_state = ref_state;
+
+    tsig_waveform_generate(&ctx, &params, state, &next_state, 1, &output);
+    ramps_ref_generate(&ref, &params, ref_state, &ref_next_state, ref_buf);
+
+    for (int j = 0; j < TSIG_RENDER_QUANTUM; j++)
+      max_err = fmax(max_err, fabs(buf[j] - ref_buf[j]));
+
+    state = next_state;
+    ref_state = ref_next_state;
+    diverged += state != ref_state;
+    quantums++;
+
+    /* Fade out after transmitting for a while. */
+    if (state == TSIG_STATE_RUNNING && ref_state == TSIG_STATE_RUNNING &&
+        quantums >= run_quantums)
+      state = ref_state = TSIG_STATE_FADE_OUT;
+
+    if (diverged > 1 || quantums > 2 * run_quantums + sample_rate)
+      break;
+  }
+
+  uint8_t failed = diverged || state != TSIG_STATE_SUSPEND ||
+                   !(max_err <= RAMPS_TOLERANCE);
+  printf("%-6s %6u %6u %10.3e%s\n", kConfigs[i].name, sample_rate, noclip,
+         max_err, failed ? "  FAIL" : "");
+
+  return failed;
+}
+
+int main(int argc, char *argv[]) {
+  int secs = argc > 1 ? atoi(argv[1]) : 90;
+  if (secs < 1) {
+    fprintf(stderr, "usage: %s [SECS]\n", argv[0]);
+    return 2;
+  }
+
+  int n_configs = sizeof(kConfigs) / sizeof(*kConfigs);
+  int n_rates = sizeof(kSampleRates) / sizeof(*kSampleRates);
+  int failures = 0;
+
+  /* Saturday, March 30, 2024 22:17:41.0625 UTC */
+  tsig_native_now = 1711837061062.5;
+
+  printf("Transmitting %d s between fades, tolerance %.0e.\n\n", secs,
+         RAMPS_TOLERANCE);
+  printf("%-6s %6s %6s %10s\n", "", "rate", "noclip", "max_err");
+
+  for (int i = 0; i < n_configs; i++)
+    for (int j = 0; j < n_rates; j++)
+      for (uint8_t noclip = 0; noclip <= 1; noclip++)
+        failures += test_config(i, kSampleRates[j], noclip, secs);
+
+  /* The tables were filled by the first choice of synthesis. */
+  float *decay = TSIG_WAVEFORM_LERP_TABLE;
+  if (decay[TSIG_WAVEFORM_LERP_STEPS] > TSIG_WAVEFORM_LERP_MIN_DELTA ||
+      decay[TSIG_WAVEFORM_LERP_STEPS - 1] <= TSIG_WAVEFORM_LERP_MIN_DELTA) {
+    printf("Lerp table length %d is wrong\n", TSIG_WAVEFORM_LERP_STEPS);
+    failures++;
+  }
+
+  printf("%s\n", failures ? "FAILED" : "PASSED");
+
+  return failures ? 1 : 0;
+}
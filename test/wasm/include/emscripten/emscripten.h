@@ -0,0 +1,26 @@
+/**
+ * Minimal stand-in for <emscripten/emscripten.h>.
+ *
+ * Lets the Wasm modules' C sources be compiled natively by the harnesses in
+ * test/wasm. Only what those sources actually use is provided.
+ */
+
+#pragma once
+
+#define EMSCRIPTEN_KEEPALIVE
+
+typedef int EM_BOOL;
+#define EM_TRUE  1
+#define EM_FALSE 0
+
+/**
+ * Current time in milliseconds.
+ *
+ * Harnesses set `tsig_native_now` to control the timestamp a waveform context
+ * is initialized from.
+ */
+extern double tsig_native_now;
+
+static inline double emscripten_get_now(void) {
+  return tsig_native_now;
+}
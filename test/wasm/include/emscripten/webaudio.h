@@ -0,0 +1,14 @@
+/**
+ * Minimal stand-in for <emscripten/webaudio.h>.
+ *
+ * See emscripten.h in this directory.
+ */
+
+#pragma once
+
+#include "emscripten.h"
+
+typedef struct AudioSampleFrame {
+  const int numberOfChannels;
+  float *data;
+} AudioSampleFrame;
@@ -0,0 +1,341 @@
+/**
+ * Native differential test of the bit-parallel edit distance kernel.
+ *
+ * Compares edist_calc() on random pairs of strings against the banded
+ * Wagner-Fischer DP it replaced, kept verbatim below, and against a plain
+ * full-matrix DP. Strings draw from a small alphabet so that matches and
+ * transpositions are common, and mix BMP code units with surrogate pairs,
+ * unpaired surrogates, and pairs that share one code unit. Strings of up to
+ * 64 code units fill every bit of the kernel's word.
+ *
+ * Each pair is also stepped through edist_lanes_step() a code point of the
+ * second string at a time, in one lane of several, with the first string as
+ * that lane's pattern and the others empty.
+ *
+ * The old DP's shortcut for a shorter string of two code points undercounts
+ * transpositions, e.g. it scores "ab" against "ba" as 0, so those pairs are
+ * only compared against the full-matrix DP.
+ *
+ * Usage: osadiff [PAIRS]
+ *
+ * PAIRS is the count of random pairs to compare (default: 200000).
+ * Exits with a nonzero status if any distance differs.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "editdistance.h"
+
+#define OSA_MAX_CODE_UNITS 64
+
+static const uint16_t kAlphabet[][2] = {
+    {'a'},            {'b'},    {'c'},    {0x00e9},         {0x4e2d},
+    {0xd83d, 0xde00}, /* U+1F600 */       {0xd83d, 0xde01}, /* U+1F601 */
+    {0xd83c, 0xde00}, /* U+1F200 */       {0xd800},         {0xdc00},
+};
+
+/* The banded DP from before the bit-parallel kernel, renamed. */
+static inline uint8_t ref_is_surrogate_pair(uint8_t idxs[], uint8_t i) {
+  return idxs[i] > (i ? idxs[i - 1] : 0) + 1;
+}
+
+static uint8_t ref_utf16_eq(uint16_t s1[], uint8_t idxs1[], uint8_t i,
+                              uint16_t s2[], uint8_t idxs2[], uint8_t j) {
+  uint8_t is_pair = ref_is_surrogate_pair(idxs1, i);
+  if (is_pair != ref_is_surrogate_pair(idxs2, j))
+    return 0;
+
+  uint8_t k1 = idxs1[i] - 1 - is_pair;
+  uint8_t k2 = idxs2[j] - 1 - is_pair;
+  uint8_t is_first_eq = s1[k1] == s2[k2];
+  if (!is_pair || !is_first_eq)
+    return is_first_eq;
+
+  return s1[k1 + 1] == s2[k2 + 1];
+}
+
+static void ref_utf16_swap_first_two(uint16_t s[], uint8_t idxs[]) {
+  uint8_t code_units = idxs[1];
+  for (uint8_t rotate = idxs[1] - idxs[0]; rotate; rotate--) {
+    uint16_t right = s[code_units - 1];
+    for (uint8_t i = code_units - 1; i; i--)
+      s[i] = s[i - 1];
+    s[0] = right;
+  }
+  uint8_t tmp = idxs[0];
+  idxs[0] = idxs[1] - idxs[0];
+  idxs[1] = idxs[0] + tmp;
+}
+
+static uint8_t ref_calc_le2(uint16_t s1[], uint8_t idxs1[], uint8_t len1,
+                              uint16_t s2[], uint8_t idxs2[], uint8_t len2) {
+  uint8_t found_second = 0;
+  uint8_t found_first = 0;
+  uint8_t first = 0;
+
+  for (uint8_t i = 0; i < len1 && !found_first; i++) {
+    if (ref_utf16_eq(s1, idxs1, i, s2, idxs2, 0)) {
+      found_first = 1;
+      first = i;
+    }
+  }
+
+  if (len2 == 1)
+    return len1 - found_first;
+
+  if (found_first && first == len1 - 1) {
+    found_first = 0;
+    first = 0;
+  }
+
+  for (uint8_t i = first + 1; i < len1 && !found_second; i++)
+    found_second = ref_utf16_eq(s1, idxs1, i, s2, idxs2, 1);
+
+  return len1 - found_first - found_second;
+}
+
+/**
+ * Compute edit distance between two UTF-16 strings.
+ *
+ * Wagner-Fischer (detects adjacent transposition) with memory reduction and
+ * branch pruning.
+ *
+ * cf. https://en.wikipedia.org/wiki/Damerau%E2%80%93Levenshtein_distance
+ * cf. https://ceptord.net/wagner-fischer/index.html
+ *
+ * @param s1 UTF-16 code units in the first string. Not null terminated.
+ * @param idxs1 Index map for `s1`.
+ * @param len1 Length of the first string in Unicode code points.
+ * @param s2 UTF-16 code units in the second string Not null terminated.
+ * @param idxs2 Index map for `s2`.
+ * @param len2 Length of the second string in Unicode code points.
+ * @return Edit distance between the strings.
+ */
+static uint8_t ref_calc(uint16_t s1[], uint8_t idxs1[], uint8_t len1,
+                   uint16_t s2[], uint8_t idxs2[], uint8_t len2) {
+  if (len1 < len2)
+    return ref_calc(s2, idxs2, len2, s1, idxs1, len1);
+
+  if (!len2)
+    return len1;
+
+  if (len2 == 1)
+    return ref_calc_le2(s1, idxs1, len1, s2, idxs2, len2);
+
+  if (len2 == 2) {
+    ref_utf16_swap_first_two(s2, idxs2);
+    uint8_t cand = ref_calc_le2(s1, idxs1, len1, s2, idxs2, len2);
+    ref_utf16_swap_first_two(s2, idxs2);
+    return edist_min(cand, ref_calc_le2(s1, idxs1, len1, s2, idxs2, len2));
+  }
+
+  uint8_t buf_len = edist_max(len1, len2) + 1;
+
+  uint8_t actual_buf0[buf_len];
+  uint8_t actual_buf1[buf_len];
+  uint8_t actual_buf2[buf_len];
+
+  uint8_t *buf0 = actual_buf0;
+  uint8_t *buf1 = actual_buf1;
+  uint8_t *buf2 = actual_buf2;
+
+  uint8_t rlimit = (len2 - 1) / 2;
+  int16_t llimit = len2 - len1 - rlimit + 1;
+
+  for (uint8_t i = 0; i <= rlimit; i++)
+    buf0[i] = i;
+
+  for (uint8_t i = 1; i <= len1; i++) {
+    uint8_t *tmp = buf2;
+    buf2 = buf1;
+    buf1 = buf0;
+    buf0 = tmp;
+
+    buf0[0] = i;
+
+    uint8_t l = edist_max(llimit++, 1);
+    uint8_t r = edist_min(rlimit++, len2);
+
+    uint8_t up_left = buf1[l - 1];
+    uint8_t up = buf1[l];
+
+    if (!ref_utf16_eq(s1, idxs1, i - 1, s2, idxs2, l - 1))
+      up_left = edist_min(up_left, up) + 1;
+
+    uint8_t left = up_left;
+    buf0[l] = up_left;
+    up_left = up;
+
+    if (i > 1 && l > 1 && ref_utf16_eq(s1, idxs1, i - 1, s2, idxs2, l - 2)
+                       && ref_utf16_eq(s1, idxs1, i - 2, s2, idxs2, l - 1))
+      buf0[l] = edist_min(buf0[l], buf2[l - 2] + 1);
+
+    for (uint8_t j = l + 1; j <= r; j++) {
+      up = buf1[j];
+
+      if (!ref_utf16_eq(s1, idxs1, i - 1, s2, idxs2, j - 1))
+        up_left = edist_min(edist_min(up_left, up), left) + 1;
+
+      left = up_left;
+      buf0[j] = up_left;
+      up_left = up;
+
+      if (i > 1 && j > 1 && ref_utf16_eq(s1, idxs1, i - 1, s2, idxs2, j - 2)
+                         && ref_utf16_eq(s1, idxs1, i - 2, s2, idxs2, j - 1))
+        buf0[j] = edist_min(buf0[j], buf2[j - 2] + 1);
+    }
+
+    if (r == len2)
+      continue;
+
+    if (!ref_utf16_eq(s1, idxs1, i - 1, s2, idxs2, r))
+      up_left = edist_min(up_left, left) + 1;
+
+    buf0[r + 1] = up_left;
+
+    if (i > 1 && r > 0 && ref_utf16_eq(s1, idxs1, i - 1, s2, idxs2, r - 1)
+                       && ref_utf16_eq(s1, idxs1, i - 2, s2, idxs2, r))
+      buf0[r + 1] = edist_min(buf0[r + 1], buf2[r - 1] + 1);
+  }
+
+  return buf0[len2];
+}
+
+/* Optimal string alignment distance by the textbook full-matrix DP. */
+static uint8_t osa_full(uint32_t a[], uint8_t m, uint32_t b[], uint8_t n) {
+  uint8_t d[m + 1][n + 1];
+
+  for (uint8_t i = 0; i <= m; i++)
+    d[i][0] = i;
+  for (uint8_t j = 0; j <= n; j++)
+    d[0][j] = j;
+
+  for (uint8_t i = 1; i <= m; i++) {
+    for (uint8_t j = 1; j <= n; j++) {
+      d[i][j] = edist_min(edist_min(d[i - 1][j], d[i][j - 1]) + 1,
+                          d[i - 1][j - 1] + (a[i - 1] != b[j - 1]));
+      if (i > 1 && j > 1 && a[i - 1] == b[j - 2] && a[i - 2] == b[j - 1])
+        d[i][j] = edist_min(d[i][j], d[i - 2][j - 2] + 1);
+    }
+  }
+
+  return d[m][n];
+}
+
+/* Edit distance by stepping `t` through lane `lane` with pattern `p`. */
+static uint8_t osa_lanes(uint32_t p[], uint8_t m, uint32_t t[], uint8_t n,
+                         uint8_t lane, uint8_t *empty_dist) {
+  edist_lanes_state_t state;
+  uint8_t lens[EDIST_LANES] = {0}, dists[EDIST_LANES] = {0};
+
+  lens[lane] = dists[lane] = m;
+  edist_lanes_init(&state);
+
+  for (uint8_t j = 0; j < n; j++) {
+    edist_lanes_t pm = {0};
+    for (uint8_t i = 0; i < m; i++)
+      pm[lane] |= (uint64_t)(p[i] == t[j]) << i;
+    edist_lanes_step(&state, &pm, lens, dists);
+  }
+
+  *empty_dist = dists[(lane + 1) % EDIST_LANES];
+  return dists[lane];
+}
+
+/* Fills `s` with random letters, returning its length in code units. */
+static uint8_t osa_random_string(uint16_t s[], unsigned *seed) {
+  int n_letters = sizeof(kAlphabet) / sizeof(*kAlphabet);
+  uint8_t target = rand_r(seed) % (OSA_MAX_CODE_UNITS + 1);
+  uint8_t len = 0;
+
+  while (len < target) {
+    const uint16_t *letter = kAlphabet[rand_r(seed) % n_letters];
+    uint8_t units = letter[1] ? 2 : 1;
+    if (len + units > OSA_MAX_CODE_UNITS)
+      break;
+    for (uint8_t k = 0; k < units; k++)
+      s[len++] = letter[k];
+  }
+
+  return len;
+}
+
+/* Makes `s2` a few random edits away from `s1`, in place of its letters. */
+static uint8_t osa_mutate(uint16_t s1[], uint8_t len1, uint16_t s2[],
+                          unsigned *seed) {
+  uint16_t noise[OSA_MAX_CODE_UNITS];
+  uint8_t noise_len = osa_random_string(noise, seed);
+  uint8_t len2 = 0;
+
+  for (uint8_t i = 0; i < len1 && len2 < OSA_MAX_CODE_UNITS; i++) {
+    int roll = rand_r(seed) % 16;
+    if (roll == 0 && noise_len)
+      s2[len2++] = noise[rand_r(seed) % noise_len];
+    else if (roll == 1 && i + 1 < len1 && len2 + 1 < OSA_MAX_CODE_UNITS) {
+      s2[len2++] = s1[i + 1];
+      s2[len2++] = s1[i++];
+    } else if (roll != 2)
+      s2[len2++] = s1[i];
+  }
+
+  return len2;
+}
+
+int main(int argc, char *argv[]) {
+  long pairs = argc > 1 ? atol(argv[1]) : 200000;
+  if (pairs < 1) {
+    fprintf(stderr, "usage: %s [PAIRS]\n", argv[0]);
+    return 2;
+  }
+
+  uint16_t s1[OSA_MAX_CODE_UNITS], s2[OSA_MAX_CODE_UNITS];
+  uint8_t idxs1[OSA_MAX_CODE_UNITS], idxs2[OSA_MAX_CODE_UNITS];
+  uint32_t p1[OSA_MAX_CODE_UNITS], p2[OSA_MAX_CODE_UNITS];
+  uint64_t surrogates = 0, old_mismatches = 0, full_mismatches = 0;
+  uint64_t lanes_mismatches = 0;
+  unsigned seed = 1;
+
+  for (long n = 0; n < pairs; n++) {
+    uint8_t units1 = osa_random_string(s1, &seed);
+    /* Half the pairs are near misses, where transpositions show up. */
+    uint8_t units2 = n % 2 ? osa_mutate(s1, units1, s2, &seed)
+                           : osa_random_string(s2, &seed);
+
+    uint8_t len1 = edist_make_idxs(s1, units1, idxs1);
+    uint8_t len2 = edist_make_idxs(s2, units2, idxs2);
+    surrogates += len1 != units1 || len2 != units2;
+
+    uint8_t dist = edist_calc(s1, idxs1, len1, s2, idxs2, len2);
+    uint8_t old = edist_min(len1, len2) == 2
+                      ? dist
+                      : ref_calc(s1, idxs1, len1, s2, idxs2, len2);
+
+    edist_utf16_decode(s1, idxs1, len1, p1);
+    edist_utf16_decode(s2, idxs2, len2, p2);
+    uint8_t full = osa_full(p1, len1, p2, len2);
+    uint8_t empty;
+    uint8_t lanes = osa_lanes(p1, len1, p2, len2, n % EDIST_LANES, &empty);
+
+    if (dist != old && old_mismatches++ < 5)
+      printf("pair %ld: %u vs. old %u\n", n, dist, old);
+    if (dist != full && full_mismatches++ < 5)
+      printf("pair %ld: %u vs. full %u\n", n, dist, full);
+    if ((lanes != full || empty != len2) && lanes_mismatches++ < 5)
+      printf("pair %ld: lanes %u, empty %u vs. full %u\n", n, lanes, empty,
+             full);
+  }
+
+  uint8_t failed = old_mismatches || full_mismatches || lanes_mismatches ||
+                   !surrogates;
+
+  printf("%8s %10s %8s %8s %9s\n", "pairs", "surrogate", "vs. old",
+         "vs. full", "vs. lanes");
+  printf("%8ld %10llu %8llu %8llu %9llu\n", pairs,
+         (unsigned long long)surrogates, (unsigned long long)old_mismatches,
+         (unsigned long long)full_mismatches,
+         (unsigned long long)lanes_mismatches);
+  printf("%s\n", failed ? "FAILED" : "PASSED");
+
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,203 @@
+/**
+ * Native render cost benchmark for the time signal waveform generator.
+ *
+ * Renders a few minutes of every station's waveform a quantum at a time,
+ * exactly as the audio worklet does, and reports the cost per sample. Runs
+ * are repeated round-robin and the fastest of each is kept, to filter out
+ * scheduling and frequency scaling noise.
+ *
+ * Stations with phase modulation are also rendered without it, and must not
+ * cost much more than the amplitude-only path. Every station is rendered at
+ * a common and a high sample rate (at which some are synthesized directly),
+ * and the share of one core needed to keep up in real time is reported.
+ *
+ * For comparison with the Web Audio automation engine, which leaves rendering
+ * to the browser, CPU time per minute of signal is reported for both it and
+ * the audio worklet. The automation engine's share is only the scheduling of
+ * each minute's edges and gains; the browser's OscillatorNode, GainNode, and
+ * WaveShaperNode cost is not ours to measure here.
+ *
+ * Usage: renderbench [SECS]
+ *
+ * SECS is the length of each rendering (default: 20).
+ * Exits with a nonzero status if phase modulation costs too much.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+#include "waveform.h"
+
+#define BENCH_REPS        25
+#define BENCH_SCHED_MINS  1440 /* Minutes scheduled per run, i.e. a day. */
+#define BENCH_MARGIN      0.10 /* Allowed relative cost of phase modulation. */
+
+double tsig_native_now;
+
+static const uint32_t kSampleRates[] = {48000, 192000};
+
+static const struct {
+  const char *name;
+  uint8_t station;
+  uint8_t jjy_khz;
+  uint8_t no_phase; /** Whether to disable phase modulation. */
+} kConfigs[] = {
+    /* Each amplitude-only config is followed by its phase-modulated one. */
+    {"BPC", TSIG_STATION_BPC, TSIG_JJYKHZ_40, 0},
+    {"DCF77-AM", TSIG_STATION_DCF77, TSIG_JJYKHZ_40, 1},
+    {"DCF77", TSIG_STATION_DCF77, TSIG_JJYKHZ_40, 0},
+    {"JJY40", TSIG_STATION_JJY, TSIG_JJYKHZ_40, 0},
+    {"JJY60", TSIG_STATION_JJY, TSIG_JJYKHZ_60, 0},
+    {"MSF", TSIG_STATION_MSF, TSIG_JJYKHZ_40, 0},
+    {"WWVB-AM", TSIG_STATION_WWVB, TSIG_JJYKHZ_40, 1},
+    {"WWVB", TSIG_STATION_WWVB, TSIG_JJYKHZ_40, 0},
+};
+
+static double bench_now_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* Returns the cost per sample in nanoseconds. */
+static double bench_run(int i, uint32_t sample_rate, int secs,
+                        float *checksum) {
+  static tsig_waveform_ctx_t ctx;
+  static float buf[TSIG_RENDER_QUANTUM];
+  tsig_params_t params = {
+      .station = kConfigs[i].station,
+      .jjy_khz = kConfigs[i].jjy_khz,
+      .noclip = 1,
+  };
+  AudioSampleFrame output = {.numberOfChannels = 1, .data = buf};
+  waveform_station_data_t *data = &TSIG_WAVEFORM_STATION_DATA[params.station];
+  waveform_phase_func gen_phase = data->gen_phase;
+  uint32_t chip_cycles = data->chip_cycles;
+  uint64_t quantums = (uint64_t)secs * sample_rate / TSIG_RENDER_QUANTUM;
+
+  if (kConfigs[i].no_phase) {
+    data->gen_phase = NULL;
+    data->chip_cycles = 0;
+  }
+
+  ctx = (tsig_waveform_ctx_t){.sample_rate = sample_rate};
+  tsig_waveform_init(&ctx, &params,
+                     tsig_waveform_choose_synth(&params, sample_rate));
+  ctx.fade_gain = ctx.max_fade_gain;
+
+  int state = TSIG_STATE_RUNNING;
+  double start_ns = bench_now_ns();
+  for (uint64_t q = 0; q < quantums; q++) {
+    tsig_waveform_generate(&ctx, &params, state, &state, 1, &output);
+    *checksum += buf[q % TSIG_RENDER_QUANTUM];
+  }
+  double ns = bench_now_ns() - start_ns;
+
+  data->gen_phase = gen_phase;
+  data->chip_cycles = chip_cycles;
+
+  return ns / (quantums * TSIG_RENDER_QUANTUM);
+}
+
+/* Returns the cost of scheduling a minute for automation, in nanoseconds. */
+static double bench_sched(int i, float *checksum) {
+  static tsig_waveform_frame_t frame;
+  tsig_params_t params = {
+      .station = kConfigs[i].station,
+      .jjy_khz = kConfigs[i].jjy_khz,
+  };
+  waveform_station_data_t *data = &TSIG_WAVEFORM_STATION_DATA[params.station];
+  waveform_phase_func gen_phase = data->gen_phase;
+  uint32_t chip_cycles = data->chip_cycles;
+
+  if (kConfigs[i].no_phase) {
+    data->gen_phase = NULL;
+    data->chip_cycles = 0;
+  }
+
+  double ms = tsig_native_now + data->utc_offset;
+  double start_ns = bench_now_ns();
+  for (int m = 0; m < BENCH_SCHED_MINS; m++) {
+    ms = tsig_waveform_sched_minute(&frame, &params, ms);
+    for (int k = 0; k < frame.len; k++)
+      *checksum += tsig_waveform_edge_gain(&frame.edges[k], &params);
+    ms += TSIG_DATETIME_MSECS_MIN;
+  }
+  double ns = bench_now_ns() - start_ns;
+
+  data->gen_phase = gen_phase;
+  data->chip_cycles = chip_cycles;
+
+  return ns / BENCH_SCHED_MINS;
+}
+
+int main(int argc, char *argv[]) {
+  int secs = argc > 1 ? atoi(argv[1]) : 20;
+  if (secs < 1) {
+    fprintf(stderr, "usage: %s [SECS]\n", argv[0]);
+    return 2;
+  }
+
+  int n_configs = sizeof(kConfigs) / sizeof(*kConfigs);
+  int n_rates = sizeof(kSampleRates) / sizeof(*kSampleRates);
+  double best_ns[sizeof(kConfigs) / sizeof(*kConfigs)]
+                [sizeof(kSampleRates) / sizeof(*kSampleRates)];
+  double best_sched_ns[sizeof(kConfigs) / sizeof(*kConfigs)];
+  float checksum = 0;
+  int failures = 0;
+
+  /* Saturday, March 30, 2024 22:17:41.0625 UTC */
+  tsig_native_now = 1711837061062.5;
+
+  for (int i = 0; i < n_configs; i++) {
+    best_sched_ns[i] = INFINITY;
+    for (int j = 0; j < n_rates; j++)
+      best_ns[i][j] = INFINITY;
+  }
+  for (int rep = 0; rep < BENCH_REPS; rep++)
+    for (int i = 0; i < n_configs; i++) {
+      for (int j = 0; j < n_rates; j++)
+        best_ns[i][j] = fmin(best_ns[i][j],
+                             bench_run(i, kSampleRates[j], secs, &checksum));
+      best_sched_ns[i] = fmin(best_sched_ns[i], bench_sched(i, &checksum));
+    }
+
+  printf("Rendering %d s per run.\n\n", secs);
+  printf("%-8s", "");
+  for (int j = 0; j < n_rates; j++)
+    printf(" %4s %9s %8s %8s", "sub", "ns/sample", "rt_load", "ms/min");
+  printf(" %8s %11s\n", "sched_us", "phase_cost");
+
+  for (int i = 0; i < n_configs; i++) {
+    tsig_params_t params = {.station = kConfigs[i].station,
+                            .jjy_khz = kConfigs[i].jjy_khz};
+
+    printf("%-8s", kConfigs[i].name);
+    for (int j = 0; j < n_rates; j++) {
+      uint8_t sub =
+          tsig_waveform_choose_synth(&params, kSampleRates[j])->subharmonic;
+      double load = best_ns[i][j] * kSampleRates[j] / 1e9;
+      printf(" %4u %9.3f %7.2f%% %8.2f", sub, best_ns[i][j], 100.0 * load,
+             TSIG_DATETIME_MSECS_MIN * load);
+    }
+    printf(" %8.2f", best_sched_ns[i] / 1000.0);
+
+    /* Compare with the amplitude-only config just before, if any. */
+    if (i && kConfigs[i - 1].no_phase) {
+      double cost = best_ns[i][0] / best_ns[i - 1][0] - 1.0;
+      uint8_t failed = cost > BENCH_MARGIN;
+      failures += failed;
+      printf(" %+10.1f%%%s", 100.0 * cost, failed ? "  FAIL" : "");
+    }
+    printf("\n");
+  }
+
+  printf("\nms/min is audio worklet CPU time per minute of signal, sched_us is\n"
+         "that of the automation engine's schedule (browser nodes excluded).\n");
+  printf("Phase modulation limit %+.1f%%, checksum %g\n",
+         100.0 * BENCH_MARGIN, checksum);
+  printf("%s\n", failures ? "FAILED" : "PASSED");
+
+  return failures ? 1 : 0;
+}
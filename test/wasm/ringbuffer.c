@@ -0,0 +1,186 @@
+/**
+ * Native stress test of the render-ahead ring.
+ *
+ * A producer thread renders quantums ahead, as the Wasm Worker does, stalling
+ * now and then for longer than its lead. A consumer thread reads one quantum
+ * per period, as the AWP does, and now and then skips some as if the browser
+ * had dropped them. Every sample of a quantum holds one more than the
+ * position at which the producer meant it to be output, and every seventh
+ * quantum is tagged. Before that, checks that reading past skipped quantums
+ * still returns the latest tag among them.
+ *
+ * Usage: ringbuffer [QUANTUMS]
+ *
+ * QUANTUMS is the count of quantums to consume (default: 50000).
+ * Exits with a nonzero status if any quantum is output at the wrong
+ * position or torn, if a tag is lost or misplaced, if underflows are
+ * miscounted, or if discarding leaves anything in the ring.
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+#include "ring.h"
+
+#define RING_LEAD       48
+#define RING_PERIOD_US  20
+#define RING_STALL_ODDS 2000 /* One stall per this many quantums, roughly. */
+#define RING_SKIP_ODDS  5000 /* One skip per this many quantums, roughly. */
+#define RING_TAG_EVERY  7
+
+static tsig_ring_t ring, skip_ring;
+static atomic_int done;
+
+static void ring_sleep_us(long us) {
+  struct timespec ts = {.tv_sec = us / 1000000, .tv_nsec = us % 1000000 * 1000};
+  nanosleep(&ts, NULL);
+}
+
+/* Tag that the producer commits after a position. */
+static int ring_tag(uint64_t pos) {
+  return pos % RING_TAG_EVERY ? TSIG_RING_NO_STATE : (int)(pos % 100);
+}
+
+/* Stores the count of times the producer lost track of its position. */
+static void *ring_produce(void *arg) {
+  uint64_t pos = 0, errors = 0;
+  unsigned seed = 1;
+
+  while (!atomic_load(&done)) {
+    pos += tsig_ring_catch_up(&ring);
+    errors += pos != atomic_load(&ring.head);
+
+    float *out = tsig_ring_acquire(&ring, RING_LEAD);
+    if (!out) {
+      ring_sleep_us(RING_PERIOD_US / 2);
+      continue;
+    }
+
+    /* Stall long enough to underflow, as a slow quantum would. */
+    if (rand_r(&seed) % RING_STALL_ODDS == 0)
+      ring_sleep_us(RING_PERIOD_US * (RING_LEAD + rand_r(&seed) % RING_LEAD));
+
+    for (int i = 0; i < TSIG_RENDER_QUANTUM; i++)
+      out[i] = (float)(pos + 1);
+    tsig_ring_commit(&ring, ring_tag(pos));
+    pos++;
+  }
+
+  *(uint64_t *)arg = errors;
+  return NULL;
+}
+
+/* Whether a tag read might be that of a position in [first, last]. */
+static uint8_t ring_tag_within(int state, uint64_t first, uint64_t last) {
+  for (uint64_t pos = first; pos <= last && pos >= first; pos++)
+    if (ring_tag(pos) != TSIG_RING_NO_STATE && ring_tag(pos) == state)
+      return 1;
+  return 0;
+}
+
+/*
+ * Reads past tagged quantums, rendered or not. Returns the count of reads
+ * that lost a tag or returned a stale one.
+ */
+static int ring_check_skip() {
+  static const int kTags[] = {TSIG_RING_NO_STATE, 3, TSIG_RING_NO_STATE, 5,
+                              TSIG_RING_NO_STATE, TSIG_RING_NO_STATE};
+  float buf[TSIG_RENDER_QUANTUM];
+  int failures = 0;
+
+  for (size_t i = 0; i < sizeof(kTags) / sizeof(*kTags); i++) {
+    tsig_ring_acquire(&skip_ring, TSIG_RING_QUANTUMS - 1);
+    tsig_ring_commit(&skip_ring, kTags[i]);
+  }
+
+  /* Past the first tag to an untagged quantum, then onto the second. */
+  failures += tsig_ring_read(&skip_ring, buf, 2, 1) != 3;
+  failures += tsig_ring_read(&skip_ring, buf, 0, 1) != 5;
+
+  /* Past the last rendered quantum into silence, having skipped a tag. */
+  tsig_ring_acquire(&skip_ring, TSIG_RING_QUANTUMS - 1);
+  tsig_ring_commit(&skip_ring, 7);
+  failures += tsig_ring_read(&skip_ring, buf, 4, 1) != 7;
+  failures += atomic_load(&skip_ring.underflows) != 1;
+
+  if (failures)
+    printf("Tags lost or stale past skipped quantums: %d\n", failures);
+  return failures;
+}
+
+int main(int argc, char *argv[]) {
+  long quantums = argc > 1 ? atol(argv[1]) : 50000;
+  if (quantums < 1) {
+    fprintf(stderr, "usage: %s [QUANTUMS]\n", argv[0]);
+    return 2;
+  }
+
+  static float buf[TSIG_RENDER_QUANTUM];
+  uint64_t producer_errors = 0;
+  uint64_t pos = 0, silent = 0, skipped = 0, misplaced = 0, torn = 0;
+  uint64_t tags = 0, bad_tags = 0;
+  unsigned seed = 2;
+  pthread_t producer;
+
+  bad_tags += ring_check_skip();
+  pthread_create(&producer, NULL, ring_produce, &producer_errors);
+
+  for (long n = 0; n < quantums; n++) {
+    uint32_t skip = 0;
+    if (rand_r(&seed) % RING_SKIP_ODDS == 0)
+      skip = 1 + rand_r(&seed) % (2 * RING_LEAD);
+    skipped += skip;
+    pos += skip;
+
+    int state = tsig_ring_read(&ring, buf, skip, 1);
+
+    uint8_t is_silent = 1;
+    for (int i = 0; i < TSIG_RENDER_QUANTUM; i++)
+      is_silent &= buf[i] == 0.0F;
+
+    /*
+     * Skipped quantums rendered in time pass on their tags. Those before a
+     * quantum read were all rendered, so the latest tag among them is known.
+     */
+    if (is_silent) {
+      silent++;
+      bad_tags += state != TSIG_RING_NO_STATE &&
+                  !ring_tag_within(state, pos - skip, pos - 1);
+    } else {
+      misplaced += buf[0] != (float)(pos + 1);
+      for (int i = 1; i < TSIG_RENDER_QUANTUM; i++)
+        torn += buf[i] != buf[0];
+
+      int expected = TSIG_RING_NO_STATE;
+      for (uint64_t p = pos - skip; p <= pos; p++)
+        if (ring_tag(p) != TSIG_RING_NO_STATE)
+          expected = ring_tag(p);
+      tags += expected != TSIG_RING_NO_STATE;
+      bad_tags += state != expected;
+    }
+
+    pos++;
+    ring_sleep_us(RING_PERIOD_US);
+  }
+
+  atomic_store(&done, 1);
+  pthread_join(producer, NULL);
+
+  uint32_t underflows = atomic_load(&ring.underflows);
+  tsig_ring_discard(&ring);
+
+  uint8_t failed = misplaced || torn || bad_tags || producer_errors ||
+                   underflows != silent || !tags || tsig_ring_fill(&ring);
+
+  printf("%8s %8s %8s %10s %9s %5s %8s %8s\n", "read", "skipped", "silent",
+         "underflows", "misplaced", "torn", "tags", "bad_tags");
+  printf("%8ld %8llu %8llu %10u %9llu %5llu %8llu %8llu\n", quantums,
+         (unsigned long long)skipped, (unsigned long long)silent, underflows,
+         (unsigned long long)misplaced, (unsigned long long)torn,
+         (unsigned long long)tags, (unsigned long long)bad_tags);
+  printf("%s\n", failed ? "FAILED" : "PASSED");
+
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,42 @@
+#!/bin/bash
+
+# Build the Wasm modules' C sources natively and run the given harnesses
+# (default: all of them). Extra arguments after "--" are passed to each one.
+
+set -ue
+
+cd "$(dirname "$0")"
+
+CC_PARAMS=(
+  '-std=gnu11'
+  '-Wall'
+  '-Wextra'
+  '-Wno-unused-parameter'
+  '-Iinclude'
+  '-I../../src/wasm'
+  '-O2'
+  '-pthread'
+  '-lm'
+)
+
+HARNESSES=()
+while [[ $# -gt 0 && "$1" != "--" ]]; do
+  HARNESSES+=("$1")
+  shift
+done
+[[ $# -gt 0 ]] && shift
+
+if [[ ${#HARNESSES[@]} -eq 0 ]]; then
+  for harness in *.c; do
+    HARNESSES+=("${harness%.c}")
+  done
+fi
+
+BUILD_DIR="$(mktemp -d)"
+trap 'rm -rf "${BUILD_DIR}"' EXIT
+
+for harness in "${HARNESSES[@]}"; do
+  echo "=== ${harness} ==="
+  "${CC:-cc}" "${harness}.c" -o "${BUILD_DIR}/${harness}" "${CC_PARAMS[@]}"
+  "${BUILD_DIR}/${harness}" "$@"
+done
@@ -0,0 +1,123 @@
+/**
+ * Native test of warm standby against silent generation.
+ *
+ * Advances every station through a stretch of warm standby, then fades in
+ * and transmits for a while, alongside a reference that instead generates
+ * every standby sample at zero fade gain. Both must then output exactly the
+ * same samples: skipping ahead must keep the same carrier phase, frame, and
+ * edge in effect as generating would.
+ *
+ * Usage: standby [SECS]
+ *
+ * SECS is the length of standby before fading in (default: 150).
+ * Exits with a nonzero status if any sample after standby differs, or if the
+ * two ever disagree about state.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "waveform.h"
+
+#define STANDBY_RUN_SECS 5
+
+double tsig_native_now;
+
+static const uint32_t kSampleRates[] = {44100, 48000, 96000, 192000};
+
+static const struct {
+  const char *name;
+  uint8_t station;
+  uint8_t jjy_khz;
+} kConfigs[] = {
+    {"BPC", TSIG_STATION_BPC, TSIG_JJYKHZ_40},
+    {"DCF77", TSIG_STATION_DCF77, TSIG_JJYKHZ_40},
+    {"JJY40", TSIG_STATION_JJY, TSIG_JJYKHZ_40},
+    {"JJY60", TSIG_STATION_JJY, TSIG_JJYKHZ_60},
+    {"MSF", TSIG_STATION_MSF, TSIG_JJYKHZ_40},
+    {"WWVB", TSIG_STATION_WWVB, TSIG_JJYKHZ_40},
+};
+
+static int test_config(int i, uint32_t sample_rate, int secs) {
+  static tsig_waveform_ctx_t ctx, ref;
+  static float buf[TSIG_RENDER_QUANTUM], ref_buf[TSIG_RENDER_QUANTUM];
+  tsig_params_t params = {
+      .station = kConfigs[i].station,
+      .jjy_khz = kConfigs[i].jjy_khz,
+  };
+  AudioSampleFrame output = {.numberOfChannels = 1, .data = buf};
+  AudioSampleFrame ref_output = {.numberOfChannels = 1, .data = ref_buf};
+  uint64_t standby_quantums =
+      (uint64_t)secs * sample_rate / TSIG_RENDER_QUANTUM;
+  uint64_t run_quantums =
+      (uint64_t)STANDBY_RUN_SECS * sample_rate / TSIG_RENDER_QUANTUM;
+  uint64_t diverged = 0, mismatched = 0, nonzero = 0;
+
+  ctx = (tsig_waveform_ctx_t){.sample_rate = sample_rate};
+  tsig_waveform_init(&ctx, &params,
+                     tsig_waveform_choose_synth(&params, sample_rate));
+  ref = ctx;
+
+  for (uint64_t q = 0; q < standby_quantums; q++) {
+    int ref_next_state = TSIG_STATE_STANDBY;
+
+    tsig_waveform_advance(&ctx, &params);
+    tsig_waveform_generate(&ref, &params, TSIG_STATE_STANDBY, &ref_next_state,
+                           1, &ref_output);
+
+    diverged += ref_next_state != TSIG_STATE_STANDBY;
+    for (int j = 0; j < TSIG_RENDER_QUANTUM; j++)
+      nonzero += ref_buf[j] != 0.0F;
+  }
+
+  int state = TSIG_STATE_FADE_IN, ref_state = state;
+  for (uint64_t q = 0; q < run_quantums; q++) {
+    int next_state = state, ref_next_state = ref_state;
+
+    tsig_waveform_generate(&ctx, &params, state, &next_state, 1, &output);
+    tsig_waveform_generate(&ref, &params, ref_state, &ref_next_state, 1,
+                           &ref_output);
+
+    for (int j = 0; j < TSIG_RENDER_QUANTUM; j++)
+      mismatched += buf[j] != ref_buf[j];
+
+    state = next_state;
+    ref_state = ref_next_state;
+    diverged += state != ref_state;
+  }
+
+  uint8_t failed = diverged || mismatched || nonzero ||
+                   state != TSIG_STATE_RUNNING;
+  printf("%-6s %6u %10llu %8llu%s\n", kConfigs[i].name, sample_rate,
+         (unsigned long long)ctx.samples, (unsigned long long)mismatched,
+         failed ? "  FAIL" : "");
+
+  return failed;
+}
+
+int main(int argc, char *argv[]) {
+  int secs = argc > 1 ? atoi(argv[1]) : 150;
+  if (secs < 1) {
+    fprintf(stderr, "usage: %s [SECS]\n", argv[0]);
+    return 2;
+  }
+
+  int n_configs = sizeof(kConfigs) / sizeof(*kConfigs);
+  int n_rates = sizeof(kSampleRates) / sizeof(*kSampleRates);
+  int failures = 0;
+
+  /* Saturday, March 30, 2024 22:17:41.0625 UTC */
+  tsig_native_now = 1711837061062.5;
+
+  printf("Standing by %d s, then transmitting %d s.\n\n", secs,
+         STANDBY_RUN_SECS);
+  printf("%-6s %6s %10s %8s\n", "", "rate", "samples", "mismatch");
+
+  for (int i = 0; i < n_configs; i++)
+    for (int j = 0; j < n_rates; j++)
+      failures += test_config(i, kSampleRates[j], secs);
+
+  printf("%s\n", failures ? "FAILED" : "PASSED");
+
+  return failures ? 1 : 0;
+}
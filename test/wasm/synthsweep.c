@@ -0,0 +1,144 @@
+/**
+ * Native sweep report of the synthesis chosen for each station and sample
+ * rate.
+ *
+ * For every common AudioContext sample rate, reports the subharmonic and
+ * quantization scale the waveform generator measures to be best, the level
+ * it puts on the target frequency, how far the station's low level strays
+ * from nominal, and how far the target stands above its nearest neighboring
+ * harmonics. Levels account for the images of a zero-order hold DAC, but not
+ * for whatever reconstruction filter follows it.
+ *
+ * The fixed choice used before (direct if possible, else the 3rd or 5th
+ * subharmonic at a scale of the sample rate over the subharmonic number) is
+ * reported alongside for comparison.
+ *
+ * Usage: synthsweep
+ *
+ * Exits with a nonzero status if any choice is worse than the fixed one in
+ * level or in distortion of the low level.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include "waveform.h"
+
+double tsig_native_now;
+
+static const uint32_t kSampleRates[] = {22050, 32000, 44100,
+                                        48000, 96000, 192000};
+
+static const struct {
+  const char *name;
+  uint8_t station;
+  uint8_t jjy_khz;
+} kConfigs[] = {
+    {"BPC", TSIG_STATION_BPC, TSIG_JJYKHZ_40},
+    {"DCF77", TSIG_STATION_DCF77, TSIG_JJYKHZ_40},
+    {"JJY40", TSIG_STATION_JJY, TSIG_JJYKHZ_40},
+    {"JJY60", TSIG_STATION_JJY, TSIG_JJYKHZ_60},
+    {"MSF", TSIG_STATION_MSF, TSIG_JJYKHZ_40},
+    {"WWVB", TSIG_STATION_WWVB, TSIG_JJYKHZ_40},
+};
+
+static double sweep_db(double amplitude) {
+  return amplitude > 0 ? 20.0 * log10(amplitude) : -INFINITY;
+}
+
+/* Returns how far the low level strays from nominal, in dB. */
+static double sweep_low_err_db(uint32_t sample_rate, uint32_t target_hz,
+                               uint8_t sub, int scale, float xmit_low,
+                               double level) {
+  if (xmit_low <= 0.0F)
+    return 0.0;
+
+  double low =
+      tsig_waveform_measure(sample_rate, target_hz, sub, scale, xmit_low);
+  return sweep_db(low / level / xmit_low);
+}
+
+/* Returns the target's level over that of its strongest neighbor, in dB. */
+static double sweep_purity_db(uint32_t sample_rate, uint32_t target_hz,
+                              uint8_t sub, int scale, double level) {
+  double f_sub = (double)target_hz / sub;
+  double worst = 0.0;
+
+  tsig_waveform_measure(sample_rate, target_hz, sub, scale, 1.0F);
+  for (int k = sub - 2; k <= sub + 2; k += 4) {
+    if (k < 1)
+      continue;
+    double amplitude = tsig_analyzer_goertzel(
+        TSIG_WAVEFORM_SYNTH_BUF, TSIG_WAVEFORM_SYNTH_ANALYSIS_LEN, k * f_sub,
+        sample_rate);
+    amplitude *= tsig_analyzer_image_gain(k * f_sub, sample_rate);
+    if (amplitude > worst)
+      worst = amplitude;
+  }
+
+  return sweep_db(level / worst);
+}
+
+static int sweep(int i, uint32_t sample_rate) {
+  tsig_params_t params = {.station = kConfigs[i].station,
+                          .jjy_khz = kConfigs[i].jjy_khz};
+  float xmit_low = TSIG_WAVEFORM_STATION_DATA[params.station].xmit_low;
+  tsig_waveform_synth_t *synth = tsig_waveform_choose_synth(&params,
+                                                            sample_rate);
+  uint32_t target_hz = synth->target_hz;
+  double image_gain = tsig_analyzer_image_gain(target_hz, sample_rate);
+
+  uint8_t old_sub = tsig_calculate_subharmonic(target_hz, sample_rate);
+  int old_scale = sample_rate / old_sub;
+  double old_level = tsig_waveform_measure(sample_rate, target_hz, old_sub,
+                                           old_scale, 1.0F);
+  double old_err_db = sweep_low_err_db(sample_rate, target_hz, old_sub,
+                                       old_scale, xmit_low, old_level);
+
+  double err_db = sweep_low_err_db(sample_rate, target_hz, synth->subharmonic,
+                                   synth->scale, xmit_low, synth->level);
+  double purity_db = sweep_purity_db(sample_rate, target_hz,
+                                     synth->subharmonic, synth->scale,
+                                     synth->level * image_gain);
+
+  /*
+   * The choice must not put less energy on the target than the fixed one did
+   * without distorting the low level, nor distort the low level more, nor put
+   * only noise there unless the fixed one did too.
+   */
+  uint8_t old_heard = old_level > TSIG_WAVEFORM_SYNTH_FLOOR;
+  uint8_t old_ok =
+      old_heard && fabs(old_err_db) <= TSIG_WAVEFORM_SYNTH_LOW_TOL_DB;
+  uint8_t ok = fabs(err_db) <= TSIG_WAVEFORM_SYNTH_LOW_TOL_DB;
+  uint8_t failed =
+      (old_heard && !(synth->level > TSIG_WAVEFORM_SYNTH_FLOOR)) ||
+      (old_ok && (!ok || synth->level < old_level *
+                                            (1.0 - TSIG_WAVEFORM_SYNTH_TIE))) ||
+      (!ok && old_heard && fabs(err_db) > fabs(old_err_db));
+
+  printf("%-6s %6u %3u %5d %9.1f %7.1f %9.1f %4u %5d %9.1f %7.1f%s\n",
+         kConfigs[i].name, sample_rate, synth->subharmonic, synth->scale,
+         sweep_db(synth->level * image_gain), err_db, purity_db, old_sub,
+         old_scale, sweep_db(old_level * image_gain), old_err_db,
+         failed ? "  FAIL" : "");
+
+  return failed;
+}
+
+int main() {
+  int n_configs = sizeof(kConfigs) / sizeof(*kConfigs);
+  int n_rates = sizeof(kSampleRates) / sizeof(*kSampleRates);
+  int failures = 0;
+
+  printf("%-6s %6s %3s %5s %9s %7s %9s %4s %5s %9s %7s\n", "", "rate", "sub",
+         "scale", "level_db", "low_db", "purity_db", "old", "scale",
+         "level_db", "low_db");
+
+  for (int i = 0; i < n_configs; i++)
+    for (int j = 0; j < n_rates; j++)
+      failures += sweep(i, kSampleRates[j]);
+
+  printf("%s\n", failures ? "FAILED" : "PASSED");
+
+  return failures ? 1 : 0;
+}
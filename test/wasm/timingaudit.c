@@ -0,0 +1,351 @@
+/**
+ * Native timing-accuracy audit for the time signal waveform generator.
+ *
+ * For every station, common AudioContext sample rate, and a few user offsets
+ * that are not whole milliseconds, simulates a transmission lasting one or
+ * more days and measures the absolute error between each rendered edge (a
+ * change of transmit level or phase modulation) and the UTC instant at which
+ * that edge was intended to occur.
+ *
+ * Each run also emulates an audio output device whose sample clock is off by
+ * some ppm, with the waveform corrected for it (and rebased every hour, as
+ * happens whenever the estimate is refined), so edge instants are computed
+ * from the emulated device's true sample rate. Every hour, output latency
+ * also changes by most of a sample just before an edge, as happens while the
+ * worklet slews towards a new latency, and some render quantums are dropped,
+ * after which the waveform is resynchronized.
+ *
+ * Rendering every sample of a multi-day transmission would take hours, so the
+ * simulation instead jumps from edge to edge, letting the waveform context
+ * schedule each edge exactly as tsig_waveform_generate() does. Nothing
+ * changes between edges.
+ *
+ * Also checks that every edge of a reference frame generated for the intended
+ * instant is rendered, in order, with its transmit level and phase
+ * modulation, and measures the carrier phase at each minute boundary (which
+ * should coincide with a rising zero crossing) and the timing of phase chips.
+ *
+ * Usage: timingaudit [DAYS]
+ *
+ * DAYS is the length of each simulated transmission (default: 1, max: 7).
+ * Exits with a nonzero status if any error exceeds its bound: one sample
+ * period, as each edge is rendered at the first sample at or after its
+ * instant, plus the rounding of two timestamps (22.9 us at 44.1 kHz).
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include "waveform.h"
+
+#define AUDIT_MAX_DAYS     7
+/*
+ * Allowance for rounding: a millisecond timestamp in this century is a double
+ * with a resolution of 2^-12 ms, and both ends of an error are rounded.
+ */
+#define AUDIT_SLACK_US     (2 * 1000.0 / 4096)
+#define AUDIT_SECS_PER_DAY 86400
+#define AUDIT_REBASE_SECS  3600ULL
+#define AUDIT_GAP(rate)    ((rate) * 3 / 10 + 17) /* Dropped samples. */
+
+double tsig_native_now;
+
+/* Saturday, March 30, 2024 22:17:41.0625 UTC; spans the EU DST changeover. */
+static const double kStartTimestamp = 1711837061062.5;
+
+static const uint32_t kSampleRates[] = {44100, 48000, 88200, 96000, 176400, 192000};
+
+static const struct {
+  double offset;
+  int32_t ppb;
+} kRuns[] = {
+    {0.0, 0},
+    {333.333, 48000},
+    {-4567.891, -125000},
+};
+
+static const struct {
+  const char *name;
+  uint8_t station;
+  uint8_t jjy_khz;
+} kStations[] = {
+    {"BPC", TSIG_STATION_BPC, TSIG_JJYKHZ_40},
+    {"DCF77", TSIG_STATION_DCF77, TSIG_JJYKHZ_40},
+    {"JJY40", TSIG_STATION_JJY, TSIG_JJYKHZ_40},
+    {"JJY60", TSIG_STATION_JJY, TSIG_JJYKHZ_60},
+    {"MSF", TSIG_STATION_MSF, TSIG_JJYKHZ_40},
+    {"WWVB", TSIG_STATION_WWVB, TSIG_JJYKHZ_40},
+};
+
+/** Results of a single simulated transmission. */
+typedef struct audit_result_t {
+  uint64_t edges;      /** Count of edges. */
+  uint64_t mismatches; /** Count of edges missed or with a wrong state. */
+  double max_us;       /** Maximum absolute edge error. */
+  double sum_us;       /** Sum of absolute edge errors. */
+  double first_max_us; /** Maximum absolute edge error during first hour. */
+  double last_max_us;  /** Maximum absolute edge error during last hour. */
+  double slope_us;     /** Least-squares edge error growth per day. */
+  double phase_max_us; /** Maximum carrier phase error at minute boundaries. */
+  double chip_max_us;  /** Maximum phase chip timing error. */
+} audit_result_t;
+
+/** Reference frame for one station minute. */
+typedef struct audit_ref_t {
+  tsig_waveform_frame_t frame;
+  double min_ms; /** Station timestamp at which the minute begins. */
+} audit_ref_t;
+
+/* Find the reference edge in effect at a station timestamp. */
+static int audit_ref_find(audit_ref_t *ref, tsig_params_t *params, double ms) {
+  double min_ms = floor(ms / TSIG_DATETIME_MSECS_MIN);
+  min_ms *= TSIG_DATETIME_MSECS_MIN;
+
+  if (min_ms != ref->min_ms) {
+    tsig_datetime_t datetime = tsig_datetime_parse_timestamp(min_ms);
+    tsig_waveform_gen_frame(&ref->frame, datetime, params);
+    ref->min_ms = min_ms;
+  }
+
+  return tsig_waveform_find_edge(&ref->frame, 1000.0 * (ms - min_ms));
+}
+
+/* Station timestamp of a reference edge, or of the next minute if none. */
+static double audit_ref_ms(audit_ref_t *ref, int i) {
+  double ms = i < ref->frame.len ? ref->frame.edges[i].us / 1000.0
+                                 : TSIG_DATETIME_MSECS_MIN;
+  return ref->min_ms + ms;
+}
+
+static uint8_t audit_ref_ok(tsig_waveform_edge_t *edge,
+                            tsig_waveform_ctx_t *ctx, tsig_params_t *params) {
+  waveform_station_data_t *data = &TSIG_WAVEFORM_STATION_DATA[params->station];
+  uint8_t is_inverted = edge->phase & TSIG_WAVEFORM_PHASE_INVERTED;
+  float level = edge->level == TSIG_WAVEFORM_LEVEL_HIGH  ? 1.0F
+                : edge->level == TSIG_WAVEFORM_LEVEL_LOW ? data->xmit_low
+                                                         : 0.0F;
+
+  if (tsig_waveform_level(ctx, params) != level)
+    return 0;
+
+  if (!data->chip_cycles)
+    return ctx->phase_shift == is_inverted * TSIG_WAVEFORM_HALF_CYCLE;
+
+  int64_t step = (int64_t)ctx->chip_dev;
+  if (!(edge->phase & TSIG_WAVEFORM_PHASE_SPREAD))
+    step = 0;
+  return !ctx->phase_shift && ctx->chip_step == (is_inverted ? -step : step);
+}
+
+/** State of a single simulated transmission. */
+typedef struct audit_state_t {
+  tsig_waveform_ctx_t ctx;
+  tsig_params_t params;
+  audit_ref_t ref;
+  audit_result_t result;
+  double base_ms;    /** True station timestamp of the first sample. */
+  double true_rate;  /** True sample rate of the emulated output device. */
+  double shift_ms;   /** Total change in emulated output latency. */
+  uint64_t end;      /** Sample count at which the transmission ends. */
+  double expect_ms;  /** Station timestamp of the next reference edge. */
+  uint8_t resynced;  /** Whether the waveform was just resynchronized. */
+  double sx, sy, sxx, sxy; /** Least-squares sums for edge error growth. */
+} audit_state_t;
+
+static void audit_edge(audit_state_t *st) {
+  tsig_waveform_ctx_t *ctx = &st->ctx;
+  audit_result_t *result = &st->result;
+  audit_ref_t *ref = &st->ref;
+  uint32_t sample_rate = ctx->sample_rate;
+
+  tsig_waveform_update_edge(ctx, &st->params);
+
+  double carrier_ms = st->base_ms + 1000.0 * ctx->samples / st->true_rate;
+  double ms = carrier_ms + st->shift_ms;
+  int i = audit_ref_find(ref, &st->params, ms + AUDIT_SLACK_US / 1000.0);
+  double edge_ms = audit_ref_ms(ref, i);
+
+  /*
+   * At the start and after resynchronization, the waveform joins mid-edge,
+   * so there is no instant to measure. Otherwise it must render the very
+   * edge that follows the last one.
+   */
+  uint8_t is_joined = !ctx->samples || st->resynced;
+  st->resynced = 0;
+
+  if (!audit_ref_ok(&ref->frame.edges[i], ctx, &st->params) ||
+      (!is_joined && edge_ms != st->expect_ms) ||
+      ctx->frame.len >= TSIG_WAVEFORM_MAX_EDGES || ctx->frame.overflowed)
+    result->mismatches++;
+  st->expect_ms = audit_ref_ms(ref, i + 1);
+
+  /* Chips should begin at the intended instant, like other edges. */
+  if (ctx->chip_step) {
+    double sec_ms = floor(edge_ms / 1000.0) * 1000.0;
+    double chips = ctx->chip_phase / TSIG_WAVEFORM_CYCLE *
+                   TSIG_WAVEFORM_CHIP_TABLE_LEN;
+    double err = 1000.0 * chips / ctx->chip_hz -
+                 (ms - sec_ms - TSIG_WAVEFORM_DCF77_CHIP_MS);
+    result->chip_max_us = fmax(result->chip_max_us, 1000.0 * fabs(err));
+  }
+
+  if (is_joined)
+    return;
+
+  double err_us = 1000.0 * fabs(ms - edge_ms);
+  double day = (double)ctx->samples / sample_rate / AUDIT_SECS_PER_DAY;
+
+  result->edges++;
+  result->sum_us += err_us;
+  result->max_us = fmax(result->max_us, err_us);
+  if (ctx->samples < 3600ULL * sample_rate)
+    result->first_max_us = fmax(result->first_max_us, err_us);
+  if (ctx->samples >= st->end - 3600ULL * sample_rate)
+    result->last_max_us = fmax(result->last_max_us, err_us);
+
+  st->sx += day;
+  st->sy += err_us;
+  st->sxx += day * day;
+  st->sxy += day * err_us;
+
+  /*
+   * A minute should begin at a rising zero crossing of the carrier. Latency
+   * changes do not disturb the carrier, so they are disregarded here.
+   */
+  if (!i) {
+    double f_sub = ctx->subharmonic_hz;
+    double phase = ctx->phase / TSIG_WAVEFORM_CYCLE;
+    double err = phase - (carrier_ms - edge_ms) / 1000.0 * f_sub;
+    err -= round(err);
+    result->phase_max_us = fmax(result->phase_max_us, fabs(err) / f_sub * 1e6);
+  }
+}
+
+static inline uint64_t audit_min(uint64_t a, uint64_t b) {
+  return a < b ? a : b;
+}
+
+static audit_result_t audit_run(uint8_t station, uint8_t jjy_khz,
+                                uint32_t sample_rate, double offset,
+                                int32_t ppb, int days) {
+  static audit_state_t st;
+  st = (audit_state_t){
+      .ctx = {.sample_rate = sample_rate},
+      .params = {.offset = offset, .station = station, .jjy_khz = jjy_khz},
+      .ref = {.min_ms = -1},
+      .true_rate = sample_rate * (1.0 + ppb * 1e-9),
+      .end = (uint64_t)days * AUDIT_SECS_PER_DAY * sample_rate,
+  };
+  tsig_waveform_ctx_t *ctx = &st.ctx;
+
+  tsig_native_now = kStartTimestamp;
+  tsig_waveform_init(ctx, &st.params,
+                     tsig_waveform_choose_synth(&st.params, sample_rate));
+  tsig_waveform_set_ppb(ctx, &st.params, ppb);
+  st.base_ms = ctx->timestamp + offset;
+
+  /* Rebase between edges, as happens when the worklet refines its estimate. */
+  uint64_t next_rebase = AUDIT_REBASE_SECS * sample_rate + sample_rate / 7;
+  uint64_t next_shift = UINT64_MAX;
+  int shifts = 0;
+
+  while (ctx->samples < st.end) {
+    if (ctx->samples == next_rebase) {
+      tsig_waveform_set_ppb(ctx, &st.params, ppb);
+      next_rebase += AUDIT_REBASE_SECS * sample_rate;
+
+      tsig_waveform_resync(ctx, ctx->samples + AUDIT_GAP(sample_rate));
+      st.resynced = 1;
+      audit_edge(&st);
+
+      next_shift = tsig_max(ctx->next_edge - 1, ctx->samples);
+    }
+
+    if (ctx->samples == next_shift) {
+      double ms = (shifts++ % 2 ? -0.75 : 0.75) * 1000.0 / sample_rate;
+      tsig_waveform_shift(ctx, &st.params, ms);
+      st.shift_ms += ms;
+      next_shift = UINT64_MAX;
+    }
+
+    if (ctx->samples == ctx->next_edge)
+      audit_edge(&st);
+
+    uint64_t next = audit_min(ctx->next_edge, audit_min(next_rebase, next_shift));
+    tsig_waveform_skip(ctx, next - ctx->samples);
+  }
+
+  double n = st.result.edges;
+  double denom = n * st.sxx - st.sx * st.sx;
+  if (n > 1 && denom)
+    st.result.slope_us = (n * st.sxy - st.sx * st.sy) / denom;
+
+  return st.result;
+}
+
+int main(int argc, char *argv[]) {
+  int days = argc > 1 ? atoi(argv[1]) : 1;
+  if (days < 1 || days > AUDIT_MAX_DAYS) {
+    fprintf(stderr, "usage: %s [DAYS (1-%d)]\n", argv[0], AUDIT_MAX_DAYS);
+    return 2;
+  }
+
+  int n_stations = sizeof(kStations) / sizeof(*kStations);
+  int n_rates = sizeof(kSampleRates) / sizeof(*kSampleRates);
+  int n_runs = sizeof(kRuns) / sizeof(*kRuns);
+  double worst_max_us = 0, worst_phase_us = 0, worst_chip_us = 0, sum_us = 0;
+  double worst_share = 0;
+  uint64_t edges = 0;
+  int failures = 0;
+
+  printf("Simulating %d day(s) per run.\n\n", days);
+  printf("%-6s %6s %10s %8s %8s %9s %9s %9s %9s %11s %9s %9s\n", "", "rate",
+         "offset_ms", "ppm", "edges", "max_us", "mean_us", "1st_hr", "last_hr",
+         "growth/day", "phase_us", "chip_us");
+
+  for (int i = 0; i < n_stations; i++) {
+    for (int j = 0; j < n_rates; j++) {
+      for (int k = 0; k < n_runs; k++) {
+        uint32_t rate = kSampleRates[j];
+        audit_result_t r = audit_run(kStations[i].station,
+                                     kStations[i].jjy_khz, rate,
+                                     kRuns[k].offset, kRuns[k].ppb, days);
+
+        double limit_us = 1e6 / rate + AUDIT_SLACK_US;
+        uint8_t failed = !r.edges || r.mismatches || r.max_us > limit_us ||
+                         r.phase_max_us > limit_us || r.chip_max_us > limit_us;
+        failures += failed;
+
+        printf("%-6s %6u %10.3f %8.3f %8llu %9.3f %9.3f %9.3f %9.3f %11.4f "
+               "%9.3f %9.3f%s\n",
+               kStations[i].name, rate, kRuns[k].offset, kRuns[k].ppb / 1e3,
+               (unsigned long long)r.edges, r.max_us,
+               r.edges ? r.sum_us / r.edges : 0.0, r.first_max_us,
+               r.last_max_us, r.slope_us, r.phase_max_us, r.chip_max_us,
+               failed ? "  FAIL" : "");
+        if (r.mismatches)
+          printf("  %llu edge(s) missed, with the wrong level or phase, or "
+                 "in a full frame\n",
+                 (unsigned long long)r.mismatches);
+
+        worst_max_us = fmax(worst_max_us, r.max_us);
+        worst_share = fmax(worst_share, r.max_us / limit_us);
+        worst_phase_us = fmax(worst_phase_us, r.phase_max_us);
+        worst_chip_us = fmax(worst_chip_us, r.chip_max_us);
+        sum_us += r.sum_us;
+        edges += r.edges;
+      }
+    }
+  }
+
+  printf("\nOverall: %llu edges, max error %.3f us, mean error %.3f us, "
+         "max phase error %.3f us, max chip error %.3f us\n",
+         (unsigned long long)edges, worst_max_us, edges ? sum_us / edges : 0.0,
+         worst_phase_us, worst_chip_us);
+  printf("Worst edge error is %.1f%% of its bound, one sample plus %.3f us\n",
+         100.0 * worst_share, AUDIT_SLACK_US);
+  printf("%s\n", failures ? "FAILED" : "PASSED");
+
+  return failures ? 1 : 0;
+}
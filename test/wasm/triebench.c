@@ -0,0 +1,271 @@
+/**
+ * Native benchmark of the trie walk against a trie built out of nodes.
+ *
+ * Adds every locale in the locale table to the edit distance module, then
+ * scores pasted queries, locale tags and display names with a few random
+ * typos in them, by edist_traverse() over the strings in sorted order, and
+ * by the same depth-first traversal over a trie of nodes, each a code point
+ * with links to its first child and next sibling. Both keep a column of the
+ * kernel per depth and prune a node whose column bounds every string below
+ * it to worse than the kth best score so far. The node trie is built once,
+ * outside the timed region, but each query first marks the nodes above some
+ * candidate, so that like the walk it only steps into strings that may rank.
+ * Runs are repeated and the fastest of each is kept, to filter out
+ * scheduling and frequency scaling noise.
+ *
+ * Also reports the memory each needs: the node trie needs a node per code
+ * point of string storage in the worst case, where the walk needs the
+ * sorted order and a common prefix length per string.
+ *
+ * Usage: triebench [QUERIES]
+ *
+ * QUERIES is the count of random queries (default: 2000).
+ * Exits with a nonzero status if the two ever rank locales differently.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+#include "editdistance.c"
+
+#define TRIE_REPS     5
+#define TRIE_TOP_K    30 /* kMaxSuggestions in localesearchbox.ts */
+#define TRIE_TYPOS    3
+#define TRIE_NO_NODE  UINT16_MAX
+#define TRIE_MAX_NODES \
+  (EDIST_TABLE_POOL_SIZE + 1) /* Table strings only, and the root. */
+
+/* Letters that typos are made of. */
+static const uint32_t kTypos[] = {
+    'a', 'e', 'i', 'n', 'o', 'r', 's', 't', ' ', '-', 0x00e9, 0x0430,
+};
+
+/* Trie of the strings, node 0 being the root. */
+static struct {
+  uint32_t point[TRIE_MAX_NODES];   /* Code point leading to each node. */
+  uint16_t child[TRIE_MAX_NODES];   /* First child, in sorted order. */
+  uint16_t sibling[TRIE_MAX_NODES]; /* Next sibling, in sorted order. */
+  uint16_t parent[TRIE_MAX_NODES];
+  uint16_t ends[TRIE_MAX_NODES];    /* First string ending at each node. */
+  uint16_t next_end[EDIST_MAX_STRINGS]; /* Next string ending at its node. */
+  uint16_t end_node[EDIST_MAX_STRINGS]; /* Node each string ends at. */
+  uint8_t live[TRIE_MAX_NODES];     /* Whether above some candidate. */
+  uint16_t count;
+} trie;
+
+static double trie_now_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* Builds the node trie from the strings in the sorted order. */
+static void trie_build() {
+  uint16_t path[EDIST_MAX_STRING_LEN + 1] = {0};
+  uint16_t last[TRIE_MAX_NODES];
+
+  trie.count = 1;
+  trie.child[0] = trie.sibling[0] = trie.ends[0] = last[0] = TRIE_NO_NODE;
+
+  for (uint16_t j = 0; j < 2 * edist_ctx.count; j++) {
+    uint16_t s = edist_ctx.sorted[j];
+    uint8_t len, depth = j ? edist_ctx.lcps[j] : 0;
+    const uint32_t *text = edist_string(s, &len);
+
+    for (; depth < len; depth++) {
+      uint16_t node = trie.count++, up = path[depth];
+      trie.point[node] = text[depth];
+      trie.child[node] = trie.sibling[node] = TRIE_NO_NODE;
+      trie.ends[node] = last[node] = TRIE_NO_NODE;
+      trie.parent[node] = up;
+      if (last[up] == TRIE_NO_NODE)
+        trie.child[up] = node;
+      else
+        trie.sibling[last[up]] = node;
+      last[up] = node;
+      path[depth + 1] = node;
+    }
+
+    /* Strings ending at a node keep their sorted order. */
+    uint16_t *end = &trie.ends[path[len]];
+    while (*end != TRIE_NO_NODE)
+      end = &trie.next_end[*end];
+    *end = s;
+    trie.next_end[s] = TRIE_NO_NODE;
+    trie.end_node[s] = path[len];
+  }
+}
+
+/* Visits a node whose column is at the top of `stack`, and what is below. */
+static void trie_visit(edist_tally_t *t, const edist_pattern_t *pattern,
+                       uint8_t len, uint16_t node,
+                       edist_osa_state_t stack[], uint8_t depth,
+                       const uint8_t cands[], const uint8_t bounds[]) {
+  for (uint16_t s = trie.ends[node]; s != TRIE_NO_NODE; s = trie.next_end[s])
+    if (edist_mask_has(cands, s >> 1) && bounds[s >> 1] <= t->max_dist)
+      edist_tally(t, s >> 1, stack[depth].dist);
+
+  for (uint16_t c = trie.child[node]; c != TRIE_NO_NODE; c = trie.sibling[c]) {
+    if (!trie.live[c])
+      continue;
+    if (edist_osa_bound(&stack[depth], len, depth) > t->max_dist)
+      return;
+    stack[depth + 1] = stack[depth];
+    edist_osa_step(&stack[depth + 1],
+                   edist_pattern_match(pattern, trie.point[c]), len);
+    trie_visit(t, pattern, len, c, stack, depth + 1, cands, bounds);
+  }
+}
+
+/* Scores candidates as edist_traverse() does, over the node trie. */
+static void trie_traverse(edist_tally_t *t, const uint32_t query[],
+                          uint8_t len, const uint8_t cands[],
+                          const uint8_t bounds[]) {
+  edist_pattern_t pattern;
+  edist_osa_state_t stack[EDIST_MAX_STRING_LEN + 1];
+
+  memset(trie.live, 0, trie.count);
+  for (uint16_t s = 0; s < 2 * edist_ctx.count; s++) {
+    if (!edist_mask_has(cands, s >> 1))
+      continue;
+    for (uint16_t n = trie.end_node[s]; n && !trie.live[n];
+         n = trie.parent[n])
+      trie.live[n] = 1;
+  }
+
+  edist_pattern_init(&pattern, (uint32_t *)query, len);
+  edist_osa_init(&stack[0], len);
+  trie_visit(t, &pattern, len, 0, stack, 0, cands, bounds);
+}
+
+/* Makes a query of a random tag or display name with a few random typos. */
+static uint8_t trie_query(uint32_t query[], unsigned *seed) {
+  uint8_t len;
+  const uint32_t *text = edist_string(rand_r(seed) % (2 * edist_ctx.count),
+                                      &len);
+  uint8_t typos = rand_r(seed) % (TRIE_TYPOS + 1);
+
+  len = edist_min(len, EDIST_MAX_CODE_UNITS);
+  memcpy(query, text, len * sizeof(*query));
+  for (uint8_t n = 0; n < typos && len > 1; n++) {
+    uint8_t at = rand_r(seed) % len;
+    uint32_t c = kTypos[rand_r(seed) % (sizeof(kTypos) / sizeof(*kTypos))];
+    switch (rand_r(seed) % 3) {
+    case 0:
+      query[at] = c;
+      break;
+    case 1:
+      memmove(&query[at], &query[at + 1], (len - at - 1) * sizeof(*query));
+      len--;
+      break;
+    default:
+      if (len == EDIST_MAX_CODE_UNITS)
+        break;
+      memmove(&query[at + 1], &query[at], (len - at) * sizeof(*query));
+      query[at] = c;
+      len++;
+    }
+  }
+
+  /* Fake script subtags are never typed. */
+  for (uint8_t i = 0; i < len; i++)
+    query[i] += !query[i];
+  return len;
+}
+
+/* Ranks the tally's scores as edist_run() does, into `out`. */
+static void trie_rank(const edist_tally_t *t, const uint8_t cands[],
+                      uint16_t out[]) {
+  uint16_t starts[UINT8_MAX + 1] = {0};
+  for (uint16_t score = 1; score <= UINT8_MAX; score++)
+    starts[score] = starts[score - 1] + t->hist[score - 1];
+  for (uint16_t i = 0; i < edist_ctx.count; i++)
+    if (edist_mask_has(cands, i) && starts[edist_ctx.buf[i]] < t->k)
+      out[starts[edist_ctx.buf[i]]++] = i;
+}
+
+int main(int argc, char *argv[]) {
+  int queries = argc > 1 ? atoi(argv[1]) : 2000;
+  if (queries < 1) {
+    fprintf(stderr, "usage: %s [QUERIES]\n", argv[0]);
+    return 2;
+  }
+
+  static uint32_t query_set[10000][EDIST_MAX_CODE_UNITS];
+  static uint8_t query_lens[10000];
+  static uint8_t bounds[EDIST_MAX_LOCALES];
+  uint8_t cands[EDIST_MASK_SIZE] = {0};
+  uint16_t walked[TRIE_TOP_K], visited[TRIE_TOP_K];
+  double best_walk_ns = INFINITY, best_node_ns = INFINITY;
+  uint64_t mismatches = 0, checksum = 0;
+  unsigned seed = 1;
+
+  if (queries > 10000)
+    queries = 10000;
+
+  edist_reset();
+  for (int i = 0; i < EDIST_TABLE_LOCALES; i++)
+    mismatches += edist_add_locale(i) != i;
+  for (int i = 0; i < edist_ctx.count; i++)
+    cands[i / 8] |= 1 << (i % 8);
+  edist_index();
+  trie_build();
+  for (int q = 0; q < queries; q++)
+    query_lens[q] = trie_query(query_set[q], &seed);
+
+  for (int rep = 0; rep < TRIE_REPS; rep++) {
+    double walk_ns = 0, node_ns = 0;
+
+    for (int q = 0; q < queries; q++) {
+      const uint32_t *query = query_set[q];
+      uint8_t len = query_lens[q];
+      uint8_t grams = edist_count_hits(query, len, edist_ctx.hits);
+      edist_tally_t tally;
+
+      for (uint16_t i = 0; i < edist_ctx.count; i++)
+        bounds[i] = edist_bound(i, len, grams, grams ? edist_ctx.hits[i] : 0);
+
+      double start_ns = trie_now_ns();
+      edist_tally_init(&tally, edist_ctx.count, TRIE_TOP_K);
+      edist_traverse(&tally, query, len, cands, bounds);
+      walk_ns += trie_now_ns() - start_ns;
+      trie_rank(&tally, cands, walked);
+
+      start_ns = trie_now_ns();
+      edist_tally_init(&tally, edist_ctx.count, TRIE_TOP_K);
+      trie_traverse(&tally, query, len, cands, bounds);
+      node_ns += trie_now_ns() - start_ns;
+      trie_rank(&tally, cands, visited);
+
+      mismatches += memcmp(walked, visited, sizeof(walked)) != 0;
+      checksum += walked[0];
+    }
+
+    best_walk_ns = fmin(best_walk_ns, walk_ns / queries);
+    best_node_ns = fmin(best_node_ns, node_ns / queries);
+  }
+
+  printf("%d locales, %d strings, %u nodes, %d queries, top %d.\n\n",
+         edist_ctx.count, 2 * edist_ctx.count, trie.count, queries,
+         TRIE_TOP_K);
+  printf("%-6s %11s %8s %15s\n", "trie", "query_us", "speedup",
+         "worst_case_kib");
+  printf("%-6s %11.2f %7.2fx %15.1f\n", "sorted", best_walk_ns / 1000.0,
+         1.0, (sizeof(edist_ctx.sorted) + sizeof(edist_ctx.lcps)) / 1024.0);
+  printf("%-6s %11.2f %7.2fx %15.1f\n", "nodes", best_node_ns / 1000.0,
+         best_walk_ns / best_node_ns,
+         ((EDIST_TABLE_POOL_SIZE + EDIST_ARENA_SIZE + 1) *
+              (sizeof(*trie.point) + sizeof(*trie.child) +
+               sizeof(*trie.sibling) + sizeof(*trie.parent) +
+               sizeof(*trie.ends) + sizeof(*trie.live)) +
+          sizeof(trie.next_end) + sizeof(trie.end_node)) /
+             1024.0);
+
+  printf("\nMismatched queries %llu, checksum %llu\n",
+         (unsigned long long)mismatches, (unsigned long long)checksum);
+  printf("%s\n", mismatches ? "FAILED" : "PASSED");
+
+  return mismatches ? 1 : 0;
+}
@@ -0,0 +1,168 @@
+/**
+ * Native benchmark of edit distance queries typed into the search box.
+ *
+ * Adds every locale in the locale table to the edit distance module, then
+ * replays typing sessions, each a sequence of keystrokes that type a code
+ * point or, as '\b', delete the last one, typos and all. Every keystroke
+ * searches for the text typed so far, as the search box does. Each
+ * session is replayed as is, letting the module pick up from the last query,
+ * and again forgetting its state before every keystroke, so that each query
+ * is evaluated from scratch. Replays are repeated and the fastest of each is
+ * kept, to filter out scheduling and frequency scaling noise. Also counts
+ * the batches of EDIST_LANES strings that picking up from the last query
+ * evaluates for each keystroke, out of every one.
+ *
+ * Usage: typingbench [REPS]
+ *
+ * REPS is the count of times to replay each session (default: 200).
+ * Exits with a nonzero status if picking up from the last query ever ranks
+ * locales differently than evaluating from scratch.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+#include <uchar.h>
+#include "editdistance.c"
+
+#define TYPING_TOP_K          30 /* kMaxSuggestions in localesearchbox.ts */
+#define TYPING_MAX_KEYSTROKES 64
+
+static const struct {
+  const char *name;
+  const char16_t *keys;
+} kSessions[] = {
+    {"english", u"english (united states)"},
+    {"typos", u"engl\bl\bish (ca\b\bunited kingdon\bm)"},
+    {"fuzzy", u"engilsh (untied statse)"},
+    {"deutsch", u"deutch\b\bsch (schweiz)"},
+    {"restart", u"protu\b\b\b\bortugues (brazil\b\bsil)"},
+    {"tag", u"zh-tw\b\b\b-hant-tw"},
+    {"kana", u"にほんご\b\b\b\b日本語"},
+    {"cyrillic", u"руск\bский"},
+    {"emoji", u"\U0001f596\b\U0001f596 sr\b\bsrpski (latinica)"},
+};
+
+static double typing_now_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/*
+ * Types the keystroke at `*key` into `text`, returning its new length and
+ * moving `*key` past it. A surrogate pair is typed or deleted at once.
+ */
+static uint8_t typing_key(uint16_t text[], uint8_t len, const char16_t **key) {
+  if (*(*key)++ == '\b') {
+    if (len > 1 && edist_is_surrogate(text[len - 2]))
+      return len - 2;
+    return len ? len - 1 : 0;
+  }
+
+  text[len++] = (*key)[-1];
+  if (edist_is_surrogate(text[len - 1]) && edist_is_surrogate(**key))
+    text[len++] = *(*key)++;
+  return len;
+}
+
+/* Counts the batches with a state for the whole query so far. */
+static int typing_synced() {
+  int n = 0;
+  for (int b = 0; b * EDIST_LANES < 2 * edist_ctx.count; b++)
+    for (int h = 0; h < EDIST_HISTORY; h++)
+      if (edist_ctx.at[b][h] == edist_ctx.prefix_len) {
+        n++;
+        break;
+      }
+  return n;
+}
+
+/*
+ * Replays a session, forgetting state before every keystroke if `cold`.
+ * Leaves the locales ranked at each keystroke in `ranked`, adds the time
+ * spent searching to `ns`, and adds the batches evaluated for each keystroke
+ * to `batches`. Returns the count of keystrokes.
+ */
+static int typing_replay(const char16_t *keys, uint8_t cold,
+                         uint16_t ranked[][TYPING_TOP_K + 1], double *ns,
+                         int *batches) {
+  uint16_t text[EDIST_MAX_CODE_UNITS];
+  uint8_t len = 0;
+  int n_keys = 0;
+
+  edist_forget();
+  while (*keys) {
+    uint8_t *buf = edist_get_buf_ptr();
+    len = typing_key(text, len, &keys);
+    memcpy(buf, text, len * sizeof(*text));
+
+    double start_ns = typing_now_ns();
+    if (cold)
+      edist_forget();
+    uint16_t k = edist_search(len, TYPING_TOP_K);
+    *ns += typing_now_ns() - start_ns;
+    *batches += typing_synced();
+
+    ranked[n_keys][0] = k;
+    memcpy(&ranked[n_keys++][1], buf, k * sizeof(**ranked));
+  }
+
+  return n_keys;
+}
+
+int main(int argc, char *argv[]) {
+  int reps = argc > 1 ? atoi(argv[1]) : 200;
+  if (reps < 1) {
+    fprintf(stderr, "usage: %s [REPS]\n", argv[0]);
+    return 2;
+  }
+
+  static uint16_t warm[TYPING_MAX_KEYSTROKES][TYPING_TOP_K + 1];
+  static uint16_t cold[TYPING_MAX_KEYSTROKES][TYPING_TOP_K + 1];
+  uint64_t mismatches = 0;
+  int n_sessions = sizeof(kSessions) / sizeof(*kSessions);
+
+  edist_reset();
+  for (int i = 0; i < EDIST_TABLE_LOCALES; i++)
+    edist_add_locale(i);
+
+  printf("%d locales, %d replays per session, top %d.\n\n", edist_ctx.count,
+         reps, TYPING_TOP_K);
+  printf("%-9s %4s %11s %11s %8s %8s\n", "session", "keys", "scratch_us",
+         "typed_us", "speedup", "batches");
+
+  for (int s = 0; s < n_sessions; s++) {
+    const char16_t *keys = kSessions[s].keys;
+    double best_cold_ns = INFINITY, best_warm_ns = INFINITY;
+    int n_keys = 0, batches = 0;
+
+    for (int rep = 0; rep < reps; rep++) {
+      double cold_ns = 0, warm_ns = 0;
+      int cold_batches = 0;
+      batches = 0;
+      n_keys = typing_replay(keys, 1, cold, &cold_ns, &cold_batches);
+      typing_replay(keys, 0, warm, &warm_ns, &batches);
+      best_cold_ns = fmin(best_cold_ns, cold_ns);
+      best_warm_ns = fmin(best_warm_ns, warm_ns);
+
+      if (!rep)
+        for (int i = 0; i < n_keys; i++)
+          mismatches += memcmp(warm[i], cold[i],
+                               (warm[i][0] + 1) * sizeof(**warm)) != 0;
+    }
+
+    printf("%-9s %4d %11.2f %11.2f %7.2fx %4.1f/%-3d\n", kSessions[s].name,
+           n_keys, best_cold_ns / n_keys / 1000.0,
+           best_warm_ns / n_keys / 1000.0, best_cold_ns / best_warm_ns,
+           (double)batches / n_keys,
+           (2 * edist_ctx.count + EDIST_LANES - 1) / EDIST_LANES);
+  }
+
+  printf("\nMismatched keystrokes %llu\n", (unsigned long long)mismatches);
+  printf("%s\n", mismatches ? "FAILED" : "PASSED");
+
+  return mismatches ? 1 : 0;
+}
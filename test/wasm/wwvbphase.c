@@ -0,0 +1,112 @@
+/**
+ * Native check of the WWVB phase modulation time code.
+ *
+ * For minutes spread across the century, decodes the generated frame and
+ * checks the sync word, the fixed bits, the minute of the century against
+ * one computed independently from the calendar date, and that the parity
+ * bits let a receiver correct any single-bit error in the time word.
+ *
+ * Usage: wwvbphase
+ *
+ * Exits with a nonzero status if any frame is wrong.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include "waveform.h"
+
+#define CHECK_STEP_MINS 7919 /* Prime, so every minute of the hour is hit. */
+
+double tsig_native_now;
+
+static uint8_t frame_bit(uint8_t xmit_phase[], int sec) {
+  return (xmit_phase[sec / CHAR_BIT] >> (sec % CHAR_BIT)) & 1;
+}
+
+static uint32_t frame_field(uint8_t xmit_phase[], int lo, int hi) {
+  uint32_t value = 0;
+  for (int sec = lo; sec < hi; sec++)
+    value = (value << 1) | frame_bit(xmit_phase, sec);
+  return value;
+}
+
+/* Minute of the century, from the calendar alone. */
+static uint32_t calendar_moc(tsig_datetime_t datetime) {
+  uint32_t days = datetime.doy - 1;
+  for (int year = 2000; year < datetime.year; year++)
+    days += 365 + tsig_datetime_is_leap(year);
+  return (days * 24 + datetime.hour) * 60 + datetime.min;
+}
+
+static uint8_t syndrome(uint32_t word) {
+  uint8_t s = 0;
+  for (int i = 0; i < 5; i++)
+    s |= __builtin_parity(word & TSIG_WAVEFORM_WWVB_PARITY[i]) << i;
+  return s;
+}
+
+/* Whether every single-bit error in the time word is detected and located. */
+static int check_parity_matrix() {
+  uint32_t seen = 0;
+  for (int i = 0; i < 26; i++) {
+    uint8_t s = syndrome(UINT32_C(1) << i);
+    if (__builtin_popcount(s) < 2 || (seen & (UINT32_C(1) << s)))
+      return 0;
+    seen |= UINT32_C(1) << s;
+  }
+  return 1;
+}
+
+static int check_minute(double timestamp) {
+  tsig_datetime_t datetime = tsig_datetime_parse_timestamp(timestamp);
+  tsig_params_t params = {.station = TSIG_STATION_WWVB};
+  uint8_t xmit_phase[(60 + CHAR_BIT - 1) / CHAR_BIT] = {0};
+  int failures = 0;
+
+  tsig_xmit_phase_wwvb(datetime, &params, xmit_phase);
+
+  uint32_t moc = frame_bit(xmit_phase, 18) << 25;
+  moc |= frame_field(xmit_phase, 20, 29) << 16;
+  moc |= frame_field(xmit_phase, 30, 39) << 7;
+  moc |= frame_field(xmit_phase, 40, 47);
+
+  uint8_t parity = 0;
+  for (int i = 0; i < 5; i++)
+    parity |= frame_bit(xmit_phase, 17 - i) << i;
+
+  failures += frame_field(xmit_phase, 0, 13) != TSIG_WAVEFORM_WWVB_SYNC_T;
+  failures += moc != calendar_moc(datetime);
+  failures += syndrome(moc) != parity;
+  failures += frame_bit(xmit_phase, 19) != (moc & 1);
+  failures += frame_bit(xmit_phase, 29) != 0;
+  failures += frame_bit(xmit_phase, 39) != 1;
+  failures += frame_bit(xmit_phase, 49) != 1;
+  failures += frame_bit(xmit_phase, 59) != 0;
+
+  if (failures)
+    printf("%04u-%03u %02u:%02u: %d error(s)\n", datetime.year, datetime.doy,
+           datetime.hour, datetime.min, failures);
+
+  return !!failures;
+}
+
+int main() {
+  double start = TSIG_WAVEFORM_WWVB_EPOCH;
+  double end = 4102444800000.0; /* 2100-01-01T00:00Z */
+  int frames = 0, failures = 0;
+
+  if (!check_parity_matrix()) {
+    printf("Parity cannot correct every single-bit error\n");
+    failures++;
+  }
+
+  for (double ms = start; ms < end; ms += CHECK_STEP_MINS * 60000.0) {
+    failures += check_minute(ms);
+    frames++;
+  }
+
+  printf("Checked %d frames\n", frames);
+  printf("%s\n", failures ? "FAILED" : "PASSED");
+
+  return failures ? 1 : 0;
+}
@@ -74,6 +74,12 @@ export default defineConfig({
       targets: [{ src: "./wasm/*.{js,wasm}", dest: "wasm" }],
     }),
   ],
+  worker: {
+    format: "es",
+    rollupOptions: {
+      external: [/wasm\/.*\.js/],
+    },
+  },
   resolve: {
     alias: {
       "@": path.resolve(__dirname, "./src"),